@@ -18,7 +18,7 @@
 
 #include <functional>
 #include <map>
-#include <optional>
+#include <memory>
 
 #include "cj_sensor_ffi.h"
 #include "sensor_agent_type.h"
@@ -27,6 +27,13 @@
 namespace OHOS {
 namespace Sensors {
 using SensorCallbackType = std::function<void(SensorEvent *)>;
+using SensorBatchCallbackType = std::function<void(SensorEvent *, int64_t)>;
+
+struct CJSensorCallback {
+    SensorCallbackType callback;
+    SensorBatchCallbackType batchCallback;
+};
+using CJCallbackTable = std::map<SensorDescription, CJSensorCallback>;
 
 class CJSensorImpl {
     DECLARE_DELAYED_SINGLETON(CJSensorImpl);
@@ -37,7 +44,10 @@ public:
     int32_t OffSensorChange(int32_t sensorId);
     int32_t OnSensorChangeEnhanced(int64_t interval, CSensorDescription& param, void (*callback)(SensorEvent *event));
     int32_t OffSensorChangeEnhanced(CSensorDescription& param);
+    int32_t OnSensorChangeBatch(int64_t interval, CSensorDescription& param,
+        void (*callback)(SensorEvent *events, int64_t count));
     void EmitCallBack(SensorEvent *event);
+    void EmitBatchCallBack(SensorEvent *events, uint32_t count);
 
     CGeomagneticData GetGeomagneticInfo(CLocationOptions location, int64_t timeMillis);
     int32_t GetAltitude(float seaPressure, float currentPressure, float *altitude);
@@ -61,11 +71,12 @@ private:
     int32_t UnsubscribeSensorImpl(int32_t sensorTypeId);
     int32_t SubscribeSensorImplEnhanced(int64_t interval, SensorDescription &sensorDesc);
     int32_t UnsubscribeSensorImplEnhanced(SensorDescription &sensorDesc);
-    std::map<SensorDescription, SensorCallbackType> callbackMap_;
+    // Copy-on-write table: writers publish a new table under mutex_, the data path only loads the current one.
+    std::shared_ptr<const CJCallbackTable> callbackTable_ = std::make_shared<const CJCallbackTable>();
 
     void DelCallbackEnhanced(SensorDescription sensorDesc);
-    void AddCallback2MapEnhanced(SensorDescription sensorDesc, SensorCallbackType callback);
-    std::optional<SensorCallbackType> FindCallback(SensorDescription sensorDesc);
+    void AddCallback2MapEnhanced(SensorDescription sensorDesc, const CJSensorCallback &callback);
+    std::shared_ptr<const CJCallbackTable> LoadCallbackTable() const;
     static bool GetLocationDeviceId(int32_t &deviceId);
 
     char *MallocCString(const std::string origin);
@@ -74,6 +85,7 @@ private:
     CArrFloat32 ConvertVector2CArr(const std::vector<float> &in);
 
     static void CJDataCallbackImpl(SensorEvent *event);
+    static void CJBatchDataCallbackImpl(SensorEvent *events, uint32_t count);
     const SensorUser cjUser_ = {.callback = CJDataCallbackImpl};
 };
 
@@ -67,6 +67,12 @@ SENSOR_FFI_EXPORT int32_t FfiSensorUnSubscribeSensorEnhanced(CSensorDescription
     return CJ_SENSOR_IMPL->OffSensorChangeEnhanced(param);
 }
 
+SENSOR_FFI_EXPORT int32_t FfiSensorSubscribeSensorBatch(int64_t interval, CSensorDescription param, int64_t id)
+{
+    void (*callback)(SensorEvent *events, int64_t count) = (void (*)(SensorEvent *, int64_t))id;
+    return CJ_SENSOR_IMPL->OnSensorChangeBatch(interval, param, callback);
+}
+
 CGeomagneticData FfiSensorGetGeomagneticInfo(CLocationOptions location, int64_t timeMillis)
 {
     return CJ_SENSOR_IMPL->GetGeomagneticInfo(location, timeMillis);
@@ -45,10 +45,21 @@ void CJSensorImpl::CJDataCallbackImpl(SensorEvent *event)
     CJ_SENSOR_IMPL->EmitCallBack(event);
 }
 
+void CJSensorImpl::CJBatchDataCallbackImpl(SensorEvent *events, uint32_t count)
+{
+    CHKPV(events);
+    CJ_SENSOR_IMPL->EmitBatchCallBack(events, count);
+}
+
 int32_t CJSensorImpl::SubscribeSensorImplEnhanced(int64_t interval, SensorDescription &sensorDesc)
 {
     CALL_LOG_ENTER;
-    int32_t ret = SubscribeSensorEnhanced({sensorDesc.deviceId, sensorDesc.sensorType, sensorDesc.sensorId,
+    int32_t ret = SetSensorBatchCallback(&cjUser_, CJBatchDataCallbackImpl);
+    if (ret != ERR_OK) {
+        SEN_HILOGE("SetSensorBatchCallback failed");
+        return ret;
+    }
+    ret = SubscribeSensorEnhanced({sensorDesc.deviceId, sensorDesc.sensorType, sensorDesc.sensorId,
         sensorDesc.location}, &cjUser_);
     if (ret != ERR_OK) {
         SEN_HILOGE("SubscribeSensor failed");
@@ -80,7 +91,12 @@ int32_t CJSensorImpl::UnsubscribeSensorImplEnhanced(SensorDescription &sensorDes
 int32_t CJSensorImpl::SubscribeSensorImpl(int32_t sensorId, int64_t interval)
 {
     CALL_LOG_ENTER;
-    int32_t ret = SubscribeSensor(sensorId, &cjUser_);
+    int32_t ret = SetSensorBatchCallback(&cjUser_, CJBatchDataCallbackImpl);
+    if (ret != ERR_OK) {
+        SEN_HILOGE("SetSensorBatchCallback failed");
+        return ret;
+    }
+    ret = SubscribeSensor(sensorId, &cjUser_);
     if (ret != ERR_OK) {
         SEN_HILOGE("SubscribeSensor failed");
         return ret;
@@ -185,7 +201,7 @@ int32_t CJSensorImpl::OnSensorChange(int32_t sensorId, int64_t interval, void (*
         SEN_HILOGW("Cant find local deviceId, default deviceId :%{public}d", deviceId);
     }
     SensorDescription sensorDesc = {deviceId, sensorId, DEFAULT_SENSOR_ID, IS_LOCAL_DEVICE};
-    AddCallback2MapEnhanced(sensorDesc, CJLambda::Create(callback));
+    AddCallback2MapEnhanced(sensorDesc, {CJLambda::Create(callback), nullptr});
     return ERR_OK;
 }
 
@@ -222,7 +238,27 @@ int32_t CJSensorImpl::OnSensorChangeEnhanced(int64_t interval, CSensorDescriptio
         return ret;
     }
 
-    AddCallback2MapEnhanced(sensorDesc, CJLambda::Create(callback));
+    AddCallback2MapEnhanced(sensorDesc, {CJLambda::Create(callback), nullptr});
+    return ERR_OK;
+}
+
+int32_t CJSensorImpl::OnSensorChangeBatch(int64_t interval, CSensorDescription& param,
+    void (*callback)(SensorEvent *events, int64_t count))
+{
+    CALL_LOG_ENTER;
+    CHKPR(callback, PARAMETER_ERROR);
+    SensorDescription sensorDesc;
+    sensorDesc.deviceId = param.deviceId;
+    sensorDesc.sensorType = param.sensorType;
+    sensorDesc.sensorId = param.sensorId;
+    sensorDesc.location = param.location;
+    int32_t ret = SubscribeSensorImplEnhanced(interval, sensorDesc);
+    if (ret != ERR_OK) {
+        SEN_HILOGE("SubscribeSensor failed.");
+        return ret;
+    }
+
+    AddCallback2MapEnhanced(sensorDesc, {nullptr, CJLambda::Create(callback)});
     return ERR_OK;
 }
 
@@ -246,26 +282,50 @@ int32_t CJSensorImpl::OffSensorChangeEnhanced(CSensorDescription& param)
 
 void CJSensorImpl::EmitCallBack(SensorEvent *event)
 {
-    auto callback = FindCallback(SensorDescription{event->deviceId, event->sensorTypeId, event->sensorId,
-        event->location});
-    if (callback == std::nullopt) {
-        SEN_HILOGE("EmitCallBack failed, %{public}d not find.", event->sensorTypeId);
+    EmitBatchCallBack(event, 1);
+}
+
+void CJSensorImpl::EmitBatchCallBack(SensorEvent *events, uint32_t count)
+{
+    if (count == 0) {
         return;
     }
-
-    callback.value()(event);
+    auto table = LoadCallbackTable();
+    auto iter = table->find(SensorDescription{events[0].deviceId, events[0].sensorTypeId, events[0].sensorId,
+        events[0].location});
+    if (iter == table->end()) {
+        SEN_HILOGE("EmitCallBack failed, %{public}d not find.", events[0].sensorTypeId);
+        return;
+    }
+    if (iter->second.batchCallback != nullptr) {
+        iter->second.batchCallback(events, static_cast<int64_t>(count));
+        return;
+    }
+    CHKPV(iter->second.callback);
+    for (uint32_t i = 0; i < count; ++i) {
+        iter->second.callback(&events[i]);
+    }
 }
 
-void CJSensorImpl::AddCallback2MapEnhanced(SensorDescription sensorDesc, SensorCallbackType callback)
+void CJSensorImpl::AddCallback2MapEnhanced(SensorDescription sensorDesc, const CJSensorCallback &callback)
 {
     std::lock_guard<std::mutex> lock(mutex_);
-    callbackMap_[sensorDesc]= callback;
+    auto table = std::make_shared<CJCallbackTable>(*callbackTable_);
+    (*table)[sensorDesc] = callback;
+    std::atomic_store(&callbackTable_, std::shared_ptr<const CJCallbackTable>(table));
 }
 
 void CJSensorImpl::DelCallbackEnhanced(SensorDescription sensorDesc)
 {
     std::lock_guard<std::mutex> mutex(mutex_);
-    callbackMap_.erase(sensorDesc);
+    auto table = std::make_shared<CJCallbackTable>(*callbackTable_);
+    table->erase(sensorDesc);
+    std::atomic_store(&callbackTable_, std::shared_ptr<const CJCallbackTable>(table));
+}
+
+std::shared_ptr<const CJCallbackTable> CJSensorImpl::LoadCallbackTable() const
+{
+    return std::atomic_load(&callbackTable_);
 }
 
 bool CJSensorImpl::GetLocationDeviceId(int32_t &deviceId)
@@ -286,17 +346,6 @@ bool CJSensorImpl::GetLocationDeviceId(int32_t &deviceId)
     return false;
 }
 
-std::optional<SensorCallbackType> CJSensorImpl::FindCallback(SensorDescription sensorDesc)
-{
-    std::lock_guard<std::mutex> mutex(mutex_);
-    auto iter = callbackMap_.find(sensorDesc);
-    if (iter != callbackMap_.end()) {
-        return iter->second;
-    }
-
-    return std::nullopt;
-}
-
 CGeomagneticData CJSensorImpl::GetGeomagneticInfo(CLocationOptions location, int64_t timeMillis)
 {
     GeomagneticField geomagneticField(location.latitude, location.longitude, location.altitude, timeMillis);
@@ -43,7 +43,6 @@ using namespace ohos::sensor;
 using namespace OHOS::Sensors;
 using namespace OHOS;
 
-using responseSensorData = std::variant<int32_t, int64_t, float, double, bool, string, ohos::sensor::SensorAccuracy>;
 using callbackType = std::variant<taihe::callback<void(WearDetectionResponse const &)>,
     taihe::callback<void(SignificantMotionResponse const &)>, taihe::callback<void(RotationVectorResponse const &)>,
     taihe::callback<void(ProximityResponse const &)>, taihe::callback<void(PedometerDetectionResponse const &)>,
@@ -71,6 +70,19 @@ struct CallbackObject : public RefBase {
     ani_ref ref;
 };
 
+struct SensorCallbackData {
+    const float *values;
+    ohos::sensor::Response base;
+};
+
+using SensorCallbackFunc = void (*)(const SensorCallbackData &data, const sptr<CallbackObject> &callbackObject);
+
+struct SensorCallbackConverter {
+    int32_t sensorTypeId;
+    uint32_t valueCount;
+    SensorCallbackFunc callback;
+};
+
 namespace {
 constexpr int32_t ROTATION_VECTOR_LENGTH = 3;
 constexpr int32_t QUATERNION_LENGTH = 4;
@@ -88,33 +100,8 @@ constexpr int32_t DEFAULT_SENSOR_ID = 0;
 std::mutex g_statusChangeMutex;
 std::vector<sptr<CallbackObject>> g_statusChangeCallbackInfos;
 
-void CallBackAccelermeter(std::map<std::string, responseSensorData> data, sptr<CallbackObject> callbackObject);
-void CallBackGyroscope(std::map<std::string, responseSensorData> data, sptr<CallbackObject> callbackObject);
-void CallBackAmbientLight(std::map<std::string, responseSensorData> data, sptr<CallbackObject> callbackObject);
-void CallBackMagneticField(std::map<std::string, responseSensorData> data, sptr<CallbackObject> callbackObject);
-void CallBackBarometer(std::map<std::string, responseSensorData> data, sptr<CallbackObject> callbackObject);
-void CallBackHall(std::map<std::string, responseSensorData> data, sptr<CallbackObject> callbackObject);
-void CallBackProximity(std::map<std::string, responseSensorData> data, sptr<CallbackObject> callbackObject);
-void CallBackHumidity(std::map<std::string, responseSensorData> data, sptr<CallbackObject> callbackObject);
-void CallBackOrientation(std::map<std::string, responseSensorData> data, sptr<CallbackObject> callbackObject);
-void CallBackGravity(std::map<std::string, responseSensorData> data, sptr<CallbackObject> callbackObject);
-void CallBackLinearAcceleration(std::map<std::string, responseSensorData> data, sptr<CallbackObject> callbackObject);
-void CallBackRotationVector(std::map<std::string, responseSensorData> data, sptr<CallbackObject> callbackObject);
-void CallBackAmbientTemperature(std::map<std::string, responseSensorData> data, sptr<CallbackObject> callbackObject);
-void CallBackMagneticFieldUncalibrated(std::map<std::string, responseSensorData> data,
-    sptr<CallbackObject> callbackObject);
-void CallBackGyroscopeUncalibrated(std::map<std::string, responseSensorData> data, sptr<CallbackObject> callbackObject);
-void CallBackSignificantMotion(std::map<std::string, responseSensorData> data, sptr<CallbackObject> callbackObject);
-void CallBackPedometerDetection(std::map<std::string, responseSensorData> data, sptr<CallbackObject> callbackObject);
-void CallBackPedometer(std::map<std::string, responseSensorData> data, sptr<CallbackObject> callbackObject);
-void CallBackHeartRate(std::map<std::string, responseSensorData> data, sptr<CallbackObject> callbackObject);
-void CallBackWearDetection(std::map<std::string, responseSensorData> data, sptr<CallbackObject> callbackObject);
-void CallBackAccelerometerUncalibrated(std::map<std::string, responseSensorData> data,
-    sptr<CallbackObject> callbackObject);
-void CallBackColor(std::map<std::string, responseSensorData> data, sptr<CallbackObject> callbackObject);
-void CallBackSar(std::map<std::string, responseSensorData> data, sptr<CallbackObject> callbackObject);
-void CallBackFusionPressure(std::map<std::string, responseSensorData> data, sptr<CallbackObject> callbackObject);
-void CallBackSensorStatusChange(std::map<std::string, responseSensorData> data, sptr<CallbackObject> callbackObject);
+void CallBackSensorStatusChange(const ohos::sensor::SensorStatusEvent &responseData,
+    const sptr<CallbackObject> &callbackObject);
 void EmitOnceCallback(SensorEvent *event);
 
 std::map<taihe::string, int64_t> g_samplingPeriod = {
@@ -123,63 +110,6 @@ std::map<taihe::string, int64_t> g_samplingPeriod = {
     { "game", 20000000 },
 };
 
-std::map<int32_t, std::vector<string>> g_sensorAttributeList = {
-    { 0, { "x" } },
-    { SENSOR_TYPE_ID_ACCELEROMETER, { "x", "y", "z" } },
-    { SENSOR_TYPE_ID_GYROSCOPE, { "x", "y", "z" } },
-    { SENSOR_TYPE_ID_AMBIENT_LIGHT, { "intensity", "colorTemperature", "infraredLuminance" } },
-    { SENSOR_TYPE_ID_MAGNETIC_FIELD, { "x", "y", "z" } },
-    { SENSOR_TYPE_ID_BAROMETER, { "pressure" } },
-    { SENSOR_TYPE_ID_HALL, { "status" } },
-    { SENSOR_TYPE_ID_TEMPERATURE, { "temperature" } },
-    { SENSOR_TYPE_ID_PROXIMITY, { "distance" } },
-    { SENSOR_TYPE_ID_HUMIDITY, { "humidity" } },
-    { SENSOR_TYPE_ID_ORIENTATION, { "alpha", "beta", "gamma" } },
-    { SENSOR_TYPE_ID_GRAVITY, { "x", "y", "z" } },
-    { SENSOR_TYPE_ID_LINEAR_ACCELERATION, { "x", "y", "z" } },
-    { SENSOR_TYPE_ID_ROTATION_VECTOR, { "x", "y", "z", "w" } },
-    { SENSOR_TYPE_ID_AMBIENT_TEMPERATURE, { "temperature" } },
-    { SENSOR_TYPE_ID_MAGNETIC_FIELD_UNCALIBRATED, { "x", "y", "z", "biasX", "biasY", "biasZ" } },
-    { SENSOR_TYPE_ID_GYROSCOPE_UNCALIBRATED, { "x", "y", "z", "biasX", "biasY", "biasZ" } },
-    { SENSOR_TYPE_ID_SIGNIFICANT_MOTION, { "scalar" } },
-    { SENSOR_TYPE_ID_PEDOMETER_DETECTION, { "scalar" } },
-    { SENSOR_TYPE_ID_PEDOMETER, { "steps" } },
-    { SENSOR_TYPE_ID_HEART_RATE, { "heartRate" } },
-    { SENSOR_TYPE_ID_WEAR_DETECTION, { "value" } },
-    { SENSOR_TYPE_ID_ACCELEROMETER_UNCALIBRATED, { "x", "y", "z", "biasX", "biasY", "biasZ" } },
-    { SENSOR_TYPE_ID_COLOR, { "lightIntensity", "colorTemperature" } },
-    { SENSOR_TYPE_ID_SAR, { "absorptionRatio" } },
-    { SENSOR_TYPE_ID_FUSION_PRESSURE, { "fusionPressure" } },
-};
-
-std::map<int32_t, std::function<void(std::map<std::string, responseSensorData>, sptr<CallbackObject>)>>
-    g_functionBySensorTypeIdMap = {
-        { SENSOR_TYPE_ID_ACCELEROMETER, CallBackAccelermeter },
-        { SENSOR_TYPE_ID_GYROSCOPE, CallBackGyroscope },
-        { SENSOR_TYPE_ID_AMBIENT_LIGHT, CallBackAmbientLight },
-        { SENSOR_TYPE_ID_MAGNETIC_FIELD, CallBackMagneticField },
-        { SENSOR_TYPE_ID_BAROMETER, CallBackBarometer },
-        { SENSOR_TYPE_ID_HALL, CallBackHall },
-        { SENSOR_TYPE_ID_PROXIMITY, CallBackProximity },
-        { SENSOR_TYPE_ID_HUMIDITY, CallBackHumidity },
-        { SENSOR_TYPE_ID_ORIENTATION, CallBackOrientation },
-        { SENSOR_TYPE_ID_GRAVITY, CallBackGravity },
-        { SENSOR_TYPE_ID_LINEAR_ACCELERATION, CallBackLinearAcceleration },
-        { SENSOR_TYPE_ID_ROTATION_VECTOR, CallBackRotationVector },
-        { SENSOR_TYPE_ID_AMBIENT_TEMPERATURE, CallBackAmbientTemperature },
-        { SENSOR_TYPE_ID_MAGNETIC_FIELD_UNCALIBRATED, CallBackMagneticFieldUncalibrated },
-        { SENSOR_TYPE_ID_GYROSCOPE_UNCALIBRATED, CallBackGyroscopeUncalibrated },
-        { SENSOR_TYPE_ID_SIGNIFICANT_MOTION, CallBackSignificantMotion },
-        { SENSOR_TYPE_ID_PEDOMETER_DETECTION, CallBackPedometerDetection },
-        { SENSOR_TYPE_ID_PEDOMETER, CallBackPedometer },
-        { SENSOR_TYPE_ID_HEART_RATE, CallBackHeartRate },
-        { SENSOR_TYPE_ID_WEAR_DETECTION, CallBackWearDetection },
-        { SENSOR_TYPE_ID_ACCELEROMETER_UNCALIBRATED, CallBackAccelerometerUncalibrated },
-        { SENSOR_TYPE_ID_COLOR, CallBackColor },
-        { SENSOR_TYPE_ID_SAR, CallBackSar },
-        { SENSOR_TYPE_ID_FUSION_PRESSURE, CallBackFusionPressure },
-    };
-
 std::mutex g_mutex;
 std::mutex g_bodyMutex;
 std::map<int32_t, std::vector<sptr<CallbackObject>>> g_subscribeCallbacks;
@@ -187,7 +117,6 @@ std::mutex g_onMutex;
 std::mutex g_onceMutex;
 std::map<int32_t, std::vector<sptr<CallbackObject>>> g_onCallbackInfos;
 std::map<int32_t, std::vector<sptr<CallbackObject>>> g_onceCallbackInfos;
-std::mutex g_sensorTaiheAttrListMutex;
 
 std::vector<float> transformDoubleToFloat(array_view<double> doubleArray)
 {
@@ -462,611 +391,135 @@ bool CheckSubscribe(int32_t sensorTypeId)
     return g_onCallbackInfos.find(sensorTypeId) != g_onCallbackInfos.end();
 }
 
-void CallBackAccelermeter(std::map<std::string, responseSensorData> data, sptr<CallbackObject> callbackObject)
+template<typename ResponseType>
+void InvokeResponseCallback(const ResponseType &responseData, const sptr<CallbackObject> &callbackObject)
 {
-    if (callbackObject == nullptr) {
-        SEN_HILOGE("callbackObject is null");
-        return;
-    }
-    if (!std::holds_alternative<taihe::callback<void(AccelerometerResponse const &)>>(callbackObject->callback)) {
-        SEN_HILOGE("callbackObject is not of type callback accelerometerResponse function");
+    auto func = std::get_if<taihe::callback<void(ResponseType const &)>>(&callbackObject->callback);
+    if (func == nullptr) {
+        SEN_HILOGE("callbackObject is not of type callback response function of this sensor");
         return;
     }
-    ohos::sensor::Response res = {
-        .timestamp = std::get<int64_t>(data["timestamp"]),
-        .accuracy = std::get<ohos::sensor::SensorAccuracy>(data["accuracy"]),
-    };
-    AccelerometerResponse responseData = {
-        .base = res,
-        .x = std::get<double>(data["x"]),
-        .y = std::get<double>(data["y"]),
-        .z = std::get<double>(data["z"]),
-    };
-    auto &func = std::get<taihe::callback<void(AccelerometerResponse const &)>>(callbackObject->callback);
-    func(responseData);
+    (*func)(responseData);
 }
 
-void CallBackGyroscope(std::map<std::string, responseSensorData> data, sptr<CallbackObject> callbackObject)
+template<typename ResponseType, double ResponseType::*... Fields>
+void CallBackResponse(const SensorCallbackData &data, const sptr<CallbackObject> &callbackObject)
 {
     if (callbackObject == nullptr) {
         SEN_HILOGE("callbackObject is null");
         return;
     }
-    if (!std::holds_alternative<taihe::callback<void(GyroscopeResponse const &)>>(callbackObject->callback)) {
-        SEN_HILOGE("callbackObject is not of type callback gyroscopeResponse function");
-        return;
-    }
-    ohos::sensor::Response res = {
-        .timestamp = std::get<int64_t>(data["timestamp"]),
-        .accuracy = std::get<ohos::sensor::SensorAccuracy>(data["accuracy"]),
-    };
-    GyroscopeResponse responseData = {
-        .base = res,
-        .x = std::get<double>(data["x"]),
-        .y = std::get<double>(data["y"]),
-        .z = std::get<double>(data["z"]),
-    };
-    auto &func = std::get<taihe::callback<void(GyroscopeResponse const &)>>(callbackObject->callback);
-    func(responseData);
+    ResponseType responseData = { .base = data.base };
+    size_t index = 0;
+    ((responseData.*Fields = static_cast<double>(data.values[index++])), ...);
+    InvokeResponseCallback(responseData, callbackObject);
 }
 
-void CallBackAmbientLight(std::map<std::string, responseSensorData> data, sptr<CallbackObject> callbackObject)
+void CallBackAmbientLight(const SensorCallbackData &data, const sptr<CallbackObject> &callbackObject)
 {
     if (callbackObject == nullptr) {
         SEN_HILOGE("callbackObject is null");
         return;
     }
-    if (!std::holds_alternative<taihe::callback<void(LightResponse const &)>>(callbackObject->callback)) {
-        SEN_HILOGE("callbackObject is not of type callback lightResponse function");
-        return;
-    }
-    ohos::sensor::Response res = {
-        .timestamp = std::get<int64_t>(data["timestamp"]),
-        .accuracy = std::get<ohos::sensor::SensorAccuracy>(data["accuracy"]),
-    };
     LightResponse responseData = {
-        .base = res,
-        .intensity = std::get<double>(data["intensity"]),
-        .colorTemperature = taihe::optional<double>(std::in_place_t{}, std::get<double>(data["colorTemperature"])),
-        .infraredLuminance = taihe::optional<double>(std::in_place_t{}, std::get<double>(data["infraredLuminance"])),
-    };
-    auto &func = std::get<taihe::callback<void(LightResponse const &)>>(callbackObject->callback);
-    func(responseData);
-}
-
-void CallBackMagneticField(std::map<std::string, responseSensorData> data, sptr<CallbackObject> callbackObject)
-{
-    if (callbackObject == nullptr) {
-        SEN_HILOGE("callbackObject is null");
-        return;
-    }
-    if (!std::holds_alternative<taihe::callback<void(MagneticFieldResponse const &)>>(callbackObject->callback)) {
-        SEN_HILOGE("callbackObject is not of type callback magneticFieldResponse function");
-        return;
-    }
-    ohos::sensor::Response res = {
-        .timestamp = std::get<int64_t>(data["timestamp"]),
-        .accuracy = std::get<ohos::sensor::SensorAccuracy>(data["accuracy"]),
-    };
-    MagneticFieldResponse responseData = {
-        .base = res,
-        .x = std::get<double>(data["x"]),
-        .y = std::get<double>(data["y"]),
-        .z = std::get<double>(data["z"]),
-    };
-    auto &func = std::get<taihe::callback<void(MagneticFieldResponse const &)>>(callbackObject->callback);
-    func(responseData);
-}
-
-void CallBackBarometer(std::map<std::string, responseSensorData> data, sptr<CallbackObject> callbackObject)
-{
-    if (callbackObject == nullptr) {
-        SEN_HILOGE("callbackObject is null");
-        return;
-    }
-    if (!std::holds_alternative<taihe::callback<void(BarometerResponse const &)>>(callbackObject->callback)) {
-        SEN_HILOGE("callbackObject is not of type callback barometerResponse function");
-        return;
-    }
-    ohos::sensor::Response res = {
-        .timestamp = std::get<int64_t>(data["timestamp"]),
-        .accuracy = std::get<ohos::sensor::SensorAccuracy>(data["accuracy"]),
-    };
-    BarometerResponse responseData = {
-        .base = res,
-        .pressure = std::get<double>(data["pressure"]),
-    };
-    auto &func = std::get<taihe::callback<void(BarometerResponse const &)>>(callbackObject->callback);
-    func(responseData);
-}
-
-void CallBackHall(std::map<std::string, responseSensorData> data, sptr<CallbackObject> callbackObject)
-{
-    if (callbackObject == nullptr) {
-        SEN_HILOGE("callbackObject is null");
-        return;
-    }
-    if (!std::holds_alternative<taihe::callback<void(HallResponse const &)>>(callbackObject->callback)) {
-        SEN_HILOGE("callbackObject is not of type callback hallResponse function");
-        return;
-    }
-    ohos::sensor::Response res = {
-        .timestamp = std::get<int64_t>(data["timestamp"]),
-        .accuracy = std::get<ohos::sensor::SensorAccuracy>(data["accuracy"]),
-    };
-    HallResponse responseData = {
-        .base = res,
-        .status = std::get<double>(data["status"]),
+        .base = data.base,
+        .intensity = static_cast<double>(data.values[0]),
+        .colorTemperature = taihe::optional<double>(std::in_place_t{}, static_cast<double>(data.values[1])),
+        .infraredLuminance = taihe::optional<double>(std::in_place_t{}, static_cast<double>(data.values[2])),
     };
-    auto &func = std::get<taihe::callback<void(HallResponse const &)>>(callbackObject->callback);
-    func(responseData);
-}
-
-void CallBackProximity(std::map<std::string, responseSensorData> data, sptr<CallbackObject> callbackObject)
-{
-    if (callbackObject == nullptr) {
-        SEN_HILOGE("callbackObject is null");
-        return;
-    }
-    if (!std::holds_alternative<taihe::callback<void(ProximityResponse const &)>>(callbackObject->callback)) {
-        SEN_HILOGE("callbackObject is not of type callback proximityResponse function");
-        return;
-    }
-    ohos::sensor::Response res = {
-        .timestamp = std::get<int64_t>(data["timestamp"]),
-        .accuracy = std::get<ohos::sensor::SensorAccuracy>(data["accuracy"]),
-    };
-    ProximityResponse responseData = {
-        .base = res,
-        .distance = std::get<double>(data["distance"]),
-    };
-    auto &func = std::get<taihe::callback<void(ProximityResponse const &)>>(callbackObject->callback);
-    func(responseData);
-}
-
-void CallBackHumidity(std::map<std::string, responseSensorData> data, sptr<CallbackObject> callbackObject)
-{
-    if (callbackObject == nullptr) {
-        SEN_HILOGE("callbackObject is null");
-        return;
-    }
-    if (!std::holds_alternative<taihe::callback<void(HumidityResponse const &)>>(callbackObject->callback)) {
-        SEN_HILOGE("callbackObject is not of type callback humidityResponse function");
-        return;
-    }
-    ohos::sensor::Response res = {
-        .timestamp = std::get<int64_t>(data["timestamp"]),
-        .accuracy = std::get<ohos::sensor::SensorAccuracy>(data["accuracy"]),
-    };
-    HumidityResponse responseData = {
-        .base = res,
-        .humidity = std::get<double>(data["humidity"]),
-    };
-    auto &func = std::get<taihe::callback<void(HumidityResponse const &)>>(callbackObject->callback);
-    func(responseData);
-}
-
-void CallBackOrientation(std::map<std::string, responseSensorData> data, sptr<CallbackObject> callbackObject)
-{
-    if (callbackObject == nullptr) {
-        SEN_HILOGE("callbackObject is null");
-        return;
-    }
-    if (!std::holds_alternative<taihe::callback<void(OrientationResponse const &)>>(callbackObject->callback)) {
-        SEN_HILOGE("callbackObject is not of type callback orientationResponse function");
-        return;
-    }
-    ohos::sensor::Response res = {
-        .timestamp = std::get<int64_t>(data["timestamp"]),
-        .accuracy = std::get<ohos::sensor::SensorAccuracy>(data["accuracy"]),
-    };
-    OrientationResponse responseData = {
-        .base = res,
-        .alpha = std::get<double>(data["alpha"]),
-        .beta = std::get<double>(data["beta"]),
-        .gamma = std::get<double>(data["gamma"]),
-    };
-    auto &func = std::get<taihe::callback<void(OrientationResponse const &)>>(callbackObject->callback);
-    func(responseData);
-}
-
-void CallBackGravity(std::map<std::string, responseSensorData> data, sptr<CallbackObject> callbackObject)
-{
-    if (callbackObject == nullptr) {
-        SEN_HILOGE("callbackObject is null");
-        return;
-    }
-    if (!std::holds_alternative<taihe::callback<void(GravityResponse const &)>>(callbackObject->callback)) {
-        SEN_HILOGE("callbackObject is not of type callback gravityResponse function");
-        return;
-    }
-    ohos::sensor::Response res = {
-        .timestamp = std::get<int64_t>(data["timestamp"]),
-        .accuracy = std::get<ohos::sensor::SensorAccuracy>(data["accuracy"]),
-    };
-    GravityResponse responseData = {
-        .base = res,
-        .x = std::get<double>(data["x"]),
-        .y = std::get<double>(data["y"]),
-        .z = std::get<double>(data["z"]),
-    };
-    auto &func = std::get<taihe::callback<void(GravityResponse const &)>>(callbackObject->callback);
-    func(responseData);
-}
-
-void CallBackLinearAcceleration(std::map<std::string, responseSensorData> data, sptr<CallbackObject> callbackObject)
-{
-    if (callbackObject == nullptr) {
-        SEN_HILOGE("callbackObject is null");
-        return;
-    }
-    if (!std::holds_alternative<taihe::callback<void(LinearAccelerometerResponse const &)>>(callbackObject->callback)) {
-        SEN_HILOGE("callbackObject is not of type callback linearAccelerometerResponse function");
-        return;
-    }
-    ohos::sensor::Response res = {
-        .timestamp = std::get<int64_t>(data["timestamp"]),
-        .accuracy = std::get<ohos::sensor::SensorAccuracy>(data["accuracy"]),
-    };
-    LinearAccelerometerResponse responseData = {
-        .base = res,
-        .x = std::get<double>(data["x"]),
-        .y = std::get<double>(data["y"]),
-        .z = std::get<double>(data["z"]),
-    };
-    auto &func = std::get<taihe::callback<void(LinearAccelerometerResponse const &)>>(callbackObject->callback);
-    func(responseData);
-}
-
-void CallBackRotationVector(std::map<std::string, responseSensorData> data, sptr<CallbackObject> callbackObject)
-{
-    if (callbackObject == nullptr) {
-        SEN_HILOGE("callbackObject is null");
-        return;
-    }
-    if (!std::holds_alternative<taihe::callback<void(RotationVectorResponse const &)>>(callbackObject->callback)) {
-        SEN_HILOGE("callbackObject is not of type callback rotationVectorResponse function");
-        return;
-    }
-    ohos::sensor::Response res = {
-        .timestamp = std::get<int64_t>(data["timestamp"]),
-        .accuracy = std::get<ohos::sensor::SensorAccuracy>(data["accuracy"]),
-    };
-    RotationVectorResponse responseData = {
-        .base = res,
-        .x = std::get<double>(data["x"]),
-        .y = std::get<double>(data["y"]),
-        .z = std::get<double>(data["z"]),
-        .w = std::get<double>(data["w"]),
-    };
-    auto &func = std::get<taihe::callback<void(RotationVectorResponse const &)>>(callbackObject->callback);
-    func(responseData);
-}
-
-void CallBackAmbientTemperature(std::map<std::string, responseSensorData> data, sptr<CallbackObject> callbackObject)
-{
-    if (callbackObject == nullptr) {
-        SEN_HILOGE("callbackObject is null");
-        return;
-    }
-    if (!std::holds_alternative<taihe::callback<void(AmbientTemperatureResponse const &)>>(callbackObject->callback)) {
-        SEN_HILOGE("callbackObject is not of type callback ambientTemperatureResponse function");
-        return;
-    }
-    ohos::sensor::Response res = {
-        .timestamp = std::get<int64_t>(data["timestamp"]),
-        .accuracy = std::get<ohos::sensor::SensorAccuracy>(data["accuracy"]),
-    };
-    AmbientTemperatureResponse responseData = {
-        .base = res,
-        .temperature = std::get<double>(data["temperature"]),
-    };
-    auto &func = std::get<taihe::callback<void(AmbientTemperatureResponse const &)>>(callbackObject->callback);
-    func(responseData);
-}
-
-void CallBackMagneticFieldUncalibrated(std::map<std::string, responseSensorData> data,
-    sptr<CallbackObject> callbackObject)
-{
-    if (callbackObject == nullptr) {
-        SEN_HILOGE("callbackObject is null");
-        return;
-    }
-    if (!std::holds_alternative<taihe::callback<void(MagneticFieldUncalibratedResponse const &)>>(
-        callbackObject->callback)) {
-        SEN_HILOGE("callbackObject is not of type callback magneticFieldUncalibratedResponse function");
-        return;
-    }
-    ohos::sensor::Response res = {
-        .timestamp = std::get<int64_t>(data["timestamp"]),
-        .accuracy = std::get<ohos::sensor::SensorAccuracy>(data["accuracy"]),
-    };
-    MagneticFieldUncalibratedResponse responseData = {
-        .base = res,
-        .x = std::get<double>(data["x"]),
-        .y = std::get<double>(data["y"]),
-        .z = std::get<double>(data["z"]),
-        .biasX = std::get<double>(data["biasX"]),
-        .biasY = std::get<double>(data["biasY"]),
-        .biasZ = std::get<double>(data["biasZ"]),
-    };
-    auto &func = std::get<taihe::callback<void(MagneticFieldUncalibratedResponse const &)>>(callbackObject->callback);
-    func(responseData);
-}
-
-void CallBackGyroscopeUncalibrated(std::map<std::string, responseSensorData> data, sptr<CallbackObject> callbackObject)
-{
-    if (callbackObject == nullptr) {
-        SEN_HILOGE("callbackObject is null");
-        return;
-    }
-    if (!std::holds_alternative<taihe::callback<void(GyroscopeUncalibratedResponse const &)>>(
-        callbackObject->callback)) {
-        SEN_HILOGE("callbackObject is not of type callback gyroscopeUncalibratedResponse function");
-        return;
-    }
-    ohos::sensor::Response res = {
-        .timestamp = std::get<int64_t>(data["timestamp"]),
-        .accuracy = std::get<ohos::sensor::SensorAccuracy>(data["accuracy"]),
-    };
-    GyroscopeUncalibratedResponse responseData = {
-        .base = res,
-        .x = std::get<double>(data["x"]),
-        .y = std::get<double>(data["y"]),
-        .z = std::get<double>(data["z"]),
-        .biasX = std::get<double>(data["biasX"]),
-        .biasY = std::get<double>(data["biasY"]),
-        .biasZ = std::get<double>(data["biasZ"]),
-    };
-    auto &func = std::get<taihe::callback<void(GyroscopeUncalibratedResponse const &)>>(callbackObject->callback);
-    func(responseData);
-}
-
-void CallBackSignificantMotion(std::map<std::string, responseSensorData> data, sptr<CallbackObject> callbackObject)
-{
-    if (callbackObject == nullptr) {
-        SEN_HILOGE("callbackObject is null");
-        return;
-    }
-    if (!std::holds_alternative<taihe::callback<void(SignificantMotionResponse const &)>>(callbackObject->callback)) {
-        SEN_HILOGE("callbackObject is not of type callback significantMotionResponse function");
-        return;
-    }
-    ohos::sensor::Response res = {
-        .timestamp = std::get<int64_t>(data["timestamp"]),
-        .accuracy = std::get<ohos::sensor::SensorAccuracy>(data["accuracy"]),
-    };
-    SignificantMotionResponse responseData = {
-        .base = res,
-        .scalar = std::get<double>(data["scalar"]),
-    };
-    auto &func = std::get<taihe::callback<void(SignificantMotionResponse const &)>>(callbackObject->callback);
-    func(responseData);
-}
-
-void CallBackPedometerDetection(std::map<std::string, responseSensorData> data, sptr<CallbackObject> callbackObject)
-{
-    if (callbackObject == nullptr) {
-        SEN_HILOGE("callbackObject is null");
-        return;
-    }
-    if (!std::holds_alternative<taihe::callback<void(PedometerDetectionResponse const &)>>(callbackObject->callback)) {
-        SEN_HILOGE("callbackObject is not of type callback pedometerDetectionResponse function");
-        return;
-    }
-    ohos::sensor::Response res = {
-        .timestamp = std::get<int64_t>(data["timestamp"]),
-        .accuracy = std::get<ohos::sensor::SensorAccuracy>(data["accuracy"]),
-    };
-    PedometerDetectionResponse responseData = {
-        .base = res,
-        .scalar = std::get<double>(data["scalar"]),
-    };
-    auto &func = std::get<taihe::callback<void(PedometerDetectionResponse const &)>>(callbackObject->callback);
-    func(responseData);
-}
-
-void CallBackPedometer(std::map<std::string, responseSensorData> data, sptr<CallbackObject> callbackObject)
-{
-    if (callbackObject == nullptr) {
-        SEN_HILOGE("callbackObject is null");
-        return;
-    }
-    if (!std::holds_alternative<taihe::callback<void(PedometerResponse const &)>>(callbackObject->callback)) {
-        SEN_HILOGE("callbackObject is not of type callback pedometerResponse function");
-        return;
-    }
-    ohos::sensor::Response res = {
-        .timestamp = std::get<int64_t>(data["timestamp"]),
-        .accuracy = std::get<ohos::sensor::SensorAccuracy>(data["accuracy"]),
-    };
-    PedometerResponse responseData = {
-        .base = res,
-        .steps = std::get<double>(data["steps"]),
-    };
-    auto &func = std::get<taihe::callback<void(PedometerResponse const &)>>(callbackObject->callback);
-    func(responseData);
-}
-
-void CallBackHeartRate(std::map<std::string, responseSensorData> data, sptr<CallbackObject> callbackObject)
-{
-    if (callbackObject == nullptr) {
-        SEN_HILOGE("callbackObject is null");
-        return;
-    }
-    if (!std::holds_alternative<taihe::callback<void(HeartRateResponse const &)>>(callbackObject->callback)) {
-        SEN_HILOGE("callbackObject is not of type callback heartRateResponse function");
-        return;
-    }
-    ohos::sensor::Response res = {
-        .timestamp = std::get<int64_t>(data["timestamp"]),
-        .accuracy = std::get<ohos::sensor::SensorAccuracy>(data["accuracy"]),
-    };
-    HeartRateResponse responseData = {
-        .base = res,
-        .heartRate = std::get<double>(data["heartRate"]),
-    };
-    auto &func = std::get<taihe::callback<void(HeartRateResponse const &)>>(callbackObject->callback);
-    func(responseData);
-}
-
-void CallBackWearDetection(std::map<std::string, responseSensorData> data, sptr<CallbackObject> callbackObject)
-{
-    if (callbackObject == nullptr) {
-        SEN_HILOGE("callbackObject is null");
-        return;
-    }
-    if (!std::holds_alternative<taihe::callback<void(WearDetectionResponse const &)>>(callbackObject->callback)) {
-        SEN_HILOGE("callbackObject is not of type callback wearDetectionResponse function");
-        return;
-    }
-    ohos::sensor::Response res = {
-        .timestamp = std::get<int64_t>(data["timestamp"]),
-        .accuracy = std::get<ohos::sensor::SensorAccuracy>(data["accuracy"]),
-    };
-    WearDetectionResponse responseData = {
-        .base = res,
-        .value = std::get<double>(data["value"]),
-    };
-    auto &func = std::get<taihe::callback<void(WearDetectionResponse const &)>>(callbackObject->callback);
-    func(responseData);
-}
-
-void CallBackAccelerometerUncalibrated(std::map<std::string, responseSensorData> data,
-    sptr<CallbackObject> callbackObject)
-{
-    if (callbackObject == nullptr) {
-        SEN_HILOGE("callbackObject is null");
-        return;
-    }
-    if (!std::holds_alternative<taihe::callback<void(AccelerometerUncalibratedResponse const &)>>(
-        callbackObject->callback)) {
-        SEN_HILOGE("callbackObject is not of type callback accelerometerUncalibratedResponse function");
-        return;
-    }
-    ohos::sensor::Response res = {
-        .timestamp = std::get<int64_t>(data["timestamp"]),
-        .accuracy = std::get<ohos::sensor::SensorAccuracy>(data["accuracy"]),
-    };
-    AccelerometerUncalibratedResponse responseData = {
-        .base = res,
-        .x = std::get<double>(data["x"]),
-        .y = std::get<double>(data["y"]),
-        .z = std::get<double>(data["z"]),
-        .biasX = std::get<double>(data["biasX"]),
-        .biasY = std::get<double>(data["biasY"]),
-        .biasZ = std::get<double>(data["biasZ"]),
-    };
-    auto &func = std::get<taihe::callback<void(AccelerometerUncalibratedResponse const &)>>(callbackObject->callback);
-    func(responseData);
-}
-
-void CallBackColor(std::map<std::string, responseSensorData> data, sptr<CallbackObject> callbackObject)
-{
-    if (callbackObject == nullptr) {
-        SEN_HILOGE("callbackObject is null");
-        return;
-    }
-    if (!std::holds_alternative<taihe::callback<void(ColorResponse const &)>>(callbackObject->callback)) {
-        SEN_HILOGE("callbackObject is not of type callback colorResponse function");
-        return;
-    }
-    ohos::sensor::Response res = {
-        .timestamp = std::get<int64_t>(data["timestamp"]),
-        .accuracy = std::get<ohos::sensor::SensorAccuracy>(data["accuracy"]),
-    };
-    ColorResponse responseData = {
-        .base = res,
-        .lightIntensity = std::get<double>(data["lightIntensity"]),
-        .colorTemperature = std::get<double>(data["colorTemperature"]),
-    };
-    auto &func = std::get<taihe::callback<void(ColorResponse const &)>>(callbackObject->callback);
-    func(responseData);
-}
-
-void CallBackFusionPressure(std::map<std::string, responseSensorData> data, sptr<CallbackObject> callbackObject)
-{
-    if (callbackObject == nullptr) {
-        SEN_HILOGE("callbackObject is null");
-        return;
-    }
-    if (!std::holds_alternative<taihe::callback<void(FusionPressureResponse const &)>>(callbackObject->callback)) {
-        SEN_HILOGE("callbackObject is not of type callback FusionPressureResponse function");
-        return;
-    }
-    ohos::sensor::Response res = {
-        .timestamp = std::get<int64_t>(data["timestamp"]),
-        .accuracy = std::get<ohos::sensor::SensorAccuracy>(data["accuracy"]),
-    };
-    FusionPressureResponse responseData = {
-        .base = res,
-        .fusionPressure = std::get<double>(data["fusionPressure"]),
-    };
-    auto &func = std::get<taihe::callback<void(FusionPressureResponse const &)>>(callbackObject->callback);
-    func(responseData);
-}
-
-void CallBackSar(std::map<std::string, responseSensorData> data, sptr<CallbackObject> callbackObject)
-{
-    if (callbackObject == nullptr) {
-        SEN_HILOGE("callbackObject is null");
-        return;
-    }
-    if (!std::holds_alternative<taihe::callback<void(SarResponse const &)>>(callbackObject->callback)) {
-        SEN_HILOGE("callbackObject is not of type callback sarResponse function");
-        return;
-    }
-    ohos::sensor::Response res = {
-        .timestamp = std::get<int64_t>(data["timestamp"]),
-        .accuracy = std::get<ohos::sensor::SensorAccuracy>(data["accuracy"]),
-    };
-    SarResponse responseData = {
-        .base = res,
-        .absorptionRatio = std::get<double>(data["absorptionRatio"]),
-    };
-    auto &func = std::get<taihe::callback<void(SarResponse const &)>>(callbackObject->callback);
-    func(responseData);
-}
+    InvokeResponseCallback(responseData, callbackObject);
+}
+
+template<typename ResponseType, double ResponseType::*... Fields>
+constexpr SensorCallbackConverter MakeConverter(int32_t sensorTypeId)
+{
+    return { sensorTypeId, sizeof...(Fields), CallBackResponse<ResponseType, Fields...> };
+}
+
+template<typename ResponseType>
+constexpr SensorCallbackConverter MakeAxisConverter(int32_t sensorTypeId)
+{
+    return MakeConverter<ResponseType, &ResponseType::x, &ResponseType::y, &ResponseType::z>(sensorTypeId);
+}
+
+template<typename ResponseType>
+constexpr SensorCallbackConverter MakeUncalibratedConverter(int32_t sensorTypeId)
+{
+    return MakeConverter<ResponseType, &ResponseType::x, &ResponseType::y, &ResponseType::z, &ResponseType::biasX,
+        &ResponseType::biasY, &ResponseType::biasZ>(sensorTypeId);
+}
+
+constexpr SensorCallbackConverter SENSOR_CALLBACK_CONVERTERS[] = {
+    MakeAxisConverter<AccelerometerResponse>(SENSOR_TYPE_ID_ACCELEROMETER),
+    MakeAxisConverter<GyroscopeResponse>(SENSOR_TYPE_ID_GYROSCOPE),
+    { SENSOR_TYPE_ID_AMBIENT_LIGHT, 3, CallBackAmbientLight },
+    MakeAxisConverter<MagneticFieldResponse>(SENSOR_TYPE_ID_MAGNETIC_FIELD),
+    MakeConverter<BarometerResponse, &BarometerResponse::pressure>(SENSOR_TYPE_ID_BAROMETER),
+    MakeConverter<HallResponse, &HallResponse::status>(SENSOR_TYPE_ID_HALL),
+    MakeConverter<ProximityResponse, &ProximityResponse::distance>(SENSOR_TYPE_ID_PROXIMITY),
+    MakeConverter<HumidityResponse, &HumidityResponse::humidity>(SENSOR_TYPE_ID_HUMIDITY),
+    MakeConverter<OrientationResponse, &OrientationResponse::alpha, &OrientationResponse::beta,
+        &OrientationResponse::gamma>(SENSOR_TYPE_ID_ORIENTATION),
+    MakeAxisConverter<GravityResponse>(SENSOR_TYPE_ID_GRAVITY),
+    MakeAxisConverter<LinearAccelerometerResponse>(SENSOR_TYPE_ID_LINEAR_ACCELERATION),
+    MakeConverter<RotationVectorResponse, &RotationVectorResponse::x, &RotationVectorResponse::y,
+        &RotationVectorResponse::z, &RotationVectorResponse::w>(SENSOR_TYPE_ID_ROTATION_VECTOR),
+    MakeConverter<AmbientTemperatureResponse, &AmbientTemperatureResponse::temperature>(
+        SENSOR_TYPE_ID_AMBIENT_TEMPERATURE),
+    MakeUncalibratedConverter<MagneticFieldUncalibratedResponse>(SENSOR_TYPE_ID_MAGNETIC_FIELD_UNCALIBRATED),
+    MakeUncalibratedConverter<GyroscopeUncalibratedResponse>(SENSOR_TYPE_ID_GYROSCOPE_UNCALIBRATED),
+    MakeConverter<SignificantMotionResponse, &SignificantMotionResponse::scalar>(SENSOR_TYPE_ID_SIGNIFICANT_MOTION),
+    MakeConverter<PedometerDetectionResponse, &PedometerDetectionResponse::scalar>(
+        SENSOR_TYPE_ID_PEDOMETER_DETECTION),
+    MakeConverter<PedometerResponse, &PedometerResponse::steps>(SENSOR_TYPE_ID_PEDOMETER),
+    MakeConverter<HeartRateResponse, &HeartRateResponse::heartRate>(SENSOR_TYPE_ID_HEART_RATE),
+    MakeConverter<WearDetectionResponse, &WearDetectionResponse::value>(SENSOR_TYPE_ID_WEAR_DETECTION),
+    MakeUncalibratedConverter<AccelerometerUncalibratedResponse>(SENSOR_TYPE_ID_ACCELEROMETER_UNCALIBRATED),
+    MakeConverter<ColorResponse, &ColorResponse::lightIntensity, &ColorResponse::colorTemperature>(
+        SENSOR_TYPE_ID_COLOR),
+    MakeConverter<SarResponse, &SarResponse::absorptionRatio>(SENSOR_TYPE_ID_SAR),
+    MakeConverter<FusionPressureResponse, &FusionPressureResponse::fusionPressure>(SENSOR_TYPE_ID_FUSION_PRESSURE),
+};
 
-void CallbackDataBySensorTypeId(int32_t sensorTypeId, std::map<std::string, responseSensorData> data,
-    sptr<CallbackObject> callbackObject)
+const SensorCallbackConverter *GetSensorCallbackConverter(int32_t sensorTypeId)
 {
-    if (g_functionBySensorTypeIdMap.find(sensorTypeId) == g_functionBySensorTypeIdMap.end()) {
-        SEN_HILOGE("SensorTypeId not exist, id:%{public}d", sensorTypeId);
-        return;
+    for (const auto &converter : SENSOR_CALLBACK_CONVERTERS) {
+        if (converter.sensorTypeId == sensorTypeId) {
+            return &converter;
+        }
     }
-    g_functionBySensorTypeIdMap[sensorTypeId](data, callbackObject);
+    return nullptr;
 }
 
-void CallbackSensorData(sptr<CallbackObject> callbackObject, SensorEvent *event)
+void CallbackSensorData(const sptr<CallbackObject> &callbackObject, SensorEvent *event)
 {
     if (event == nullptr) {
         SEN_HILOGE("event is null");
         return;
     }
-    int32_t sensorTypeId = event->sensorTypeId;
-    std::lock_guard<std::mutex> sensorTaiheAttrListLock(g_sensorTaiheAttrListMutex);
-    size_t size = g_sensorAttributeList[sensorTypeId].size();
+    const SensorCallbackConverter *converter = GetSensorCallbackConverter(event->sensorTypeId);
+    if (converter == nullptr) {
+        SEN_HILOGE("SensorTypeId not exist, id:%{public}d", event->sensorTypeId);
+        return;
+    }
     uint32_t dataLength = event->dataLen / sizeof(float);
-    if (size > dataLength) {
+    if (converter->valueCount > dataLength) {
         SEN_HILOGE("Data length mismatch");
         return;
     }
-    auto sensorAttributes = g_sensorAttributeList[sensorTypeId];
-    auto dataOrigin = reinterpret_cast<float *>(event->data);
-    float dataNow[CALLBACK_MAX_DATA_LENGTH] = { 0 };
-    if (memcpy_s(dataNow, sizeof(dataNow), dataOrigin, event->dataLen) != EOK) {
+    float values[CALLBACK_MAX_DATA_LENGTH] = { 0 };
+    if (memcpy_s(values, sizeof(values), event->data, converter->valueCount * sizeof(float)) != EOK) {
         SEN_HILOGE("Copy data failed");
         return;
     }
-    std::map<std::string, responseSensorData> dataMap;
-    for (size_t i = 0; i < size; ++i) {
-        dataMap.emplace(sensorAttributes[i].c_str(), static_cast<double>(dataNow[i]));
-    }
-    dataMap.emplace("timestamp", event->timestamp);
-    ohos::sensor::SensorAccuracy sensorAccuracyTemp(static_cast<ohos::sensor::SensorAccuracy::key_t>(event->option));
-    dataMap.emplace("accuracy", sensorAccuracyTemp);
-    CallbackDataBySensorTypeId(sensorTypeId, dataMap, callbackObject);
+    SensorCallbackData data = {
+        .values = values,
+        .base = {
+            .timestamp = event->timestamp,
+            .accuracy = ohos::sensor::SensorAccuracy(static_cast<ohos::sensor::SensorAccuracy::key_t>(event->option)),
+        },
+    };
+    converter->callback(data, callbackObject);
 }
 
 void EmitOnCallback(SensorEvent *event)
@@ -1080,8 +533,11 @@ void EmitOnCallback(SensorEvent *event)
         return;
     }
     std::lock_guard<std::mutex> onCallbackLock(g_onMutex);
-    auto onCallbackInfos = g_onCallbackInfos[sensorTypeId];
-    for (auto &onCallbackInfo : onCallbackInfos) {
+    auto iter = g_onCallbackInfos.find(sensorTypeId);
+    if (iter == g_onCallbackInfos.end()) {
+        return;
+    }
+    for (const auto &onCallbackInfo : iter->second) {
         CallbackSensorData(onCallbackInfo, event);
     }
 }
@@ -1104,8 +560,11 @@ void EmitSubscribeCallback(SensorEvent *event)
         return;
     }
     std::lock_guard<std::mutex> subscribeLock(g_mutex);
-    auto callbacks = g_subscribeCallbacks[sensorTypeId];
-    for (auto &callback : callbacks) {
+    auto iter = g_subscribeCallbacks.find(sensorTypeId);
+    if (iter == g_subscribeCallbacks.end()) {
+        return;
+    }
+    for (const auto &callback : iter->second) {
         CallbackSensorData(callback, event);
     }
 }
@@ -1135,14 +594,16 @@ void PlugDataCallbackImpl(::SensorStatusEvent *plugEvent)
         SEN_HILOGD("PlugDataCallbackImpl: no sensor status change callback subscribed");
         return;
     }
-    std::map<std::string, responseSensorData> dataMap;
-    dataMap.emplace("timestamp", plugEvent->timestamp);
-    dataMap.emplace("sensorId", plugEvent->sensorId);
-    dataMap.emplace("isSensorOnline", static_cast<bool>(plugEvent->isSensorOnline != 0));
-    dataMap.emplace("deviceId", plugEvent->deviceId);
-    dataMap.emplace("deviceName", std::string(plugEvent->deviceName));
+    ohos::sensor::SensorStatusEvent responseData = {
+        .timestamp = plugEvent->timestamp,
+        .sensorId = plugEvent->sensorId,
+        .sensorIndex = 0,
+        .isSensorOnline = (plugEvent->isSensorOnline != 0),
+        .deviceId = plugEvent->deviceId,
+        .deviceName = plugEvent->deviceName,
+    };
     for (const auto &callbackObj : g_statusChangeCallbackInfos) {
-        CallBackSensorStatusChange(dataMap, callbackObj);
+        CallBackSensorStatusChange(responseData, callbackObj);
     }
 }
 
@@ -1803,7 +1264,8 @@ void OffFusionPressure(optional_view<SensorInfoParam> sensorInfoParam, optional_
 }
 
 
-void CallBackSensorStatusChange(std::map<std::string, responseSensorData> data, sptr<CallbackObject> callbackObject)
+void CallBackSensorStatusChange(const ohos::sensor::SensorStatusEvent &responseData,
+    const sptr<CallbackObject> &callbackObject)
 {
     if (callbackObject == nullptr) {
         SEN_HILOGE("callbackObject is null");
@@ -1814,20 +1276,6 @@ void CallBackSensorStatusChange(std::map<std::string, responseSensorData> data,
         SEN_HILOGE("callbackObject is not of type callback SensorStatusEvent function");
         return;
     }
-    if (!data.count("timestamp") || !data.count("sensorId") || !data.count("deviceId") ||
-        !data.count("isSensorOnline")) {
-        SEN_HILOGE("SensorStatusChange data missing core field!");
-        return;
-    }
-    ohos::sensor::SensorStatusEvent responseData = {
-        .timestamp = std::get<int64_t>(data["timestamp"]),
-        .sensorId = std::get<int32_t>(data["sensorId"]),
-        .sensorIndex = std::get<int32_t>(data["sensorIndex"]),
-        .isSensorOnline = std::get<bool>(data["isSensorOnline"]),
-        .deviceId = std::get<int32_t>(data["deviceId"]),
-        .deviceName = std::get<string>(data["deviceName"]),
-    };
-
     auto &func = std::get<taihe::callback<void(ohos::sensor::SensorStatusEvent const &)>>(callbackObject->callback);
     func(responseData);
 }
@@ -14,6 +14,7 @@
  */
 #ifndef ASYNC_CALLBACK_INFO_H
 #define ASYNC_CALLBACK_INFO_H
+#include <atomic>
 #include <uv.h>
 
 #include "napi/native_api.h"
@@ -35,6 +36,8 @@ using namespace OHOS::HiviewDFX;
 constexpr int32_t THREE_DIMENSIONAL_MATRIX_LENGTH = 9;
 constexpr static int32_t DATA_LENGTH = 16;
 constexpr int32_t CALLBACK_NUM = 3;
+constexpr uint32_t DEFAULT_QUEUE_CAPACITY = 8;
+constexpr uint32_t MAX_QUEUE_CAPACITY = 64;
 enum CallbackDataType {
     SUBSCRIBE_FAIL = -2,
     FAIL = -1,
@@ -58,6 +61,24 @@ enum CallbackDataType {
     SENSOR_STATE_CHANGE = 17,
 };
 
+enum SensorDataFormat {
+    DATA_FORMAT_OBJECT = 0,
+    DATA_FORMAT_FLOAT32_ARRAY = 1,
+};
+
+enum SensorOverflowPolicy {
+    OVERFLOW_POLICY_CONFLATE = 0,
+    OVERFLOW_POLICY_DROP_OLDEST = 1,
+    OVERFLOW_POLICY_DROP_NEWEST = 2,
+};
+
+struct SensorDeliveryOptions {
+    SensorDataFormat dataFormat = DATA_FORMAT_OBJECT;
+    SensorOverflowPolicy overflowPolicy = OVERFLOW_POLICY_CONFLATE;
+    uint32_t queueCapacity = 1;
+    bool reportDrops = false;
+};
+
 struct GeomagneticData {
     float x;
     float y;
@@ -110,6 +131,10 @@ public:
     CallbackData data;
     BusinessError error;
     CallbackDataType type;
+    SensorDeliveryOptions deliveryOptions;
+    std::atomic<uint64_t> droppedCount { 0 };
+    /** Set once the callback is unsubscribed, samples still queued for it are then discarded */
+    std::atomic<bool> isRemoved { false };
     vector<SensorInfo> sensorInfos;
     SensorStatusEvent sensorStatusEvent;
     AsyncCallbackInfo(napi_env env, CallbackDataType type) : env(env), type(type) {}
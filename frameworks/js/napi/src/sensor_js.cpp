@@ -58,6 +58,11 @@ static std::map<std::string, int64_t> g_samplingPeriod = {
     {"ui", 60000000},
     {"game", 20000000},
 };
+static std::map<std::string, SensorOverflowPolicy> g_overflowPolicy = {
+    {"conflate", OVERFLOW_POLICY_CONFLATE},
+    {"dropOldest", OVERFLOW_POLICY_DROP_OLDEST},
+    {"dropNewest", OVERFLOW_POLICY_DROP_NEWEST},
+};
 static std::mutex g_mutex;
 static std::mutex g_bodyMutex;
 static float g_bodyState = -1.0f;
@@ -110,49 +115,39 @@ static bool CheckSystemSubscribe(SensorDescription sensorDesc)
     return iter != g_subscribeCallbacks.end();
 }
 
-static void EmitSubscribeCallback(SensorEvent *event)
+static void EmitSubscribeCallback(SensorEvent *event, std::shared_ptr<CallbackSensorData> cb)
 {
     CHKPV(event);
-    if (!CheckSystemSubscribe({event->deviceId, event->sensorTypeId, event->sensorId, event->location})) {
-        return;
-    }
     std::lock_guard<std::mutex> subscribeLock(g_mutex);
-    std::shared_ptr<CallbackSensorData> cb = std::make_shared<CallbackSensorData>();
-    if (!CopySensorData(event, cb)) {
-        SEN_HILOGE("Copy sensor data failed");
+    auto iter = g_subscribeCallbacks.find({event->deviceId, event->sensorTypeId, event->sensorId, event->location});
+    if (iter == g_subscribeCallbacks.end()) {
         return;
     }
-    auto data = reinterpret_cast<float *>(event->data);
-    auto callbacks = g_subscribeCallbacks[{event->deviceId, event->sensorTypeId, event->sensorId, event->location}];
-    for (auto &callback : callbacks) {
-        if (event->sensorTypeId == SENSOR_TYPE_ID_WEAR_DETECTION && callback->type == SUBSCRIBE_CALLBACK) {
-            std::lock_guard<std::mutex> onBodyLock(g_bodyMutex);
-            g_bodyState = *data;
-            cb->data[0] = (fabs(g_bodyState - BODY_STATE_EXCEPT) < THRESHOLD) ? true : false;
-        }
-        EmitUvEventLoop(callback, cb);
+    if (event->sensorTypeId == SENSOR_TYPE_ID_WEAR_DETECTION) {
+        cb = std::make_shared<CallbackSensorData>(*cb);
+        std::lock_guard<std::mutex> onBodyLock(g_bodyMutex);
+        g_bodyState = *reinterpret_cast<float *>(event->data);
+        cb->data[0] = (fabs(g_bodyState - BODY_STATE_EXCEPT) < THRESHOLD) ? true : false;
+    }
+    for (const auto &callback : iter->second) {
+        EnqueueSensorEvent(callback, cb);
     }
 }
 
-static void EmitOnCallback(SensorEvent *event)
+static void EmitOnCallback(SensorEvent *event, std::shared_ptr<CallbackSensorData> cb)
 {
     CHKPV(event);
-    if (!CheckSubscribe({event->deviceId, event->sensorTypeId, event->sensorId, event->location})) {
-        return;
-    }
     std::lock_guard<std::mutex> onCallbackLock(g_onMutex);
-    std::shared_ptr<CallbackSensorData> cb = std::make_shared<CallbackSensorData>();
-    if (!CopySensorData(event, cb)) {
-        SEN_HILOGE("Copy sensor data failed");
+    auto iter = g_onCallbackInfos.find({event->deviceId, event->sensorTypeId, event->sensorId, event->location});
+    if (iter == g_onCallbackInfos.end()) {
         return;
     }
-    auto onCallbackInfos = g_onCallbackInfos[{event->deviceId, event->sensorTypeId, event->sensorId, event->location}];
-    for (auto &onCallbackInfo : onCallbackInfos) {
-        EmitUvEventLoop(onCallbackInfo, cb);
+    for (const auto &onCallbackInfo : iter->second) {
+        EnqueueSensorEvent(onCallbackInfo, cb);
     }
 }
 
-static void EmitOnceCallback(SensorEvent *event)
+static void EmitOnceCallback(SensorEvent *event, std::shared_ptr<CallbackSensorData> cb)
 {
     CHKPV(event);
     std::lock_guard<std::mutex> onceCallbackLock(g_onceMutex);
@@ -160,19 +155,10 @@ static void EmitOnceCallback(SensorEvent *event)
     if (iter == g_onceCallbackInfos.end()) {
         return;
     }
-    std::shared_ptr<CallbackSensorData> cb = std::make_shared<CallbackSensorData>();
-    if (!CopySensorData(event, cb)) {
-        SEN_HILOGE("Copy sensor data failed");
-        return;
-    }
-    auto &onceCallbackInfos = iter->second;
-    while (!onceCallbackInfos.empty()) {
-        auto onceCallbackInfo = onceCallbackInfos.front();
-        auto beginIter = onceCallbackInfos.begin();
-        onceCallbackInfos.erase(beginIter);
-        EmitUvEventLoop(std::move(onceCallbackInfo), cb);
+    for (const auto &onceCallbackInfo : iter->second) {
+        EnqueueSensorEvent(onceCallbackInfo, cb);
     }
-    g_onceCallbackInfos.erase({event->deviceId, event->sensorTypeId, event->sensorId, event->location});
+    g_onceCallbackInfos.erase(iter);
 
     CHKCV((!CheckSubscribe({event->deviceId, event->sensorTypeId, event->sensorId, event->location})),
         "Has client subscribe, not need cancel subscribe");
@@ -184,9 +170,14 @@ static void EmitOnceCallback(SensorEvent *event)
 void DataCallbackImpl(SensorEvent *event)
 {
     CHKPV(event);
-    EmitOnCallback(event);
-    EmitSubscribeCallback(event);
-    EmitOnceCallback(event);
+    std::shared_ptr<CallbackSensorData> cb = std::make_shared<CallbackSensorData>();
+    if (!CopySensorData(event, cb)) {
+        SEN_HILOGE("Copy sensor data failed");
+        return;
+    }
+    EmitOnCallback(event, cb);
+    EmitSubscribeCallback(event, cb);
+    EmitOnceCallback(event, cb);
 }
 
 static void UpdatePlugInfo(SensorStatusEvent *plugEvent, sptr<AsyncCallbackInfo> &asyncCallbackInfo)
@@ -284,6 +275,8 @@ void CleanUp(void *data)
     CleanOnCallbackInfo(env);
     CleanOnceCallbackInfo(env);
     CleanSubscribeCallbackInfo(env);
+    CleanSensorEventQueue(env);
+    CleanSensorPropertyKeys(env);
     delete reinterpret_cast<napi_env*>(data);
     data = nullptr;
 }
@@ -441,13 +434,15 @@ static bool IsSubscribed(napi_env env, SensorDescription sensorDesc, napi_value
     return false;
 }
 
-static void UpdateCallbackInfos(napi_env env, SensorDescription sensorDesc, napi_value callback)
+static void UpdateCallbackInfos(napi_env env, SensorDescription sensorDesc, napi_value callback,
+    const SensorDeliveryOptions &deliveryOptions)
 {
     CALL_LOG_ENTER;
     std::lock_guard<std::mutex> onCallbackLock(g_onMutex);
     CHKCV((!IsSubscribed(env, sensorDesc, callback)), "The callback has been subscribed");
     sptr<AsyncCallbackInfo> asyncCallbackInfo = new (std::nothrow) AsyncCallbackInfo(env, ON_CALLBACK);
     CHKPV(asyncCallbackInfo);
+    asyncCallbackInfo->deliveryOptions = deliveryOptions;
     napi_status status = napi_create_reference(env, callback, 1, &asyncCallbackInfo->callback[0]);
     if (status != napi_ok) {
         ThrowErr(env, PARAMETER_ERROR, "napi_create_reference fail");
@@ -486,6 +481,75 @@ static bool GetInterval(napi_env env, napi_value value, int64_t &interval)
     return true;
 }
 
+static SensorDataFormat GetDataFormat(napi_env env, napi_value value)
+{
+    napi_value napiDataFormat = GetNamedProperty(env, value, "dataFormat");
+    if (!IsMatchType(env, napiDataFormat, napi_string)) {
+        return DATA_FORMAT_OBJECT;
+    }
+    std::string dataFormat;
+    if (!GetStringValue(env, napiDataFormat, dataFormat)) {
+        SEN_HILOGW("GetStringValue failed");
+        return DATA_FORMAT_OBJECT;
+    }
+    return (dataFormat == "float32Array") ? DATA_FORMAT_FLOAT32_ARRAY : DATA_FORMAT_OBJECT;
+}
+
+static bool GetOverflowPolicy(napi_env env, napi_value value, SensorOverflowPolicy &overflowPolicy)
+{
+    napi_value napiOverflowPolicy = GetNamedProperty(env, value, "overflowPolicy");
+    if (!IsMatchType(env, napiOverflowPolicy, napi_string)) {
+        return false;
+    }
+    std::string policy;
+    if (!GetStringValue(env, napiOverflowPolicy, policy)) {
+        SEN_HILOGW("GetStringValue failed");
+        return false;
+    }
+    auto iter = g_overflowPolicy.find(policy);
+    if (iter == g_overflowPolicy.end()) {
+        SEN_HILOGW("Invalid overflowPolicy:%{public}s", policy.c_str());
+        return false;
+    }
+    overflowPolicy = iter->second;
+    return true;
+}
+
+static SensorDeliveryOptions GetDeliveryOptions(napi_env env, size_t argc, napi_value value)
+{
+    SensorDeliveryOptions deliveryOptions;
+    if (argc < ARGC_NUM_THREE || !IsMatchType(env, value, napi_object)) {
+        return deliveryOptions;
+    }
+    deliveryOptions.dataFormat = GetDataFormat(env, value);
+    bool hasOverflowPolicy = GetOverflowPolicy(env, value, deliveryOptions.overflowPolicy);
+    if (hasOverflowPolicy) {
+        deliveryOptions.reportDrops = true;
+        deliveryOptions.queueCapacity =
+            (deliveryOptions.overflowPolicy == OVERFLOW_POLICY_CONFLATE) ? 1 : DEFAULT_QUEUE_CAPACITY;
+    }
+    napi_value napiQueueCapacity = GetNamedProperty(env, value, "queueCapacity");
+    int32_t queueCapacity = 0;
+    if (!IsMatchType(env, napiQueueCapacity, napi_number) || !GetNativeInt32(env, napiQueueCapacity, queueCapacity)) {
+        return deliveryOptions;
+    }
+    // A capacity without a policy asks for a queue, which keeps the newest samples
+    if (!hasOverflowPolicy) {
+        deliveryOptions.overflowPolicy = OVERFLOW_POLICY_DROP_OLDEST;
+        deliveryOptions.reportDrops = true;
+        deliveryOptions.queueCapacity = DEFAULT_QUEUE_CAPACITY;
+    }
+    if (queueCapacity <= 0) {
+        SEN_HILOGW("Invalid queueCapacity:%{public}d, use %{public}u", queueCapacity, deliveryOptions.queueCapacity);
+        return deliveryOptions;
+    }
+    deliveryOptions.queueCapacity = std::min(static_cast<uint32_t>(queueCapacity), MAX_QUEUE_CAPACITY);
+    if (deliveryOptions.queueCapacity != static_cast<uint32_t>(queueCapacity)) {
+        SEN_HILOGW("queueCapacity:%{public}d is clamped to %{public}u", queueCapacity, deliveryOptions.queueCapacity);
+    }
+    return deliveryOptions;
+}
+
 static bool IsPlugSubscribed(napi_env env, napi_value callback)
 {
     CALL_LOG_ENTER;
@@ -638,7 +702,7 @@ static napi_value On(napi_env env, napi_callback_info info)
         return nullptr;
     }
     ReportJsStackToXpower(env, sensorDesc.sensorType);
-    UpdateCallbackInfos(env, sensorDesc, args[1]);
+    UpdateCallbackInfos(env, sensorDesc, args[1], GetDeliveryOptions(env, argc, args[ARGS_NUM_TWO]));
     return nullptr;
 }
 
@@ -733,6 +797,7 @@ static int32_t RemoveAllCallback(napi_env env, SensorDescription sensorDesc)
             ++iter;
             continue;
         }
+        (*iter)->isRemoved = true;
         iter = callbackInfos.erase(iter);
     }
     if (callbackInfos.empty()) {
@@ -760,6 +825,7 @@ static int32_t RemoveCallback(napi_env env, SensorDescription sensorDesc, napi_v
             continue;
         }
         if (IsSameValue(env, callback, sensorCallback)) {
+            (*iter)->isRemoved = true;
             iter = callbackInfos.erase(iter);
             SEN_HILOGD("Remove callback success");
             break;
@@ -1765,6 +1831,7 @@ static bool RemoveSubscribeCallback(napi_env env, SensorDescription sensorDesc)
             ++iter;
             continue;
         }
+        (*iter)->isRemoved = true;
         iter = callbackInfos.erase(iter);
     }
     if (callbackInfos.empty()) {
@@ -15,13 +15,19 @@
 
 #include "sensor_napi_utils.h"
 
+#include <algorithm>
+#include <cinttypes>
+#include <deque>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
 #include "bundle_mgr_proxy.h"
 #include "ipc_skeleton.h"
 #include "iservice_registry.h"
+#include "securec.h"
 #include "system_ability_definition.h"
 
 #include "sensor_napi_error.h"
@@ -31,8 +37,193 @@ namespace Sensors {
 namespace {
 constexpr int32_t STRING_LENGTH_MAX = 64;
 constexpr size_t RESULT_SIZE = 2;
+constexpr uint32_t MAX_ATTRIBUTE_COUNT = 6;
+constexpr uint32_t MAX_PROPERTY_COUNT = MAX_ATTRIBUTE_COUNT + 3;
+constexpr napi_property_attributes SENSOR_PROPERTY_ATTRIBUTES =
+    static_cast<napi_property_attributes>(napi_writable | napi_enumerable | napi_configurable);
+constexpr uint64_t DROP_LOG_INTERVAL = 1000;
+
+enum SensorPropertyKey : uint8_t {
+    KEY_X = 0,
+    KEY_Y,
+    KEY_Z,
+    KEY_W,
+    KEY_BIAS_X,
+    KEY_BIAS_Y,
+    KEY_BIAS_Z,
+    KEY_INTENSITY,
+    KEY_COLOR_TEMPERATURE,
+    KEY_INFRARED_LUMINANCE,
+    KEY_PRESSURE,
+    KEY_STATUS,
+    KEY_TEMPERATURE,
+    KEY_DISTANCE,
+    KEY_HUMIDITY,
+    KEY_ALPHA,
+    KEY_BETA,
+    KEY_GAMMA,
+    KEY_SCALAR,
+    KEY_STEPS,
+    KEY_HEART_RATE,
+    KEY_VALUE,
+    KEY_LIGHT_INTENSITY,
+    KEY_ABSORPTION_RATIO,
+    KEY_FUSION_PRESSURE,
+    KEY_TIMESTAMP,
+    KEY_ACCURACY,
+    KEY_DATA,
+    KEY_DROPPED_COUNT,
+    KEY_COUNT,
+};
+
+constexpr const char *SENSOR_PROPERTY_NAMES[KEY_COUNT] = {
+    "x", "y", "z", "w", "biasX", "biasY", "biasZ", "intensity", "colorTemperature", "infraredLuminance",
+    "pressure", "status", "temperature", "distance", "humidity", "alpha", "beta", "gamma", "scalar", "steps",
+    "heartRate", "value", "lightIntensity", "absorptionRatio", "fusionPressure", "timestamp", "accuracy", "data",
+    "droppedCount",
+};
+
+struct SensorAttributes {
+    int32_t sensorTypeId;
+    uint32_t count;
+    SensorPropertyKey keys[MAX_ATTRIBUTE_COUNT];
+};
+
+constexpr SensorAttributes SENSOR_ATTRIBUTE_LIST[] = {
+    { 0, 1, { KEY_X } },
+    { SENSOR_TYPE_ID_ACCELEROMETER, 3, { KEY_X, KEY_Y, KEY_Z } },
+    { SENSOR_TYPE_ID_GYROSCOPE, 3, { KEY_X, KEY_Y, KEY_Z } },
+    { SENSOR_TYPE_ID_AMBIENT_LIGHT, 3, { KEY_INTENSITY, KEY_COLOR_TEMPERATURE, KEY_INFRARED_LUMINANCE } },
+    { SENSOR_TYPE_ID_MAGNETIC_FIELD, 3, { KEY_X, KEY_Y, KEY_Z } },
+    { SENSOR_TYPE_ID_BAROMETER, 1, { KEY_PRESSURE } },
+    { SENSOR_TYPE_ID_HALL, 1, { KEY_STATUS } },
+    { SENSOR_TYPE_ID_TEMPERATURE, 1, { KEY_TEMPERATURE } },
+    { SENSOR_TYPE_ID_PROXIMITY, 1, { KEY_DISTANCE } },
+    { SENSOR_TYPE_ID_HUMIDITY, 1, { KEY_HUMIDITY } },
+    { SENSOR_TYPE_ID_ORIENTATION, 3, { KEY_ALPHA, KEY_BETA, KEY_GAMMA } },
+    { SENSOR_TYPE_ID_GRAVITY, 3, { KEY_X, KEY_Y, KEY_Z } },
+    { SENSOR_TYPE_ID_LINEAR_ACCELERATION, 3, { KEY_X, KEY_Y, KEY_Z } },
+    { SENSOR_TYPE_ID_ROTATION_VECTOR, 4, { KEY_X, KEY_Y, KEY_Z, KEY_W } },
+    { SENSOR_TYPE_ID_AMBIENT_TEMPERATURE, 1, { KEY_TEMPERATURE } },
+    { SENSOR_TYPE_ID_MAGNETIC_FIELD_UNCALIBRATED, 6, { KEY_X, KEY_Y, KEY_Z, KEY_BIAS_X, KEY_BIAS_Y, KEY_BIAS_Z } },
+    { SENSOR_TYPE_ID_GYROSCOPE_UNCALIBRATED, 6, { KEY_X, KEY_Y, KEY_Z, KEY_BIAS_X, KEY_BIAS_Y, KEY_BIAS_Z } },
+    { SENSOR_TYPE_ID_SIGNIFICANT_MOTION, 1, { KEY_SCALAR } },
+    { SENSOR_TYPE_ID_PEDOMETER_DETECTION, 1, { KEY_SCALAR } },
+    { SENSOR_TYPE_ID_PEDOMETER, 1, { KEY_STEPS } },
+    { SENSOR_TYPE_ID_HEART_RATE, 1, { KEY_HEART_RATE } },
+    { SENSOR_TYPE_ID_WEAR_DETECTION, 1, { KEY_VALUE } },
+    { SENSOR_TYPE_ID_ACCELEROMETER_UNCALIBRATED, 6, { KEY_X, KEY_Y, KEY_Z, KEY_BIAS_X, KEY_BIAS_Y, KEY_BIAS_Z } },
+    { SENSOR_TYPE_ID_COLOR, 2, { KEY_LIGHT_INTENSITY, KEY_COLOR_TEMPERATURE } },
+    { SENSOR_TYPE_ID_SAR, 1, { KEY_ABSORPTION_RATIO } },
+    { SENSOR_TYPE_ID_FUSION_PRESSURE, 1, { KEY_FUSION_PRESSURE } },
+};
+
+/*
+ * Property names are interned once per env and kept as references, so a sensor event does not have to
+ * create and hash the same strings again. The keys of a cache are only touched on the JS thread of its env,
+ * the map itself is shared by all envs and released per env by CleanSensorPropertyKeys.
+ */
+struct SensorPropertyKeyCache {
+    napi_ref keys[KEY_COUNT] = { nullptr };
+};
+std::mutex g_propertyKeyMutex;
+std::map<napi_env, std::shared_ptr<SensorPropertyKeyCache>> g_propertyKeyCaches;
+
+/*
+ * The properties of one sample in the fixed key order of its sensor type, applied to the new object by a single
+ * napi_define_properties call instead of one napi_set_property per field.
+ */
+struct SensorPropertyList {
+    napi_property_descriptor descriptors[MAX_PROPERTY_COUNT];
+    uint32_t count = 0;
+};
+
+/*
+ * Sensor samples are queued per env and delivered by a single task posted to the JS thread. Each callback owns a
+ * queue bounded by its queueCapacity; once it is full, the overflow policy of the subscription decides which sample
+ * is dropped, so a slow JS consumer costs a bounded amount of memory.
+ */
+struct PendingSensorEvent {
+    sptr<AsyncCallbackInfo> asyncCallbackInfo;
+    std::deque<std::shared_ptr<CallbackSensorData>> samples;
+};
+
+struct SensorEventQueue {
+    napi_env env = nullptr;
+    std::mutex mutex;
+    bool isPosted = false;
+    std::vector<PendingSensorEvent> pendingEvents;
+};
+std::mutex g_eventQueueMutex;
+std::map<napi_env, std::shared_ptr<SensorEventQueue>> g_eventQueues;
+
+const SensorAttributes *GetSensorAttributes(int32_t sensorTypeId)
+{
+    for (const auto &attributes : SENSOR_ATTRIBUTE_LIST) {
+        if (attributes.sensorTypeId == sensorTypeId) {
+            return &attributes;
+        }
+    }
+    return nullptr;
+}
+
+std::shared_ptr<SensorPropertyKeyCache> GetPropertyKeyCache(napi_env env)
+{
+    std::lock_guard<std::mutex> propertyKeyLock(g_propertyKeyMutex);
+    auto iter = g_propertyKeyCaches.find(env);
+    if (iter != g_propertyKeyCaches.end()) {
+        return iter->second;
+    }
+    auto keyCache = std::make_shared<SensorPropertyKeyCache>();
+    g_propertyKeyCaches.emplace(env, keyCache);
+    return keyCache;
+}
+
+bool GetPropertyKey(const napi_env &env, SensorPropertyKeyCache &keyCache, SensorPropertyKey key, napi_value &result)
+{
+    napi_ref &ref = keyCache.keys[key];
+    if (ref != nullptr) {
+        CHKNRF(env, napi_get_reference_value(env, ref, &result), "napi_get_reference_value");
+        return true;
+    }
+    CHKNRF(env, napi_create_string_utf8(env, SENSOR_PROPERTY_NAMES[key], NAPI_AUTO_LENGTH, &result),
+        "napi_create_string_utf8");
+    CHKNRF(env, napi_create_reference(env, result, 1, &ref), "napi_create_reference");
+    return true;
+}
+
+bool AddSensorProperty(const napi_env &env, SensorPropertyKeyCache &keyCache, SensorPropertyList &propertyList,
+    SensorPropertyKey key, napi_value value)
+{
+    CHKCF((propertyList.count < MAX_PROPERTY_COUNT), "Too many properties");
+    napi_value name = nullptr;
+    CHKCF(GetPropertyKey(env, keyCache, key, name), "GetPropertyKey failed");
+    propertyList.descriptors[propertyList.count++] = {
+        nullptr, name, nullptr, nullptr, nullptr, value, SENSOR_PROPERTY_ATTRIBUTES, nullptr
+    };
+    return true;
+}
+
+bool CreateSensorObject(const napi_env &env, const SensorPropertyList &propertyList, napi_value &result)
+{
+    CHKNRF(env, napi_create_object(env, &result), "napi_create_object");
+    CHKNRF(env, napi_define_properties(env, result, propertyList.count, propertyList.descriptors),
+        "napi_define_properties");
+    return true;
+}
+
+bool CreateFloat32ArrayData(const napi_env &env, const float *data, uint32_t count, napi_value &result)
+{
+    void *bufferData = nullptr;
+    napi_value buffer = nullptr;
+    size_t byteLength = count * sizeof(float);
+    CHKNRF(env, napi_create_arraybuffer(env, byteLength, &bufferData, &buffer), "napi_create_arraybuffer");
+    CHKPF(bufferData);
+    CHKCF((memcpy_s(bufferData, byteLength, data, byteLength) == EOK), "Copy data failed");
+    CHKNRF(env, napi_create_typedarray(env, napi_float32_array, count, buffer, 0, &result), "napi_create_typedarray");
+    return true;
+}
 } // namespace
-static std::mutex g_sensorAttrListMutex;
 bool IsSameValue(const napi_env &env, const napi_value &lhs, const napi_value &rhs)
 {
     CALL_LOG_ENTER;
@@ -163,35 +354,6 @@ bool CreateFailMessage(CallbackDataType type, int32_t code, string message,
     return true;
 }
 
-std::map<int32_t, vector<string>> g_sensorAttributeList = {
-    { 0, { "x" } },
-    { SENSOR_TYPE_ID_ACCELEROMETER, { "x", "y", "z" } },
-    { SENSOR_TYPE_ID_GYROSCOPE, { "x", "y", "z" } },
-    { SENSOR_TYPE_ID_AMBIENT_LIGHT, { "intensity", "colorTemperature", "infraredLuminance" } },
-    { SENSOR_TYPE_ID_MAGNETIC_FIELD, { "x", "y", "z" } },
-    { SENSOR_TYPE_ID_BAROMETER, { "pressure" } },
-    { SENSOR_TYPE_ID_HALL, { "status" } },
-    { SENSOR_TYPE_ID_TEMPERATURE, { "temperature" } },
-    { SENSOR_TYPE_ID_PROXIMITY, { "distance" } },
-    { SENSOR_TYPE_ID_HUMIDITY, { "humidity" } },
-    { SENSOR_TYPE_ID_ORIENTATION, { "alpha", "beta", "gamma" } },
-    { SENSOR_TYPE_ID_GRAVITY, { "x", "y", "z" } },
-    { SENSOR_TYPE_ID_LINEAR_ACCELERATION, { "x", "y", "z" } },
-    { SENSOR_TYPE_ID_ROTATION_VECTOR, { "x", "y", "z", "w" } },
-    { SENSOR_TYPE_ID_AMBIENT_TEMPERATURE, { "temperature" } },
-    { SENSOR_TYPE_ID_MAGNETIC_FIELD_UNCALIBRATED, { "x", "y", "z", "biasX", "biasY", "biasZ" } },
-    { SENSOR_TYPE_ID_GYROSCOPE_UNCALIBRATED, { "x", "y", "z", "biasX", "biasY", "biasZ" } },
-    { SENSOR_TYPE_ID_SIGNIFICANT_MOTION, { "scalar" } },
-    { SENSOR_TYPE_ID_PEDOMETER_DETECTION, { "scalar" } },
-    { SENSOR_TYPE_ID_PEDOMETER, { "steps" } },
-    { SENSOR_TYPE_ID_HEART_RATE, { "heartRate" } },
-    { SENSOR_TYPE_ID_WEAR_DETECTION, { "value" } },
-    { SENSOR_TYPE_ID_ACCELEROMETER_UNCALIBRATED, { "x", "y", "z", "biasX", "biasY", "biasZ" } },
-    { SENSOR_TYPE_ID_COLOR, { "lightIntensity", "colorTemperature" } },
-    { SENSOR_TYPE_ID_SAR, { "absorptionRatio" } },
-    { SENSOR_TYPE_ID_FUSION_PRESSURE, { "fusionPressure" } },
-};
-
 std::map<int32_t, ConvertDataFunc> g_convertfuncList = {
     {FAIL, ConvertToFailData},
     {GET_GEOMAGNETIC_FIELD, ConvertToGeomagneticData},
@@ -373,38 +535,45 @@ bool ConvertToSensorData(const napi_env &env, sptr<AsyncCallbackInfo> asyncCallb
     CHKPF(data);
     CHKCF(!(resultSize < RESULT_SIZE), "result size Invalid");
     int32_t sensorTypeId = data->sensorTypeId;
-    std::lock_guard<std::mutex> sensorAttrListLock(g_sensorAttrListMutex);
-    CHKNCF(env, (g_sensorAttributeList.find(sensorTypeId) != g_sensorAttributeList.end()), "Invalid sensor type");
+    const SensorAttributes *attributes = GetSensorAttributes(sensorTypeId);
+    CHKNCF(env, (attributes != nullptr), "Invalid sensor type");
+    auto keyCache = GetPropertyKeyCache(env);
+    CHKPF(keyCache);
+    SensorPropertyList propertyList;
+    napi_value message = nullptr;
     if (sensorTypeId == SENSOR_TYPE_ID_WEAR_DETECTION && asyncCallbackInfo->type == SUBSCRIBE_CALLBACK) {
-        CHKNRF(env, napi_create_object(env, &result[1]), "napi_create_object");
-        napi_value status = nullptr;
-        CHKNRF(env, napi_get_boolean(env, data->data[0], &status),
+        CHKNRF(env, napi_get_boolean(env, data->data[0], &message),
             "napi_get_boolean");
-        CHKNRF(env, napi_set_named_property(env, result[1], "value", status), "napi_set_named_property");
-        return true;
+        CHKCF(AddSensorProperty(env, *keyCache, propertyList, KEY_VALUE, message), "AddSensorProperty failed");
+        return CreateSensorObject(env, propertyList, result[1]);
     }
-    size_t size = g_sensorAttributeList[sensorTypeId].size();
     uint32_t dataLength = data->dataLength / sizeof(float);
-    CHKNCF(env, (size <= dataLength), "Data length mismatch");
+    CHKNCF(env, (attributes->count <= dataLength), "Data length mismatch");
 
-    CHKNRF(env, napi_create_object(env, &result[1]), "napi_create_object");
-    napi_value message = nullptr;
-    auto sensorAttributes = g_sensorAttributeList[sensorTypeId];
-    for (uint32_t i = 0; i < size; ++i) {
-        CHKNRF(env, napi_create_double(env, data->data[i], &message),
-            "napi_create_double");
-        CHKNRF(env, napi_set_named_property(env, result[1], sensorAttributes[i].c_str(), message),
-            "napi_set_named_property");
-        message = nullptr;
+    if (asyncCallbackInfo->deliveryOptions.dataFormat == DATA_FORMAT_FLOAT32_ARRAY) {
+        CHKCF(CreateFloat32ArrayData(env, data->data, attributes->count, message), "CreateFloat32ArrayData failed");
+        CHKCF(AddSensorProperty(env, *keyCache, propertyList, KEY_DATA, message), "AddSensorProperty failed");
+    } else {
+        for (uint32_t i = 0; i < attributes->count; ++i) {
+            CHKNRF(env, napi_create_double(env, data->data[i], &message),
+                "napi_create_double");
+            CHKCF(AddSensorProperty(env, *keyCache, propertyList, attributes->keys[i], message),
+                "AddSensorProperty failed");
+        }
     }
     CHKNRF(env, napi_create_int64(env, data->timestamp, &message),
         "napi_create_int64");
-    CHKNRF(env, napi_set_named_property(env, result[1], "timestamp", message), "napi_set_named_property");
-    message = nullptr;
+    CHKCF(AddSensorProperty(env, *keyCache, propertyList, KEY_TIMESTAMP, message), "AddSensorProperty failed");
     CHKNRF(env, napi_create_int32(env, data->sensorAccuracy, &message),
         "napi_create_int32");
-    CHKNRF(env, napi_set_named_property(env, result[1], "accuracy", message), "napi_set_named_property");
-    return true;
+    CHKCF(AddSensorProperty(env, *keyCache, propertyList, KEY_ACCURACY, message), "AddSensorProperty failed");
+    if (asyncCallbackInfo->deliveryOptions.reportDrops) {
+        CHKNRF(env, napi_create_int64(env, static_cast<int64_t>(asyncCallbackInfo->droppedCount.load()), &message),
+            "napi_create_int64");
+        CHKCF(AddSensorProperty(env, *keyCache, propertyList, KEY_DROPPED_COUNT, message),
+            "AddSensorProperty failed");
+    }
+    return CreateSensorObject(env, propertyList, result[1]);
 }
 
 bool ConvertToGeomagneticData(const napi_env &env, sptr<AsyncCallbackInfo> asyncCallbackInfo, napi_value result[2])
@@ -562,6 +731,56 @@ void DeleteWork(uv_work_t *work)
     work = nullptr;
 }
 
+static void InvokeUvCallback(sptr<AsyncCallbackInfo> asyncCallbackInfo, std::shared_ptr<CallbackSensorData> cb)
+{
+    CHKPV(asyncCallbackInfo);
+    napi_handle_scope scope = nullptr;
+    napi_open_handle_scope(asyncCallbackInfo->env, &scope);
+    if (scope == nullptr) {
+        SEN_HILOGE("napi_handle_scope is nullptr");
+        ReleaseCallback(asyncCallbackInfo);
+        return;
+    }
+    napi_env env = asyncCallbackInfo->env;
+    napi_value callback = nullptr;
+    if (napi_get_reference_value(env, asyncCallbackInfo->callback[0], &callback) != napi_ok) {
+        SEN_HILOGE("napi_get_reference_value fail");
+        napi_throw_error(env, nullptr, "napi_get_reference_value fail");
+        ReleaseCallback(asyncCallbackInfo);
+        napi_close_handle_scope(asyncCallbackInfo->env, scope);
+        return;
+    }
+    napi_value callResult = nullptr;
+    napi_value result[2] = {0};
+    if (asyncCallbackInfo->type == ON_CALLBACK || asyncCallbackInfo->type == ONCE_CALLBACK ||
+        asyncCallbackInfo->type == SUBSCRIBE_CALLBACK) {
+        if (!ConvertToSensorData(env, asyncCallbackInfo, result, sizeof(result) / sizeof(result[0]), cb)) {
+            SEN_HILOGE("ConvertToSensorData fail");
+            ReleaseCallback(asyncCallbackInfo);
+            napi_close_handle_scope(asyncCallbackInfo->env, scope);
+            return;
+        }
+    } else {
+        if (!(g_convertfuncList.find(asyncCallbackInfo->type) != g_convertfuncList.end())) {
+            SEN_HILOGE("asyncCallbackInfo type is invalid");
+            napi_throw_error(env, nullptr, "asyncCallbackInfo type is invalid");
+            ReleaseCallback(asyncCallbackInfo);
+            napi_close_handle_scope(asyncCallbackInfo->env, scope);
+            return;
+        }
+        g_convertfuncList[asyncCallbackInfo->type](env, asyncCallbackInfo, result);
+    }
+    if (napi_call_function(env, nullptr, callback, 1, &result[1], &callResult) != napi_ok) {
+        SEN_HILOGE("napi_call_function callback fail");
+        napi_throw_error(env, nullptr, "napi_call_function callback fail");
+        ReleaseCallback(asyncCallbackInfo);
+        napi_close_handle_scope(asyncCallbackInfo->env, scope);
+        return;
+    }
+    ReleaseCallback(asyncCallbackInfo);
+    napi_close_handle_scope(asyncCallbackInfo->env, scope);
+}
+
 void EmitUvEventLoop(sptr<AsyncCallbackInfo> asyncCallbackInfo, std::shared_ptr<CallbackSensorData> cb)
 {
     CHKPV(asyncCallbackInfo);
@@ -578,57 +797,184 @@ void EmitUvEventLoop(sptr<AsyncCallbackInfo> asyncCallbackInfo, std::shared_ptr<
          * count of the smart pointer is guaranteed to be 1.
          */
         asyncCallbackInfo->DecStrongRef(nullptr);
-        napi_handle_scope scope = nullptr;
-        napi_open_handle_scope(asyncCallbackInfo->env, &scope);
-        if (scope == nullptr) {
-            SEN_HILOGE("napi_handle_scope is nullptr");
-            ReleaseCallback(asyncCallbackInfo);
-            return;
-        }
-        napi_env env = asyncCallbackInfo->env;
-        napi_value callback = nullptr;
-        if (napi_get_reference_value(env, asyncCallbackInfo->callback[0], &callback) != napi_ok) {
-            SEN_HILOGE("napi_get_reference_value fail");
-            napi_throw_error(env, nullptr, "napi_get_reference_value fail");
-            ReleaseCallback(asyncCallbackInfo);
-            napi_close_handle_scope(asyncCallbackInfo->env, scope);
-            return;
-        }
-        napi_value callResult = nullptr;
-        napi_value result[2] = {0};
-        if (asyncCallbackInfo->type == ON_CALLBACK || asyncCallbackInfo->type == ONCE_CALLBACK ||
-            asyncCallbackInfo->type == SUBSCRIBE_CALLBACK) {
-            if (!ConvertToSensorData(env, asyncCallbackInfo, result, sizeof(result) / sizeof(result[0]), cb)) {
-                SEN_HILOGE("ConvertToSensorData fail");
-                ReleaseCallback(asyncCallbackInfo);
-                napi_close_handle_scope(asyncCallbackInfo->env, scope);
-                return;
-            }
-        } else {
-            if (!(g_convertfuncList.find(asyncCallbackInfo->type) != g_convertfuncList.end())) {
-                SEN_HILOGE("asyncCallbackInfo type is invalid");
-                napi_throw_error(env, nullptr, "asyncCallbackInfo type is invalid");
-                ReleaseCallback(asyncCallbackInfo);
-                napi_close_handle_scope(asyncCallbackInfo->env, scope);
-                return;
+        InvokeUvCallback(asyncCallbackInfo, cb);
+    };
+    auto ret = napi_send_event(asyncCallbackInfo->env, task, napi_eprio_immediate, "sensor EmitUvEventLoop");
+    if (ret != napi_ok) {
+        SEN_HILOGE("Failed to SendEvent, ret:%{public}d", ret);
+        asyncCallbackInfo->DecStrongRef(nullptr);
+        ReleaseCallback(asyncCallbackInfo);
+    }
+}
+
+static void ReleasePendingEvents(std::vector<PendingSensorEvent> &pendingEvents)
+{
+    for (auto &pendingEvent : pendingEvents) {
+        ReleaseCallback(pendingEvent.asyncCallbackInfo);
+    }
+    pendingEvents.clear();
+}
+
+static void PostSensorEventQueue(std::shared_ptr<SensorEventQueue> eventQueue);
+
+static void DrainSensorEventQueue(std::shared_ptr<SensorEventQueue> eventQueue)
+{
+    CHKPV(eventQueue);
+    std::vector<PendingSensorEvent> pendingEvents;
+    {
+        std::lock_guard<std::mutex> queueLock(eventQueue->mutex);
+        pendingEvents.swap(eventQueue->pendingEvents);
+    }
+    for (auto &pendingEvent : pendingEvents) {
+        CHKPC(pendingEvent.asyncCallbackInfo);
+        for (auto &sample : pendingEvent.samples) {
+            // off() may run in an earlier callback of this batch, its samples must not be delivered after it
+            if (pendingEvent.asyncCallbackInfo->isRemoved.load()) {
+                SEN_HILOGD("Callback is removed, discard queued samples");
+                break;
             }
-            g_convertfuncList[asyncCallbackInfo->type](env, asyncCallbackInfo, result);
+            InvokeUvCallback(pendingEvent.asyncCallbackInfo, sample);
         }
-        if (napi_call_function(env, nullptr, callback, 1, &result[1], &callResult) != napi_ok) {
-            SEN_HILOGE("napi_call_function callback fail");
-            napi_throw_error(env, nullptr, "napi_call_function callback fail");
-            ReleaseCallback(asyncCallbackInfo);
-            napi_close_handle_scope(asyncCallbackInfo->env, scope);
+    }
+    {
+        std::lock_guard<std::mutex> queueLock(eventQueue->mutex);
+        if (eventQueue->pendingEvents.empty()) {
+            eventQueue->isPosted = false;
             return;
         }
-        ReleaseCallback(asyncCallbackInfo);
-        napi_close_handle_scope(asyncCallbackInfo->env, scope);
+    }
+    PostSensorEventQueue(eventQueue);
+}
+
+static void PostSensorEventQueue(std::shared_ptr<SensorEventQueue> eventQueue)
+{
+    CHKPV(eventQueue);
+    auto task = [eventQueue]() {
+        DrainSensorEventQueue(eventQueue);
     };
-    auto ret = napi_send_event(asyncCallbackInfo->env, task, napi_eprio_immediate, "sensor EmitUvEventLoop");
+    auto ret = napi_send_event(eventQueue->env, task, napi_eprio_immediate, "sensor DrainSensorEventQueue");
     if (ret != napi_ok) {
         SEN_HILOGE("Failed to SendEvent, ret:%{public}d", ret);
-        asyncCallbackInfo->DecStrongRef(nullptr);
-        ReleaseCallback(asyncCallbackInfo);
+        std::vector<PendingSensorEvent> pendingEvents;
+        {
+            std::lock_guard<std::mutex> queueLock(eventQueue->mutex);
+            pendingEvents.swap(eventQueue->pendingEvents);
+            eventQueue->isPosted = false;
+        }
+        ReleasePendingEvents(pendingEvents);
+    }
+}
+
+static std::shared_ptr<SensorEventQueue> GetSensorEventQueue(napi_env env)
+{
+    std::lock_guard<std::mutex> eventQueueLock(g_eventQueueMutex);
+    auto iter = g_eventQueues.find(env);
+    if (iter != g_eventQueues.end()) {
+        return iter->second;
+    }
+    auto eventQueue = std::make_shared<SensorEventQueue>();
+    eventQueue->env = env;
+    g_eventQueues.emplace(env, eventQueue);
+    return eventQueue;
+}
+
+static void RecordDroppedEvent(sptr<AsyncCallbackInfo> asyncCallbackInfo, int32_t sensorTypeId)
+{
+    uint64_t droppedCount = ++asyncCallbackInfo->droppedCount;
+    if (droppedCount == 1 || droppedCount % DROP_LOG_INTERVAL == 0) {
+        SEN_HILOGW("Consumer is lagging, sensorTypeId:%{public}d, policy:%{public}d, droppedCount:%{public}" PRIu64,
+            sensorTypeId, asyncCallbackInfo->deliveryOptions.overflowPolicy, droppedCount);
+    }
+}
+
+static void PushSensorEvent(PendingSensorEvent &pendingEvent, std::shared_ptr<CallbackSensorData> cb)
+{
+    auto &samples = pendingEvent.samples;
+    const SensorDeliveryOptions &options = pendingEvent.asyncCallbackInfo->deliveryOptions;
+    if (samples.size() < std::max(options.queueCapacity, 1U)) {
+        samples.push_back(cb);
+        return;
+    }
+    switch (options.overflowPolicy) {
+        case OVERFLOW_POLICY_DROP_OLDEST: {
+            samples.pop_front();
+            samples.push_back(cb);
+            break;
+        }
+        case OVERFLOW_POLICY_DROP_NEWEST: {
+            break;
+        }
+        default: {
+            samples.back() = cb;
+            break;
+        }
+    }
+    RecordDroppedEvent(pendingEvent.asyncCallbackInfo, cb->sensorTypeId);
+}
+
+void EnqueueSensorEvent(sptr<AsyncCallbackInfo> asyncCallbackInfo, std::shared_ptr<CallbackSensorData> cb)
+{
+    CHKPV(asyncCallbackInfo);
+    CHKPV(cb);
+    auto eventQueue = GetSensorEventQueue(asyncCallbackInfo->env);
+    CHKPV(eventQueue);
+    {
+        std::lock_guard<std::mutex> queueLock(eventQueue->mutex);
+        auto &pendingEvents = eventQueue->pendingEvents;
+        auto iter = std::find_if(pendingEvents.begin(), pendingEvents.end(),
+            [&asyncCallbackInfo](const PendingSensorEvent &pendingEvent) {
+                return pendingEvent.asyncCallbackInfo == asyncCallbackInfo;
+            });
+        if (iter != pendingEvents.end()) {
+            PushSensorEvent(*iter, cb);
+            return;
+        }
+        pendingEvents.push_back({ asyncCallbackInfo, { cb } });
+        if (eventQueue->isPosted) {
+            return;
+        }
+        eventQueue->isPosted = true;
+    }
+    PostSensorEventQueue(eventQueue);
+}
+
+void CleanSensorEventQueue(napi_env env)
+{
+    std::shared_ptr<SensorEventQueue> eventQueue = nullptr;
+    {
+        std::lock_guard<std::mutex> eventQueueLock(g_eventQueueMutex);
+        auto iter = g_eventQueues.find(env);
+        if (iter == g_eventQueues.end()) {
+            return;
+        }
+        eventQueue = iter->second;
+        g_eventQueues.erase(iter);
+    }
+    std::vector<PendingSensorEvent> pendingEvents;
+    {
+        std::lock_guard<std::mutex> queueLock(eventQueue->mutex);
+        pendingEvents.swap(eventQueue->pendingEvents);
+    }
+    ReleasePendingEvents(pendingEvents);
+}
+
+void CleanSensorPropertyKeys(napi_env env)
+{
+    std::shared_ptr<SensorPropertyKeyCache> keyCache = nullptr;
+    {
+        std::lock_guard<std::mutex> propertyKeyLock(g_propertyKeyMutex);
+        auto iter = g_propertyKeyCaches.find(env);
+        if (iter == g_propertyKeyCaches.end()) {
+            return;
+        }
+        keyCache = iter->second;
+        g_propertyKeyCaches.erase(iter);
+    }
+    for (auto &key : keyCache->keys) {
+        if (key != nullptr) {
+            napi_delete_reference(env, key);
+            key = nullptr;
+        }
     }
 }
 
@@ -46,6 +46,8 @@ struct Sensor_Subscriber {
     char name[NAME_MAX_LEN];
     Sensor_EventCallback callback;
     UserData *userData = nullptr;
+    Sensor_BatchEventCallback batchCallback = nullptr;
+    bool isPolling = false;
 };
 
 struct Sensor_Event {
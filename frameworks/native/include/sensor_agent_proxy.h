@@ -22,6 +22,8 @@
 #include "singleton.h"
 
 #include "sensor_data_channel.h"
+#include "sensor_descriptor.h"
+#include "sensor_poll_queue.h"
 
 namespace OHOS {
 namespace Sensors {
@@ -38,6 +40,12 @@ public:
         int64_t reportInterval);
     int32_t SubscribeSensor(const SensorDescription &sensorDesc, const SensorUser *user);
     int32_t UnsubscribeSensor(const SensorDescription &sensorDesc, const SensorUser *user);
+    int32_t SetBatchCallback(const SensorUser *user, RecordSensorBatchCallback batchCallback);
+    int32_t EnablePolling(const SensorUser *user, uint32_t capacity, int32_t &fd);
+    int32_t ReadEvents(const SensorUser *user, SensorEventRecord *events, uint32_t maxCount, uint32_t &count);
+    int32_t DisablePolling(const SensorUser *user);
+    int32_t SetReceiveConfig(const SensorReceiveConfig &config);
+    int32_t GetReceiveStats(SensorReceiveStats &stats);
     int32_t SetMode(const SensorDescription &sensorDesc, const SensorUser *user, int32_t mode);
     int32_t SetOption(const SensorDescription &sensorDesc, const SensorUser *user, int32_t option);
     void SetIsChannelCreated(bool isChannelCreated);
@@ -46,6 +54,8 @@ public:
     int32_t GetLocalDeviceId(int32_t &deviceId) const;
     int32_t SuspendSensors(int32_t pid);
     int32_t ResumeSensors(int32_t pid);
+    int32_t SuspendSensorsByPids(const std::vector<int32_t> &pids);
+    int32_t ResumeSensorsByPids(const std::vector<int32_t> &pids);
     int32_t GetSensorActiveInfos(int32_t pid, SensorActiveInfo **sensorActiveInfos, int32_t *count) const;
     int32_t Register(SensorActiveInfoCB callback);
     int32_t Unregister(SensorActiveInfoCB callback);
@@ -62,15 +72,22 @@ private:
     int32_t CreateSensorDataChannel();
     int32_t DestroySensorDataChannel();
     int32_t ConvertSensorInfos() const;
+    int32_t ConvertSensorInfos(const SensorDescriptorBlob &blob, uint32_t version) const;
     void ClearSensorInfos() const;
-    std::set<RecordSensorCallback> GetSubscribeUserCallback(const SensorDescription &sensorDesc);
+    void ReplaceSensorInfos(SensorInfo *sensorInfos, int32_t count, int32_t capacity) const;
+    void GetSubscribeUserCallback(const SensorDescription &sensorDesc, std::set<RecordSensorCallback> &callbacks,
+        std::set<RecordSensorBatchCallback> &batchCallbacks,
+        std::vector<std::shared_ptr<SensorPollQueue>> &pollQueues);
+    void DispatchSensorData(SensorEvent *events, int32_t num);
     bool IsSubscribeMapEmpty() const;
+    bool IsUserSubscribed(const SensorUser *user) const;
     int32_t UpdateSensorInfo(SensorInfo* sensorInfo, const Sensor& sensor);
     int32_t UpdateSensorInfosCache(const std::vector<Sensor>& deviceSensorList);
     bool FindSensorInfo(int32_t deviceId, int32_t sensorIndex, int32_t sensorTypeId);
     void UpdateSensorStatusEvent(SensorStatusEvent &event, const SensorPlugData &info);
     bool UpdateSensorInfo(const SensorPlugData &info);
     void EraseCacheSensorInfos(const SensorPlugData &info);
+    void AdvanceSensorInfoVersion(uint32_t generation) const;
     static std::recursive_mutex subscribeMutex_;
     static std::recursive_mutex subscribePlugMutex_;
     static std::mutex chanelMutex_;
@@ -81,6 +98,8 @@ private:
     std::map<SensorDescription, std::set<const SensorUser *>> subscribeMap_;
     std::map<SensorDescription, std::set<const SensorUser *>> unsubscribeMap_;
     std::set<const SensorUser *> subscribeSet_;
+    std::map<const SensorUser *, RecordSensorBatchCallback> batchCallbackMap_;
+    std::map<const SensorUser *, std::shared_ptr<SensorPollQueue>> pollQueueMap_;
     static std::mutex createChannelMutex_;
 };
 
@@ -42,6 +42,7 @@ public:
         CHKCR(dataParcel.WriteInt32(info.status), PARAMETER_ERROR);
         CHKCR(dataParcel.WriteInt32(info.reserved), PARAMETER_ERROR);
         CHKCR(dataParcel.WriteInt64(info.timestamp), PARAMETER_ERROR);
+        CHKCR(dataParcel.WriteUint32(info.generation), PARAMETER_ERROR);
         CHKPR(Remote(), ERROR);
         int error = Remote()->SendRequest(PROCESS_PLUG_EVENT, dataParcel, replyParcel, option);
         if (error != ERR_NONE) {
@@ -16,6 +16,7 @@
 #ifndef SENSOR_DATA_CHANNEL_H
 #define SENSOR_DATA_CHANNEL_H
 
+#include <atomic>
 #include <unordered_set>
 
 #include "sensor_agent_type.h"
@@ -40,10 +41,23 @@ public:
     int32_t DelFdListener(int32_t fd);
     ReceiveMessageFun GetReceiveMessageFun() const;
     DisconnectFun GetDisconnectFun() const;
+    int32_t SetReceiveConfig(const SensorReceiveConfig &config);
+    void GetReceiveStats(SensorReceiveStats &stats);
+    bool IsStatsEnabled() const;
+    void RecordReceiveStats(int32_t num, int64_t oldestLatencyNs, int64_t newestLatencyNs, int64_t dispatchNs);
 
 private:
     int32_t InnerSensorDataChannel();
+    int32_t CreateEventHandler();
     std::mutex eventRunnerMutex_;
+    SensorReceiveConfig receiveConfig_;
+    std::atomic_bool isStatsEnabled_ { false };
+    std::mutex statsMutex_;
+    SensorReceiveStats receiveStats_;
+    int64_t totalLatencyNs_ { 0 };
+    int64_t totalNewestLatencyNs_ { 0 };
+    uint64_t latencyCount_ { 0 };
+    int64_t totalDispatchNs_ { 0 };
     std::shared_ptr<SensorEventHandler> eventHandler_ = nullptr;
     std::unordered_set<int32_t> listenedFdSet_;
     ReceiveMessageFun receiveMessage_;
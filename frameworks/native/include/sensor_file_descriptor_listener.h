@@ -32,6 +32,7 @@ public:
 private:
     SensorDataChannel *channel_ = nullptr;
     SensorData *receiveDataBuff_ = nullptr;
+    SensorEvent *eventBuff_ = nullptr;
 };
 } // namespace Sensors
 } // namespace OHOS
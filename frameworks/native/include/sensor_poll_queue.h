@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef SENSOR_POLL_QUEUE_H
+#define SENSOR_POLL_QUEUE_H
+
+#include <mutex>
+#include <vector>
+
+#include "nocopyable.h"
+
+#include "sensor_agent_type.h"
+
+namespace OHOS {
+namespace Sensors {
+/*
+ * Bounded event ring for a subscriber that drains sensor data on its own thread instead of receiving callbacks.
+ * The eventfd becomes readable when the ring turns non-empty and is reset once the ring has been drained, so it can
+ * be added to the caller's epoll set. When the ring is full the oldest event is overwritten.
+ */
+class SensorPollQueue {
+public:
+    explicit SensorPollQueue(uint32_t capacity);
+    ~SensorPollQueue();
+    int32_t Init();
+    int32_t GetFd() const;
+    void Push(const SensorEvent *events, int32_t num);
+    uint32_t Read(SensorEventRecord *records, uint32_t maxCount);
+
+private:
+    DISALLOW_COPY_AND_MOVE(SensorPollQueue);
+    void Notify();
+    void ClearNotification();
+    std::mutex queueMutex_;
+    std::vector<SensorEventRecord> ring_;
+    uint32_t head_ { 0 };
+    uint32_t count_ { 0 };
+    uint64_t droppedCount_ { 0 };
+    int32_t fd_ { -1 };
+};
+} // namespace Sensors
+} // namespace OHOS
+#endif // SENSOR_POLL_QUEUE_H
@@ -25,6 +25,7 @@
 #include "sensor_basic_info.h"
 #include "sensor_client_stub.h"
 #include "sensor_data_channel.h"
+#include "sensor_list_table.h"
 #include "sensor_service_proxy.h"
 #include "stream_socket.h"
 
@@ -34,6 +35,8 @@ class SensorServiceClient : public StreamSocket, public Singleton<SensorServiceC
 public:
     ~SensorServiceClient() override;
     std::vector<Sensor> GetSensorList();
+    uint32_t GetSensorListVersion();
+    int32_t GetSensorDescriptors(SensorDescriptorBlob &blob, uint32_t &version);
     std::vector<Sensor> GetSensorListByDevice(int32_t deviceId);
     int32_t GetSensorListByDevice(int32_t deviceId, std::vector<Sensor> &singleDevSensors);
     int32_t EnableSensor(const SensorDescription &sensorDesc, int64_t samplingPeriod, int64_t maxReportDelay);
@@ -44,6 +47,8 @@ public:
     bool IsValid(const SensorDescription &sensorDesc);
     int32_t SuspendSensors(int32_t pid);
     int32_t ResumeSensors(int32_t pid);
+    int32_t SuspendSensorsByPids(const std::vector<int32_t> &pids);
+    int32_t ResumeSensorsByPids(const std::vector<int32_t> &pids);
     int32_t GetActiveInfoList(int32_t pid, std::vector<ActiveInfo> &activeInfoList);
     int32_t Register(SensorActiveInfoCB callback, sptr<SensorDataChannel> sensorDataChannel);
     int32_t Unregister(SensorActiveInfoCB callback);
@@ -55,7 +60,7 @@ public:
     int32_t CreateClientRemoteObject();
     int32_t TransferClientRemoteObject();
     int32_t DestroyClientRemoteObject();
-    bool EraseCacheSensorList(const SensorPlugData &info);
+    bool ApplySensorPlugDelta(const SensorPlugData &info, std::vector<Sensor> &addedSensors);
     int32_t GetLocalDeviceId(int32_t &deviceId);
     int32_t BlockSensorDataByPid(int32_t targetPid, const std::vector<int32_t> &sensorTypes);
     int32_t UnblockSensorDataByClient(int32_t targetPid);
@@ -71,10 +76,14 @@ private:
     void WriteHiSysIPCEventSplit(ISensorServiceIpcCode code, int32_t ret);
     int32_t DealAfterServiceAlive();
     bool LoadSensorService();
+    int32_t AttachSensorListTable();
+    void SyncSensorListFromTable();
     std::mutex clientMutex_;
     sptr<IRemoteObject::DeathRecipient> serviceDeathObserver_ = nullptr;
     sptr<ISensorService> sensorServer_ = nullptr;
     std::vector<Sensor> sensorList_;
+    SensorListTable sensorListTable_;
+    uint32_t sensorListVersion_ { SENSOR_LIST_TABLE_INVALID_VERSION };
     std::mutex channelMutex_;
     sptr<SensorDataChannel> dataChannel_ = nullptr;
     sptr<SensorClientStub> sensorClientStub_ = nullptr;
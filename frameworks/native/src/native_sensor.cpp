@@ -15,6 +15,8 @@
 
 #include "oh_sensor.h"
 
+#include <cstddef>
+
 #include "isensor_service.h"
 #include "native_sensor_impl.h"
 #include "securec.h"
@@ -26,6 +28,19 @@
 
 namespace {
 const uint32_t FLOAT_SIZE = 4;
+static_assert(sizeof(Sensor_BatchEvent) == sizeof(SensorEvent), "Sensor_BatchEvent must match SensorEvent");
+static_assert(offsetof(Sensor_BatchEvent, sensorType) == offsetof(SensorEvent, sensorTypeId), "sensorType");
+static_assert(offsetof(Sensor_BatchEvent, timestamp) == offsetof(SensorEvent, timestamp), "timestamp");
+static_assert(offsetof(Sensor_BatchEvent, accuracy) == offsetof(SensorEvent, option), "accuracy");
+static_assert(offsetof(Sensor_BatchEvent, data) == offsetof(SensorEvent, data), "data");
+static_assert(offsetof(Sensor_BatchEvent, dataLength) == offsetof(SensorEvent, dataLen), "dataLength");
+static_assert(sizeof(Sensor_PolledEvent) == sizeof(SensorEventRecord), "Sensor_PolledEvent must match the record");
+static_assert(offsetof(Sensor_PolledEvent, sensorType) == offsetof(SensorEventRecord, sensorTypeId), "sensorType");
+static_assert(offsetof(Sensor_PolledEvent, timestamp) == offsetof(SensorEventRecord, timestamp), "timestamp");
+static_assert(offsetof(Sensor_PolledEvent, accuracy) == offsetof(SensorEventRecord, option), "accuracy");
+static_assert(offsetof(Sensor_PolledEvent, dataLength) == offsetof(SensorEventRecord, dataLen), "dataLength");
+static_assert(offsetof(Sensor_PolledEvent, data) == offsetof(SensorEventRecord, data), "data");
+static_assert(sizeof(Sensor_PolledEvent::data) == SENSOR_EVENT_DATA_MAX_LEN, "data size");
 }
 
 Sensor_Result OH_Sensor_GetInfos(Sensor_Info **sensors, uint32_t *count)
@@ -190,8 +205,17 @@ Sensor_Result OH_Sensor_Subscribe(const Sensor_SubscriptionId *id,
         SEN_HILOGE("SubscribeSensor failed, %{public}d", ret);
         return SENSOR_SERVICE_EXCEPTION;
     }
+    // The agent clears the batch callback when the subscriber leaves its last sensor, set it again on reuse
+    if (user->batchCallback != nullptr) {
+        ret = SetSensorBatchCallback(sensorUser, reinterpret_cast<RecordSensorBatchCallback>(user->batchCallback));
+        if (ret != SENSOR_SUCCESS) {
+            SEN_HILOGE("SetSensorBatchCallback failed, %{public}d", ret);
+            return SENSOR_SERVICE_EXCEPTION;
+        }
+    }
     int64_t samplingInterval = attribute->samplingInterval;
-    ret = SetBatch(sensorType, sensorUser, samplingInterval, samplingInterval);
+    int64_t reportInterval = (attribute->reportInterval < 0) ? samplingInterval : attribute->reportInterval;
+    ret = SetBatch(sensorType, sensorUser, samplingInterval, reportInterval);
     if (ret != SENSOR_SUCCESS) {
         SEN_HILOGE("SetBatch failed, %{public}d", ret);
         return SENSOR_SERVICE_EXCEPTION;
@@ -299,6 +323,28 @@ int32_t OH_SensorSubscriptionAttribute_GetSamplingInterval(Sensor_SubscriptionAt
     return SENSOR_SUCCESS;
 }
 
+int32_t OH_SensorSubscriptionAttribute_SetReportingInterval(Sensor_SubscriptionAttribute* attribute,
+    const int64_t reportingInterval)
+{
+    if (attribute == nullptr || reportingInterval < 0) {
+        SEN_HILOGE("Parameter error");
+        return SENSOR_PARAMETER_ERROR;
+    }
+    attribute->reportInterval = reportingInterval;
+    return SENSOR_SUCCESS;
+}
+
+int32_t OH_SensorSubscriptionAttribute_GetReportingInterval(Sensor_SubscriptionAttribute* attribute,
+    int64_t *reportingInterval)
+{
+    if (attribute == nullptr || reportingInterval == nullptr) {
+        SEN_HILOGE("Parameter error");
+        return SENSOR_PARAMETER_ERROR;
+    }
+    *reportingInterval = attribute->reportInterval;
+    return SENSOR_SUCCESS;
+}
+
 int32_t OH_SensorSubscriber_SetCallback(Sensor_Subscriber* user, const Sensor_EventCallback callback)
 {
     if (user == nullptr || callback == nullptr) {
@@ -319,6 +365,82 @@ int32_t OH_SensorSubscriber_GetCallback(Sensor_Subscriber* user, Sensor_EventCal
     return SENSOR_SUCCESS;
 }
 
+int32_t OH_SensorSubscriber_SetBatchCallback(Sensor_Subscriber* user, const Sensor_BatchEventCallback callback)
+{
+    if (user == nullptr || callback == nullptr) {
+        SEN_HILOGE("Parameter error");
+        return SENSOR_PARAMETER_ERROR;
+    }
+    int32_t ret = SetSensorBatchCallback(reinterpret_cast<const SensorUser *>(user),
+        reinterpret_cast<RecordSensorBatchCallback>(callback));
+    if (ret != SENSOR_SUCCESS) {
+        SEN_HILOGE("SetSensorBatchCallback failed, %{public}d", ret);
+        return SENSOR_SERVICE_EXCEPTION;
+    }
+    user->batchCallback = callback;
+    return SENSOR_SUCCESS;
+}
+
+int32_t OH_SensorSubscriber_GetBatchCallback(Sensor_Subscriber* user, Sensor_BatchEventCallback *callback)
+{
+    if (user == nullptr || callback == nullptr) {
+        SEN_HILOGE("Parameter error");
+        return SENSOR_PARAMETER_ERROR;
+    }
+    *callback = user->batchCallback;
+    return SENSOR_SUCCESS;
+}
+
+int32_t OH_SensorSubscriber_EnablePolling(Sensor_Subscriber* user, uint32_t capacity, int32_t *fd)
+{
+    if (user == nullptr || fd == nullptr || capacity == 0) {
+        SEN_HILOGE("Parameter error");
+        return SENSOR_PARAMETER_ERROR;
+    }
+    int32_t ret = EnableSensorPolling(reinterpret_cast<const SensorUser *>(user), capacity, fd);
+    if (ret == SENSOR_PARAMETER_ERROR) {
+        SEN_HILOGE("EnableSensorPolling failed, %{public}d", ret);
+        return SENSOR_PARAMETER_ERROR;
+    }
+    if (ret != SENSOR_SUCCESS) {
+        SEN_HILOGE("EnableSensorPolling failed, %{public}d", ret);
+        return SENSOR_SERVICE_EXCEPTION;
+    }
+    user->isPolling = true;
+    return SENSOR_SUCCESS;
+}
+
+int32_t OH_SensorSubscriber_ReadEvents(Sensor_Subscriber* user, Sensor_PolledEvent *events, uint32_t maxCount,
+    uint32_t *count)
+{
+    if (user == nullptr || events == nullptr || count == nullptr) {
+        SEN_HILOGE("Parameter error");
+        return SENSOR_PARAMETER_ERROR;
+    }
+    int32_t ret = ReadSensorEvents(reinterpret_cast<const SensorUser *>(user),
+        reinterpret_cast<SensorEventRecord *>(events), maxCount, count);
+    if (ret != SENSOR_SUCCESS) {
+        SEN_HILOGE("ReadSensorEvents failed, %{public}d", ret);
+        return SENSOR_SERVICE_EXCEPTION;
+    }
+    return SENSOR_SUCCESS;
+}
+
+int32_t OH_SensorSubscriber_DisablePolling(Sensor_Subscriber* user)
+{
+    if (user == nullptr) {
+        SEN_HILOGE("Parameter error");
+        return SENSOR_PARAMETER_ERROR;
+    }
+    user->isPolling = false;
+    int32_t ret = DisableSensorPolling(reinterpret_cast<const SensorUser *>(user));
+    if (ret != SENSOR_SUCCESS) {
+        SEN_HILOGE("DisableSensorPolling failed, %{public}d", ret);
+        return SENSOR_SERVICE_EXCEPTION;
+    }
+    return SENSOR_SUCCESS;
+}
+
 Sensor_SubscriptionId *OH_Sensor_CreateSubscriptionId()
 {
     return new (std::nothrow) Sensor_SubscriptionId();
@@ -362,6 +484,12 @@ int32_t OH_Sensor_DestroySubscriber(Sensor_Subscriber *user)
         SEN_HILOGE("Parameter error");
         return SENSOR_PARAMETER_ERROR;
     }
+    if (user->batchCallback != nullptr) {
+        SetSensorBatchCallback(reinterpret_cast<const SensorUser *>(user), nullptr);
+    }
+    if (user->isPolling) {
+        DisableSensorPolling(reinterpret_cast<const SensorUser *>(user));
+    }
     delete user;
     user = nullptr;
     return SENSOR_SUCCESS;
@@ -115,6 +115,70 @@ int32_t SetBatch(int32_t sensorId, const SensorUser *user, int64_t samplingInter
     return ret;
 }
 
+int32_t SetSensorBatchCallback(const SensorUser *user, RecordSensorBatchCallback batchCallback)
+{
+    int32_t ret = SENSOR_AGENT_IMPL->SetBatchCallback(user, batchCallback);
+    if (ret != OHOS::ERR_OK) {
+        SEN_HILOGE("Set batch callback failed, ret:%{public}d", ret);
+        return NormalizeErrCode(ret);
+    }
+    return ret;
+}
+
+int32_t EnableSensorPolling(const SensorUser *user, uint32_t capacity, int32_t *fd)
+{
+    CHKPR(fd, OHOS::Sensors::ERROR);
+    int32_t ret = SENSOR_AGENT_IMPL->EnablePolling(user, capacity, *fd);
+    if (ret != OHOS::ERR_OK) {
+        SEN_HILOGE("Enable polling failed, ret:%{public}d", ret);
+        return NormalizeErrCode(ret);
+    }
+    return ret;
+}
+
+int32_t ReadSensorEvents(const SensorUser *user, SensorEventRecord *events, uint32_t maxCount, uint32_t *count)
+{
+    CHKPR(count, OHOS::Sensors::ERROR);
+    int32_t ret = SENSOR_AGENT_IMPL->ReadEvents(user, events, maxCount, *count);
+    if (ret != OHOS::ERR_OK) {
+        SEN_HILOGE("Read events failed, ret:%{public}d", ret);
+        return NormalizeErrCode(ret);
+    }
+    return ret;
+}
+
+int32_t DisableSensorPolling(const SensorUser *user)
+{
+    int32_t ret = SENSOR_AGENT_IMPL->DisablePolling(user);
+    if (ret != OHOS::ERR_OK) {
+        SEN_HILOGE("Disable polling failed, ret:%{public}d", ret);
+        return NormalizeErrCode(ret);
+    }
+    return ret;
+}
+
+int32_t SetSensorReceiveConfig(const SensorReceiveConfig *config)
+{
+    CHKPR(config, OHOS::Sensors::ERROR);
+    int32_t ret = SENSOR_AGENT_IMPL->SetReceiveConfig(*config);
+    if (ret != OHOS::ERR_OK) {
+        SEN_HILOGE("Set receive config failed, ret:%{public}d", ret);
+        return NormalizeErrCode(ret);
+    }
+    return ret;
+}
+
+int32_t GetSensorReceiveStats(SensorReceiveStats *stats)
+{
+    CHKPR(stats, OHOS::Sensors::ERROR);
+    int32_t ret = SENSOR_AGENT_IMPL->GetReceiveStats(*stats);
+    if (ret != OHOS::ERR_OK) {
+        SEN_HILOGE("Get receive stats failed, ret:%{public}d", ret);
+        return NormalizeErrCode(ret);
+    }
+    return ret;
+}
+
 int32_t SubscribeSensor(int32_t sensorId, const SensorUser *user)
 {
     int32_t deviceId;
@@ -177,6 +241,26 @@ int32_t ResumeSensors(int32_t pid)
     return ret;
 }
 
+int32_t SuspendSensorsByPids(const std::vector<int32_t> &pids)
+{
+    int32_t ret = SENSOR_AGENT_IMPL->SuspendSensorsByPids(pids);
+    if (ret != OHOS::ERR_OK) {
+        SEN_HILOGD("Suspend sensors by pids failed, ret:%{public}d", ret);
+        return NormalizeErrCode(ret);
+    }
+    return ret;
+}
+
+int32_t ResumeSensorsByPids(const std::vector<int32_t> &pids)
+{
+    int32_t ret = SENSOR_AGENT_IMPL->ResumeSensorsByPids(pids);
+    if (ret != OHOS::ERR_OK) {
+        SEN_HILOGD("Resume sensors by pids failed, ret:%{public}d", ret);
+        return NormalizeErrCode(ret);
+    }
+    return ret;
+}
+
 int32_t GetActiveSensorInfos(int32_t pid, SensorActiveInfo **sensorActiveInfos, int32_t *count)
 {
     CHKPR(sensorActiveInfos, OHOS::Sensors::ERROR);
@@ -15,6 +15,8 @@
 
 #include "sensor_agent_proxy.h"
 
+#include <algorithm>
+
 #include "print_sensor_data.h"
 #include "sensor_service_client.h"
 #include "sensor_xcollie.h"
@@ -28,11 +30,21 @@ constexpr uint32_t MAX_SENSOR_LIST_SIZE = 0Xffff;
 constexpr int32_t MAX_SENSOR_INFO_COUNT = 0Xffff;
 constexpr int32_t IS_LOCAL_DEVICE = 1;
 constexpr int32_t SENSOR_ONLINE = 1;
+constexpr int32_t SENSOR_INFO_RESERVED_COUNT = 16;
+constexpr uint32_t MAX_POLL_QUEUE_CAPACITY = 4096;
+constexpr size_t MAX_RETIRED_SENSOR_INFOS = 4;
 std::mutex sensorInfoMutex_;
 SensorInfoCheck sensorInfoCheck_;
 std::mutex sensorActiveInfoMutex_;
 SensorActiveInfo *sensorActiveInfos_ = nullptr;
 int32_t sensorInfoCount_ = 0;
+int32_t sensorInfoCapacity_ = 0;
+uint32_t sensorInfoVersion_ = SENSOR_LIST_TABLE_INVALID_VERSION;
+// GetAllSensors hands the cached array to callers that read it without holding sensorInfoMutex_ and never release
+// it, so once handed out an array is immutable up to its count and is retired instead of changed. Only the last
+// MAX_RETIRED_SENSOR_INFOS retired arrays are kept, an array stays readable for that many later list changes
+bool isSensorInfosHandedOut_ = false;
+std::vector<SensorInfo *> retiredSensorInfos_;
 } // namespace
 
 #define SEN_CLIENT SensorServiceClient::GetInstance()
@@ -49,39 +61,61 @@ SensorAgentProxy::~SensorAgentProxy()
 {
     CALL_LOG_ENTER;
     ClearSensorInfos();
+    std::lock_guard<std::mutex> listLock(sensorInfoMutex_);
+    for (auto sensorInfos : retiredSensorInfos_) {
+        free(sensorInfos);
+    }
+    retiredSensorInfos_.clear();
 }
 
-std::set<RecordSensorCallback> SensorAgentProxy::GetSubscribeUserCallback(const SensorDescription &sensorDesc)
+void SensorAgentProxy::GetSubscribeUserCallback(const SensorDescription &sensorDesc,
+    std::set<RecordSensorCallback> &callbacks, std::set<RecordSensorBatchCallback> &batchCallbacks,
+    std::vector<std::shared_ptr<SensorPollQueue>> &pollQueues)
 {
     std::lock_guard<std::recursive_mutex> subscribeLock(subscribeMutex_);
     auto iter = subscribeMap_.find(sensorDesc);
     if (iter == subscribeMap_.end()) {
         SEN_HILOGE("Sensor is not subscribed");
-        return {};
+        return;
     }
-    std::set<RecordSensorCallback> callback;
     for (const auto &it : iter->second) {
-        auto ret = callback.insert(it->callback);
+        auto pollIter = pollQueueMap_.find(it);
+        if (pollIter != pollQueueMap_.end()) {
+            pollQueues.push_back(pollIter->second);
+            continue;
+        }
+        auto batchIter = batchCallbackMap_.find(it);
+        if (batchIter != batchCallbackMap_.end()) {
+            batchCallbacks.insert(batchIter->second);
+            continue;
+        }
+        auto ret = callbacks.insert(it->callback);
         if (!ret.second) {
             SEN_HILOGE("callback insert fail");
         }
     }
-    return callback;
 }
 
-void SensorAgentProxy::HandleSensorData(SensorEvent *events,
-    int32_t num, void *data) __attribute__((no_sanitize("cfi")))
+void SensorAgentProxy::DispatchSensorData(SensorEvent *events, int32_t num) __attribute__((no_sanitize("cfi")))
 {
-    CHKPV(events);
-    if (num <= 0) {
-        SEN_HILOGE("events is null or num is invalid");
+    std::set<RecordSensorCallback> callbacks;
+    std::set<RecordSensorBatchCallback> batchCallbacks;
+    std::vector<std::shared_ptr<SensorPollQueue>> pollQueues;
+    GetSubscribeUserCallback({events[0].deviceId, events[0].sensorTypeId, events[0].sensorId, events[0].location},
+        callbacks, batchCallbacks, pollQueues);
+    for (const auto &pollQueue : pollQueues) {
+        pollQueue->Push(events, num);
+    }
+    for (const auto &batchCallback : batchCallbacks) {
+        CHKPV(batchCallback);
+        batchCallback(events, static_cast<uint32_t>(num));
+    }
+    if (callbacks.empty()) {
         return;
     }
     SensorEvent eventStream;
     for (int32_t i = 0; i < num; ++i) {
         eventStream = events[i];
-        auto callbacks = GetSubscribeUserCallback({eventStream.deviceId, eventStream.sensorTypeId,
-            eventStream.sensorId, eventStream.location});
         for (const auto &callback : callbacks) {
             CHKPV(callback);
             if (eventStream.sensorTypeId == SENSOR_TYPE_ID_HALL_EXT) {
@@ -93,6 +127,92 @@ void SensorAgentProxy::HandleSensorData(SensorEvent *events,
     }
 }
 
+void SensorAgentProxy::HandleSensorData(SensorEvent *events,
+    int32_t num, void *data) __attribute__((no_sanitize("cfi")))
+{
+    CHKPV(events);
+    if (num <= 0) {
+        SEN_HILOGE("events is null or num is invalid");
+        return;
+    }
+    int32_t begin = 0;
+    while (begin < num) {
+        int32_t end = begin + 1;
+        while (end < num && events[end].deviceId == events[begin].deviceId &&
+            events[end].sensorTypeId == events[begin].sensorTypeId &&
+            events[end].sensorId == events[begin].sensorId && events[end].location == events[begin].location) {
+            ++end;
+        }
+        DispatchSensorData(events + begin, end - begin);
+        begin = end;
+    }
+}
+
+int32_t SensorAgentProxy::SetBatchCallback(const SensorUser *user, RecordSensorBatchCallback batchCallback)
+{
+    CHKPR(user, OHOS::Sensors::ERROR);
+    std::lock_guard<std::recursive_mutex> subscribeLock(subscribeMutex_);
+    if (batchCallback == nullptr) {
+        batchCallbackMap_.erase(user);
+        return OHOS::Sensors::SUCCESS;
+    }
+    batchCallbackMap_[user] = batchCallback;
+    return OHOS::Sensors::SUCCESS;
+}
+
+int32_t SensorAgentProxy::EnablePolling(const SensorUser *user, uint32_t capacity, int32_t &fd)
+{
+    CHKPR(user, OHOS::Sensors::ERROR);
+    if (capacity == 0 || capacity > MAX_POLL_QUEUE_CAPACITY) {
+        SEN_HILOGE("Capacity is invalid, capacity:%{public}u", capacity);
+        return PARAMETER_ERROR;
+    }
+    auto pollQueue = std::make_shared<SensorPollQueue>(capacity);
+    int32_t ret = pollQueue->Init();
+    if (ret != ERR_OK) {
+        SEN_HILOGE("Init poll queue failed, ret:%{public}d", ret);
+        return ret;
+    }
+    std::lock_guard<std::recursive_mutex> subscribeLock(subscribeMutex_);
+    auto pairRet = pollQueueMap_.emplace(user, pollQueue);
+    if (!pairRet.second) {
+        SEN_HILOGE("Polling has been enabled");
+        return OHOS::Sensors::ERROR;
+    }
+    fd = pollQueue->GetFd();
+    return OHOS::Sensors::SUCCESS;
+}
+
+int32_t SensorAgentProxy::ReadEvents(const SensorUser *user, SensorEventRecord *events, uint32_t maxCount,
+    uint32_t &count)
+{
+    CHKPR(user, OHOS::Sensors::ERROR);
+    CHKPR(events, OHOS::Sensors::ERROR);
+    std::shared_ptr<SensorPollQueue> pollQueue = nullptr;
+    {
+        std::lock_guard<std::recursive_mutex> subscribeLock(subscribeMutex_);
+        auto iter = pollQueueMap_.find(user);
+        if (iter == pollQueueMap_.end()) {
+            SEN_HILOGE("Enable polling first");
+            return OHOS::Sensors::ERROR;
+        }
+        pollQueue = iter->second;
+    }
+    count = pollQueue->Read(events, maxCount);
+    return OHOS::Sensors::SUCCESS;
+}
+
+int32_t SensorAgentProxy::DisablePolling(const SensorUser *user)
+{
+    CHKPR(user, OHOS::Sensors::ERROR);
+    std::lock_guard<std::recursive_mutex> subscribeLock(subscribeMutex_);
+    if (pollQueueMap_.erase(user) == 0) {
+        SEN_HILOGE("Polling is not enabled");
+        return OHOS::Sensors::ERROR;
+    }
+    return OHOS::Sensors::SUCCESS;
+}
+
 void SensorAgentProxy::SetIsChannelCreated(bool isChannelCreated)
 {
     CALL_LOG_ENTER;
@@ -100,6 +220,25 @@ void SensorAgentProxy::SetIsChannelCreated(bool isChannelCreated)
     isChannelCreated_ = isChannelCreated;
 }
 
+int32_t SensorAgentProxy::SetReceiveConfig(const SensorReceiveConfig &config)
+{
+    if (config.mode != SENSOR_RECEIVE_SHARED && config.mode != SENSOR_RECEIVE_DEDICATED) {
+        SEN_HILOGE("Receive mode is invalid, mode:%{public}d", config.mode);
+        return PARAMETER_ERROR;
+    }
+    std::lock_guard<std::mutex> chanelLock(chanelMutex_);
+    CHKPR(dataChannel_, INVALID_POINTER);
+    return dataChannel_->SetReceiveConfig(config);
+}
+
+int32_t SensorAgentProxy::GetReceiveStats(SensorReceiveStats &stats)
+{
+    std::lock_guard<std::mutex> chanelLock(chanelMutex_);
+    CHKPR(dataChannel_, INVALID_POINTER);
+    dataChannel_->GetReceiveStats(stats);
+    return ERR_OK;
+}
+
 int32_t SensorAgentProxy::CreateSensorDataChannel()
 {
     CALL_LOG_ENTER;
@@ -304,6 +443,22 @@ bool SensorAgentProxy::IsSubscribeMapEmpty() const
     return subscribeMap_.empty();
 }
 
+bool SensorAgentProxy::IsUserSubscribed(const SensorUser *user) const
+{
+    std::lock_guard<std::recursive_mutex> subscribeLock(subscribeMutex_);
+    for (const auto &it : subscribeMap_) {
+        if (it.second.find(user) != it.second.end()) {
+            return true;
+        }
+    }
+    for (const auto &it : unsubscribeMap_) {
+        if (it.second.find(user) != it.second.end()) {
+            return true;
+        }
+    }
+    return false;
+}
+
 int32_t SensorAgentProxy::UnsubscribeSensor(const SensorDescription &sensorDesc, const SensorUser *user)
 {
     SEN_HILOGD("In, deviceIndex:%{public}d, sensortypeId:%{public}d, sensorId:%{public}d",
@@ -330,6 +485,11 @@ int32_t SensorAgentProxy::UnsubscribeSensor(const SensorDescription &sensorDesc,
         if (unsubscribeSet.empty()) {
             unsubscribeMap_.erase(sensorDesc);
         }
+        if (!IsUserSubscribed(user)) {
+            // Both maps are keyed by the raw pointer, which the caller may free or reuse once it is unsubscribed
+            batchCallbackMap_.erase(user);
+            pollQueueMap_.erase(user);
+        }
     }
     std::lock_guard<std::mutex> createChannelLock(createChannelMutex_);
     if (IsSubscribeMapEmpty()) {
@@ -376,16 +536,47 @@ void SensorAgentProxy::ClearSensorInfos() const
         sensorActiveInfos_ = nullptr;
     }
     CHKPV(sensorInfoCheck_.sensorInfos);
-    free(sensorInfoCheck_.sensorInfos);
-    sensorInfoCheck_.sensorInfos = nullptr;
+    ReplaceSensorInfos(nullptr, 0, 0);
     sensorInfoCheck_.checkCode = CHECK_CODE;
-    sensorInfoCount_ = 0;
+    sensorInfoVersion_ = SENSOR_LIST_TABLE_INVALID_VERSION;
+}
+
+void SensorAgentProxy::ReplaceSensorInfos(SensorInfo *sensorInfos, int32_t count, int32_t capacity) const
+{
+    if (sensorInfoCheck_.sensorInfos != nullptr) {
+        if (isSensorInfosHandedOut_) {
+            retiredSensorInfos_.push_back(sensorInfoCheck_.sensorInfos);
+            if (retiredSensorInfos_.size() > MAX_RETIRED_SENSOR_INFOS) {
+                free(retiredSensorInfos_.front());
+                retiredSensorInfos_.erase(retiredSensorInfos_.begin());
+            }
+            SEN_HILOGI("Sensor infos retired, retired count:%{public}zu", retiredSensorInfos_.size());
+        } else {
+            free(sensorInfoCheck_.sensorInfos);
+        }
+    }
+    sensorInfoCheck_.sensorInfos = sensorInfos;
+    sensorInfoCount_ = count;
+    sensorInfoCapacity_ = capacity;
+    isSensorInfosHandedOut_ = false;
 }
 
 int32_t SensorAgentProxy::ConvertSensorInfos() const
 {
     CALL_LOG_ENTER;
     SensorXcollie sensorXcollie("SensorAgentProxy:GetSensorList", XCOLLIE_TIMEOUT_5S);
+    // An unchanged sensor list version means the cached SensorInfo array is still exact, skip copying the list
+    uint32_t version = SEN_CLIENT.GetSensorListVersion();
+    if ((version != SENSOR_LIST_TABLE_INVALID_VERSION) && (version == sensorInfoVersion_) &&
+        (sensorInfoCheck_.sensorInfos != nullptr) && (sensorInfoCheck_.checkCode == CHECK_CODE)) {
+        return SUCCESS;
+    }
+    // Fill the cache straight from the packed descriptors of the shared table, the Sensor list is only the fallback
+    SensorDescriptorBlob blob;
+    uint32_t blobVersion = SENSOR_LIST_TABLE_INVALID_VERSION;
+    if ((SEN_CLIENT.GetSensorDescriptors(blob, blobVersion) == ERR_OK) && (blob.GetCount() > 0)) {
+        return ConvertSensorInfos(blob, blobVersion);
+    }
     std::vector<Sensor> sensorList = SEN_CLIENT.GetSensorList();
     if (sensorList.empty()) {
         SEN_HILOGE("Get sensor lists failed");
@@ -397,6 +588,7 @@ int32_t SensorAgentProxy::ConvertSensorInfos() const
         return ERROR;
     }
     if (sensorInfoCount_ > 0 && sensorInfoCount_ == static_cast<int32_t>(count)) {
+        sensorInfoVersion_ = version;
         return SUCCESS;
     } else if (sensorInfoCount_ > 0 && sensorInfoCount_ != static_cast<int32_t>(count) &&
         sensorInfoCheck_.checkCode == CHECK_CODE) {
@@ -407,8 +599,11 @@ int32_t SensorAgentProxy::ConvertSensorInfos() const
         SEN_HILOGE("CheckCode has been modified, %{public}d", sensorInfoCheck_.checkCode);
         ClearSensorInfos();
     }
-    sensorInfoCheck_.sensorInfos = (SensorInfo *)malloc(sizeof(SensorInfo) * count);
-    CHKPR(sensorInfoCheck_.sensorInfos, ERROR);
+    // Keep spare slots so that sensors plugged in later are appended without moving the cache
+    size_t capacity = count + SENSOR_INFO_RESERVED_COUNT;
+    auto sensorInfos = static_cast<SensorInfo *>(malloc(sizeof(SensorInfo) * capacity));
+    CHKPR(sensorInfos, ERROR);
+    ReplaceSensorInfos(sensorInfos, 0, static_cast<int32_t>(capacity));
     SEN_HILOGI("Sensor count is %{public}zu", count);
     for (size_t i = 0; i < count; ++i) {
         SensorInfo *sensorInfo = sensorInfoCheck_.sensorInfos + i;
@@ -439,6 +634,31 @@ int32_t SensorAgentProxy::ConvertSensorInfos() const
             sensorInfo->deviceId, sensorInfo->sensorTypeId, sensorInfo->sensorIndex);
     }
     sensorInfoCount_ = static_cast<int32_t>(count);
+    sensorInfoVersion_ = version;
+    return SUCCESS;
+}
+
+int32_t SensorAgentProxy::ConvertSensorInfos(const SensorDescriptorBlob &blob, uint32_t version) const
+{
+    uint32_t count = blob.GetCount();
+    if (count > MAX_SENSOR_LIST_SIZE) {
+        SEN_HILOGE("The number of sensors exceeds the maximum value");
+        return ERROR;
+    }
+    size_t capacity = count + SENSOR_INFO_RESERVED_COUNT;
+    auto sensorInfos = static_cast<SensorInfo *>(malloc(sizeof(SensorInfo) * capacity));
+    CHKPR(sensorInfos, ERROR);
+    for (uint32_t i = 0; i < count; ++i) {
+        if (blob.ToSensorInfo(i, sensorInfos[i]) != ERR_OK) {
+            SEN_HILOGE("Convert sensor descriptor failed, index:%{public}u", i);
+            free(sensorInfos);
+            return ERROR;
+        }
+    }
+    SEN_HILOGI("Sensor count is %{public}u", count);
+    ReplaceSensorInfos(sensorInfos, static_cast<int32_t>(count), static_cast<int32_t>(capacity));
+    sensorInfoCheck_.checkCode = CHECK_CODE;
+    sensorInfoVersion_ = version;
     return SUCCESS;
 }
 
@@ -515,6 +735,7 @@ int32_t SensorAgentProxy::UpdateSensorInfo(SensorInfo* sensorInfo, const Sensor&
     sensorInfo->power = sensor.GetPower();
     sensorInfo->minSamplePeriod = sensor.GetMinSamplePeriodNs();
     sensorInfo->maxSamplePeriod = sensor.GetMaxSamplePeriodNs();
+    sensorInfo->isMockSensor = sensor.GetIsMockSensor();
     return SUCCESS;
 }
 
@@ -558,21 +779,32 @@ int32_t SensorAgentProxy::UpdateSensorInfosCache(const std::vector<Sensor>& sing
         SEN_HILOGE("The number of sensors exceeds the maximum value");
         return ERROR;
     }
-    std::unique_ptr<SensorInfo[]> newSensorInfos = std::make_unique<SensorInfo[]>(newTotalCount);
-    if (newSensorInfos == nullptr) {
-        SEN_HILOGE("Failed to allocate memory for newSensorInfos");
-        return ERROR;
-    }
-    if (sensorInfoCheck_.sensorInfos) {
-        std::copy(sensorInfoCheck_.sensorInfos, sensorInfoCheck_.sensorInfos + sensorInfoCount_, newSensorInfos.get());
+    // Slots beyond the count are not visible to earlier readers, so appending there leaves their view intact
+    if (sensorInfoCheck_.sensorInfos == nullptr || newTotalCount > static_cast<size_t>(sensorInfoCapacity_)) {
+        size_t capacity = std::max(newTotalCount, static_cast<size_t>(sensorInfoCapacity_) * 2);
+        auto sensorInfos = static_cast<SensorInfo *>(malloc(sizeof(SensorInfo) * capacity));
+        if (sensorInfos == nullptr) {
+            SEN_HILOGE("Failed to allocate memory for sensorInfos");
+            return ERROR;
+        }
+        if ((currentInfoCount > 0) && (memcpy_s(sensorInfos, sizeof(SensorInfo) * capacity,
+            sensorInfoCheck_.sensorInfos, sizeof(SensorInfo) * currentInfoCount) != EOK)) {
+            SEN_HILOGE("memcpy_s failed");
+            free(sensorInfos);
+            return ERROR;
+        }
+        ReplaceSensorInfos(sensorInfos, static_cast<int32_t>(currentInfoCount), static_cast<int32_t>(capacity));
     }
     for (const auto& sensor : singleDevSensors) {
         if (!FindSensorInfo(sensor.GetDeviceId(), sensor.GetSensorId(), sensor.GetSensorTypeId())) {
-            UpdateSensorInfo(&newSensorInfos[currentInfoCount++], sensor);
+            SensorInfo *sensorInfo = sensorInfoCheck_.sensorInfos + sensorInfoCount_;
+            if (UpdateSensorInfo(sensorInfo, sensor) != SUCCESS) {
+                SEN_HILOGE("Update sensorInfo failed");
+                return ERROR;
+            }
+            sensorInfoCount_++;
         }
     }
-    sensorInfoCheck_.sensorInfos = newSensorInfos.release();
-    sensorInfoCount_ = static_cast<int32_t>(newTotalCount);
     return SUCCESS;
 }
 
@@ -602,6 +834,7 @@ int32_t SensorAgentProxy::GetAllSensors(SensorInfo **sensorInfo, int32_t *count)
     CHKPR(sensorInfoCheck_.sensorInfos, OHOS::Sensors::ERROR);
     *sensorInfo = sensorInfoCheck_.sensorInfos;
     *count = sensorInfoCount_;
+    isSensorInfosHandedOut_ = true;
     PrintSensorData::GetInstance().PrintSensorInfo(sensorInfoCheck_.sensorInfos, sensorInfoCount_);
     return SUCCESS;
 }
@@ -636,6 +869,36 @@ int32_t SensorAgentProxy::ResumeSensors(int32_t pid)
     return ret;
 }
 
+int32_t SensorAgentProxy::SuspendSensorsByPids(const std::vector<int32_t> &pids)
+{
+    CALL_LOG_ENTER;
+    if (pids.empty() || std::any_of(pids.begin(), pids.end(), [](int32_t pid) { return pid < 0; })) {
+        SEN_HILOGE("Pid list is invalid, count:%{public}zu", pids.size());
+        return PARAMETER_ERROR;
+    }
+    SensorXcollie sensorXcollie("SensorAgentProxy:SuspendSensorsByPids", XCOLLIE_TIMEOUT_5S);
+    int32_t ret = SEN_CLIENT.SuspendSensorsByPids(pids);
+    if (ret != ERR_OK) {
+        SEN_HILOGD("Suspend sensors by pids failed, ret:%{public}d", ret);
+    }
+    return ret;
+}
+
+int32_t SensorAgentProxy::ResumeSensorsByPids(const std::vector<int32_t> &pids)
+{
+    CALL_LOG_ENTER;
+    if (pids.empty() || std::any_of(pids.begin(), pids.end(), [](int32_t pid) { return pid < 0; })) {
+        SEN_HILOGE("Pid list is invalid, count:%{public}zu", pids.size());
+        return PARAMETER_ERROR;
+    }
+    SensorXcollie sensorXcollie("SensorAgentProxy:ResumeSensorsByPids", XCOLLIE_TIMEOUT_5S);
+    int32_t ret = SEN_CLIENT.ResumeSensorsByPids(pids);
+    if (ret != ERR_OK) {
+        SEN_HILOGD("Resume sensors by pids failed, ret:%{public}d", ret);
+    }
+    return ret;
+}
+
 int32_t SensorAgentProxy::GetSensorActiveInfos(int32_t pid,
     SensorActiveInfo **sensorActiveInfos, int32_t *count) const
 {
@@ -776,7 +1039,21 @@ void SensorAgentProxy::UpdateSensorStatusEvent(SensorStatusEvent &event, const S
 bool SensorAgentProxy::UpdateSensorInfo(const SensorPlugData &info)
 {
     CALL_LOG_ENTER;
+    std::vector<Sensor> addedSensors;
     if (info.status == SENSOR_ONLINE) {
+        if (SEN_CLIENT.ApplySensorPlugDelta(info, addedSensors)) {
+            std::lock_guard<std::mutex> listLock(sensorInfoMutex_);
+            if (sensorInfoCheck_.sensorInfos == nullptr) {
+                return true;
+            }
+            if (UpdateSensorInfosCache(addedSensors) != SUCCESS) {
+                SEN_HILOGW("Update sensor infos cache failed, rebuild it on next query");
+                ClearSensorInfos();
+                return true;
+            }
+            AdvanceSensorInfoVersion(info.generation);
+            return true;
+        }
         SensorInfo *sensorInfos = nullptr;
         int32_t count = 0;
         int32_t ret = GetDeviceSensors(info.deviceId, &sensorInfos, &count);
@@ -798,8 +1075,8 @@ bool SensorAgentProxy::UpdateSensorInfo(const SensorPlugData &info)
                 SEN_HILOGE("DisableSensor failed, ret:%{public}d", ret);
             }
         }
-        if (!(SEN_CLIENT.EraseCacheSensorList(info))) {
-            SEN_HILOGE("EraseCacheSensorList failed");
+        if (!(SEN_CLIENT.ApplySensorPlugDelta(info, addedSensors))) {
+            SEN_HILOGE("ApplySensorPlugDelta failed");
             return false;
         }
         EraseCacheSensorInfos(info);
@@ -807,19 +1084,49 @@ bool SensorAgentProxy::UpdateSensorInfo(const SensorPlugData &info)
     return true;
 }
 
+void SensorAgentProxy::AdvanceSensorInfoVersion(uint32_t generation) const
+{
+    // The delta made the cache match the next generation only if it directly followed the cached one and the
+    // client list reached that generation too, otherwise the next GetAllSensors rebuilds the cache
+    if ((sensorInfoVersion_ != SENSOR_LIST_TABLE_INVALID_VERSION) &&
+        (sensorInfoVersion_ + SENSOR_LIST_TABLE_VERSION_STEP == generation) &&
+        (SEN_CLIENT.GetSensorListVersion() == generation)) {
+        sensorInfoVersion_ = generation;
+    }
+}
+
 void SensorAgentProxy::EraseCacheSensorInfos(const SensorPlugData &info)
 {
     std::lock_guard<std::mutex> listLock(sensorInfoMutex_);
+    if (sensorInfoCheck_.sensorInfos == nullptr) {
+        return;
+    }
+    AdvanceSensorInfoVersion(info.generation);
     for (int32_t i = 0; i < sensorInfoCount_; ++i) {
-        if ((sensorInfoCheck_.sensorInfos[i].deviceId == info.deviceId) &&
-            (sensorInfoCheck_.sensorInfos[i].sensorTypeId == info.sensorTypeId) &&
-            (sensorInfoCheck_.sensorInfos[i].sensorIndex == info.sensorId)) {
-            for (int j = i; j < sensorInfoCount_ - 1; ++j) {
-                sensorInfoCheck_.sensorInfos[j] = sensorInfoCheck_.sensorInfos[j+1];
+        if ((sensorInfoCheck_.sensorInfos[i].deviceId != info.deviceId) ||
+            (sensorInfoCheck_.sensorInfos[i].sensorTypeId != info.sensorTypeId) ||
+            (sensorInfoCheck_.sensorInfos[i].sensorIndex != info.sensorId)) {
+            continue;
+        }
+        if (!isSensorInfosHandedOut_) {
+            for (int32_t j = i; j < sensorInfoCount_ - 1; ++j) {
+                sensorInfoCheck_.sensorInfos[j] = sensorInfoCheck_.sensorInfos[j + 1];
             }
             sensorInfoCount_--;
-            break;
+            return;
+        }
+        // Readers may still walk the handed out array, publish the shrunk list as a new array instead
+        auto sensorInfos = static_cast<SensorInfo *>(malloc(sizeof(SensorInfo) * sensorInfoCapacity_));
+        if (sensorInfos == nullptr) {
+            SEN_HILOGE("Failed to allocate memory for sensorInfos, rebuild it on next query");
+            ClearSensorInfos();
+            return;
         }
+        std::copy(sensorInfoCheck_.sensorInfos, sensorInfoCheck_.sensorInfos + i, sensorInfos);
+        std::copy(sensorInfoCheck_.sensorInfos + i + 1, sensorInfoCheck_.sensorInfos + sensorInfoCount_,
+            sensorInfos + i);
+        ReplaceSensorInfos(sensorInfos, sensorInfoCount_ - 1, sensorInfoCapacity_);
+        return;
     }
 }
 
@@ -48,6 +48,7 @@ int32_t SensorClientStub::OnRemoteRequest(uint32_t code, MessageParcel &data, Me
     CHKCR(data.ReadInt32(info.status), PARAMETER_ERROR);
     CHKCR(data.ReadInt32(info.reserved), PARAMETER_ERROR);
     CHKCR(data.ReadInt64(info.timestamp), PARAMETER_ERROR);
+    CHKCR(data.ReadUint32(info.generation), PARAMETER_ERROR);
     int32_t result = ProcessPlugEvent(info);
     if (result != NO_ERROR) {
         SEN_HILOGE("Process plug event failed");
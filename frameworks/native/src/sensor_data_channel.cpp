@@ -13,6 +13,11 @@
  * limitations under the License.
  */
 
+#include <algorithm>
+#include <sched.h>
+#include <sys/resource.h>
+#include <unistd.h>
+
 #include "fd_listener.h"
 #include "sensor_errors.h"
 #include "sensor_file_descriptor_listener.h"
@@ -23,6 +28,25 @@ namespace OHOS {
 namespace Sensors {
 using namespace OHOS::HiviewDFX;
 using namespace OHOS::AppExecFwk;
+namespace {
+const std::string RECEIVE_THREAD_NAME = "OS_SensorRecv";
+
+void ApplyReceiveThreadConfig(const SensorReceiveConfig &config)
+{
+    if (config.niceValue != 0 && setpriority(PRIO_PROCESS, gettid(), config.niceValue) != 0) {
+        SEN_HILOGW("Set receive thread priority failed, niceValue:%{public}d, errno:%{public}d",
+            config.niceValue, errno);
+    }
+    if (config.cpuId >= 0) {
+        cpu_set_t cpuSet;
+        CPU_ZERO(&cpuSet);
+        CPU_SET(config.cpuId, &cpuSet);
+        if (sched_setaffinity(0, sizeof(cpuSet), &cpuSet) != 0) {
+            SEN_HILOGW("Set receive thread affinity failed, cpuId:%{public}d, errno:%{public}d", config.cpuId, errno);
+        }
+    }
+}
+} // namespace
 
 int32_t SensorDataChannel::CreateSensorDataChannel(DataChannelCB callBack, void *data)
 {
@@ -54,10 +78,9 @@ int32_t SensorDataChannel::InnerSensorDataChannel()
     }
     auto listener = std::make_shared<SensorFileDescriptorListener>();
     listener->SetChannel(this);
-    if (eventHandler_ == nullptr) {
-        auto myRunner = AppExecFwk::EventRunner::Create(true, AppExecFwk::ThreadMode::FFRT);
-        CHKPR(myRunner, ERROR);
-        eventHandler_ = std::make_shared<SensorEventHandler>(myRunner);
+    if (eventHandler_ == nullptr && CreateEventHandler() != ERR_OK) {
+        SEN_HILOGE("Create event handler failed");
+        return ERROR;
     }
     int32_t receiveFd = GetReceiveDataFd();
     auto inResult = eventHandler_->AddFileDescriptorListener(receiveFd,
@@ -75,6 +98,86 @@ int32_t SensorDataChannel::InnerSensorDataChannel()
     return ERR_OK;
 }
 
+int32_t SensorDataChannel::CreateEventHandler()
+{
+    std::shared_ptr<AppExecFwk::EventRunner> myRunner = nullptr;
+    if (receiveConfig_.mode == SENSOR_RECEIVE_DEDICATED) {
+        myRunner = AppExecFwk::EventRunner::Create(RECEIVE_THREAD_NAME, AppExecFwk::ThreadMode::NEW_THREAD);
+    } else {
+        myRunner = AppExecFwk::EventRunner::Create(true, AppExecFwk::ThreadMode::FFRT);
+    }
+    CHKPR(myRunner, ERROR);
+    eventHandler_ = std::make_shared<SensorEventHandler>(myRunner);
+    if (receiveConfig_.mode == SENSOR_RECEIVE_DEDICATED) {
+        SensorReceiveConfig config = receiveConfig_;
+        eventHandler_->PostTask([config] {
+                ApplyReceiveThreadConfig(config);
+            }, "SensorReceiveThreadConfig", 0, AppExecFwk::EventQueue::Priority::IMMEDIATE);
+    }
+    SEN_HILOGI("Create event handler, receive mode:%{public}d", receiveConfig_.mode);
+    return ERR_OK;
+}
+
+int32_t SensorDataChannel::SetReceiveConfig(const SensorReceiveConfig &config)
+{
+    if (config.cpuId >= CPU_SETSIZE) {
+        SEN_HILOGE("CpuId is invalid, cpuId:%{public}d", config.cpuId);
+        return PARAMETER_ERROR;
+    }
+    std::lock_guard<std::mutex> eventRunnerLock(eventRunnerMutex_);
+    if (eventHandler_ != nullptr) {
+        SEN_HILOGE("Receive config must be set before the data channel is created");
+        return ERROR;
+    }
+    receiveConfig_ = config;
+    isStatsEnabled_ = config.enableStats;
+    std::lock_guard<std::mutex> statsLock(statsMutex_);
+    receiveStats_ = {};
+    receiveStats_.mode = config.mode;
+    totalLatencyNs_ = 0;
+    totalNewestLatencyNs_ = 0;
+    latencyCount_ = 0;
+    totalDispatchNs_ = 0;
+    return ERR_OK;
+}
+
+bool SensorDataChannel::IsStatsEnabled() const
+{
+    return isStatsEnabled_;
+}
+
+void SensorDataChannel::RecordReceiveStats(int32_t num, int64_t oldestLatencyNs, int64_t newestLatencyNs,
+    int64_t dispatchNs)
+{
+    std::lock_guard<std::mutex> statsLock(statsMutex_);
+    ++receiveStats_.chunkCount;
+    receiveStats_.eventCount += static_cast<uint64_t>(num);
+    totalDispatchNs_ += dispatchNs;
+    receiveStats_.maxDispatchNs = std::max(receiveStats_.maxDispatchNs, dispatchNs);
+    // The newest event has the smallest latency, a negative value means its timestamp is not on the boot clock
+    if (newestLatencyNs < 0) {
+        return;
+    }
+    ++latencyCount_;
+    totalLatencyNs_ += oldestLatencyNs;
+    receiveStats_.maxLatencyNs = std::max(receiveStats_.maxLatencyNs, oldestLatencyNs);
+    totalNewestLatencyNs_ += newestLatencyNs;
+    receiveStats_.maxNewestLatencyNs = std::max(receiveStats_.maxNewestLatencyNs, newestLatencyNs);
+}
+
+void SensorDataChannel::GetReceiveStats(SensorReceiveStats &stats)
+{
+    std::lock_guard<std::mutex> statsLock(statsMutex_);
+    stats = receiveStats_;
+    if (latencyCount_ != 0) {
+        stats.avgLatencyNs = totalLatencyNs_ / static_cast<int64_t>(latencyCount_);
+        stats.avgNewestLatencyNs = totalNewestLatencyNs_ / static_cast<int64_t>(latencyCount_);
+    }
+    if (receiveStats_.chunkCount != 0) {
+        stats.avgDispatchNs = totalDispatchNs_ / static_cast<int64_t>(receiveStats_.chunkCount);
+    }
+}
+
 int32_t SensorDataChannel::DestroySensorDataChannel()
 {
     DelFdListener(GetReceiveDataFd());
@@ -91,10 +194,9 @@ int32_t SensorDataChannel::AddFdListener(int32_t fd, ReceiveMessageFun receiveMe
     receiveMessage_ = receiveMessage;
     disconnect_ = disconnect;
     std::lock_guard<std::mutex> eventRunnerLock(eventRunnerMutex_);
-    if (eventHandler_ == nullptr) {
-        auto myRunner = AppExecFwk::EventRunner::Create(true, AppExecFwk::ThreadMode::FFRT);
-        CHKPR(myRunner, ERROR);
-        eventHandler_ = std::make_shared<SensorEventHandler>(myRunner);
+    if (eventHandler_ == nullptr && CreateEventHandler() != ERR_OK) {
+        SEN_HILOGE("Create event handler failed");
+        return ERROR;
     }
     auto listener = std::make_shared<FdListener>();
     listener->SetChannel(this);
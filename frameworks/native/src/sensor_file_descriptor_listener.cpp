@@ -14,6 +14,10 @@
  */
 
 #include "sensor_file_descriptor_listener.h"
+
+#include <algorithm>
+#include <ctime>
+
 #include "print_sensor_data.h"
 #include "sensor_errors.h"
 
@@ -27,12 +31,22 @@ using namespace OHOS::AppExecFwk;
 
 namespace {
 constexpr int32_t RECEIVE_DATA_SIZE = 100;
+constexpr int64_t NS_PER_SECOND = 1000000000;
+
+int64_t GetBootTimeNs()
+{
+    struct timespec ts = { 0, 0 };
+    clock_gettime(CLOCK_BOOTTIME, &ts);
+    return static_cast<int64_t>(ts.tv_sec) * NS_PER_SECOND + ts.tv_nsec;
+}
 } // namespace
 
 SensorFileDescriptorListener::SensorFileDescriptorListener()
 {
     receiveDataBuff_ = new (std::nothrow) SensorData[RECEIVE_DATA_SIZE];
     CHKPL(receiveDataBuff_);
+    eventBuff_ = new (std::nothrow) SensorEvent[RECEIVE_DATA_SIZE];
+    CHKPL(eventBuff_);
 }
 
 SensorFileDescriptorListener::~SensorFileDescriptorListener()
@@ -42,6 +56,10 @@ SensorFileDescriptorListener::~SensorFileDescriptorListener()
         delete[] receiveDataBuff_;
         receiveDataBuff_ = nullptr;
     }
+    if (eventBuff_ != nullptr) {
+        delete[] eventBuff_;
+        eventBuff_ = nullptr;
+    }
 }
 
 void SensorFileDescriptorListener::OnReadable(int32_t fileDescriptor)
@@ -51,7 +69,7 @@ void SensorFileDescriptorListener::OnReadable(int32_t fileDescriptor)
         return;
     }
     CHKPV(channel_);
-    if (receiveDataBuff_ == nullptr) {
+    if (receiveDataBuff_ == nullptr || eventBuff_ == nullptr) {
         SEN_HILOGE("Receive data buff_ is null");
         return;
     }
@@ -69,7 +87,7 @@ void SensorFileDescriptorListener::ExcuteCallback(int32_t length)
         return;
     }
     for (int i = 0; i < num; i++) {
-        SensorEvent event = {
+        eventBuff_[i] = {
             .sensorTypeId = receiveDataBuff_[i].sensorTypeId,
             .version = receiveDataBuff_[i].version,
             .timestamp = receiveDataBuff_[i].timestamp,
@@ -84,8 +102,21 @@ void SensorFileDescriptorListener::ExcuteCallback(int32_t length)
         if (receiveDataBuff_[i].sensorTypeId == SENSOR_TYPE_ID_HALL_EXT) {
             PrintSensorData::GetInstance().PrintSensorDataLog("ExcuteCallback", receiveDataBuff_[i]);
         }
-        channel_->dataCB_(&event, 1, channel_->privateData_);
     }
+    if (!channel_->IsStatsEnabled()) {
+        channel_->dataCB_(eventBuff_, num, channel_->privateData_);
+        return;
+    }
+    // A chunk may mix sensors, so the oldest and newest events are not necessarily the first and last ones
+    int64_t oldestTimestamp = eventBuff_[0].timestamp;
+    int64_t newestTimestamp = eventBuff_[0].timestamp;
+    for (int32_t i = 1; i < num; ++i) {
+        oldestTimestamp = std::min(oldestTimestamp, eventBuff_[i].timestamp);
+        newestTimestamp = std::max(newestTimestamp, eventBuff_[i].timestamp);
+    }
+    int64_t startNs = GetBootTimeNs();
+    channel_->dataCB_(eventBuff_, num, channel_->privateData_);
+    channel_->RecordReceiveStats(num, startNs - oldestTimestamp, startNs - newestTimestamp, GetBootTimeNs() - startNs);
 }
 
 void SensorFileDescriptorListener::SetChannel(SensorDataChannel *channel)
@@ -103,6 +134,10 @@ void SensorFileDescriptorListener::OnShutdown(int32_t fileDescriptor)
         delete[] receiveDataBuff_;
         receiveDataBuff_ = nullptr;
     }
+    if (eventBuff_ != nullptr) {
+        delete[] eventBuff_;
+        eventBuff_ = nullptr;
+    }
     CHKPV(channel_);
     channel_->DestroySensorDataChannel();
 }
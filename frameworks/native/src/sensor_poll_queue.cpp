@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "sensor_poll_queue.h"
+
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+#include "securec.h"
+
+#include "sensor_errors.h"
+
+#undef LOG_TAG
+#define LOG_TAG "SensorPollQueue"
+
+namespace OHOS {
+namespace Sensors {
+using namespace OHOS::HiviewDFX;
+
+SensorPollQueue::SensorPollQueue(uint32_t capacity) : ring_(capacity) {}
+
+SensorPollQueue::~SensorPollQueue()
+{
+    if (fd_ >= 0) {
+        close(fd_);
+        fd_ = -1;
+    }
+}
+
+int32_t SensorPollQueue::Init()
+{
+    if (ring_.empty()) {
+        SEN_HILOGE("Capacity is invalid");
+        return PARAMETER_ERROR;
+    }
+    fd_ = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (fd_ < 0) {
+        SEN_HILOGE("eventfd failed, errno:%{public}d", errno);
+        return ERROR;
+    }
+    return ERR_OK;
+}
+
+int32_t SensorPollQueue::GetFd() const
+{
+    return fd_;
+}
+
+void SensorPollQueue::Notify()
+{
+    uint64_t value = 1;
+    if (write(fd_, &value, sizeof(value)) != static_cast<ssize_t>(sizeof(value))) {
+        SEN_HILOGW("Notify failed, errno:%{public}d", errno);
+    }
+}
+
+void SensorPollQueue::ClearNotification()
+{
+    uint64_t value = 0;
+    if (read(fd_, &value, sizeof(value)) != static_cast<ssize_t>(sizeof(value))) {
+        SEN_HILOGD("No pending notification");
+    }
+}
+
+void SensorPollQueue::Push(const SensorEvent *events, int32_t num)
+{
+    CHKPV(events);
+    std::lock_guard<std::mutex> queueLock(queueMutex_);
+    bool wasEmpty = (count_ == 0);
+    uint32_t capacity = static_cast<uint32_t>(ring_.size());
+    for (int32_t i = 0; i < num; ++i) {
+        if (events[i].data == nullptr || events[i].dataLen > SENSOR_EVENT_DATA_MAX_LEN) {
+            SEN_HILOGE("Invalid event data, dataLen:%{public}u", events[i].dataLen);
+            continue;
+        }
+        if (count_ == capacity) {
+            head_ = (head_ + 1) % capacity;
+            --count_;
+            if (++droppedCount_ == 1) {
+                SEN_HILOGW("Poll queue is full, the oldest event is dropped, capacity:%{public}u", capacity);
+            }
+        }
+        SensorEventRecord &record = ring_[(head_ + count_) % capacity];
+        record.sensorTypeId = events[i].sensorTypeId;
+        record.version = events[i].version;
+        record.timestamp = events[i].timestamp;
+        record.option = events[i].option;
+        record.mode = events[i].mode;
+        record.deviceId = events[i].deviceId;
+        record.sensorId = events[i].sensorId;
+        record.location = events[i].location;
+        record.dataLen = events[i].dataLen;
+        if (memcpy_s(record.data, sizeof(record.data), events[i].data, events[i].dataLen) != EOK) {
+            SEN_HILOGE("Copy data failed");
+            continue;
+        }
+        ++count_;
+    }
+    if (wasEmpty && count_ != 0) {
+        Notify();
+    }
+}
+
+uint32_t SensorPollQueue::Read(SensorEventRecord *records, uint32_t maxCount)
+{
+    CHKPR(records, 0);
+    std::lock_guard<std::mutex> queueLock(queueMutex_);
+    uint32_t capacity = static_cast<uint32_t>(ring_.size());
+    uint32_t readCount = 0;
+    while (readCount < maxCount && count_ != 0) {
+        records[readCount++] = ring_[head_];
+        head_ = (head_ + 1) % capacity;
+        --count_;
+    }
+    if (count_ == 0) {
+        ClearNotification();
+    }
+    return readCount;
+}
+} // namespace Sensors
+} // namespace OHOS
@@ -34,6 +34,7 @@ using namespace OHOS::HiviewDFX;
 
 namespace {
 constexpr int32_t LOCAL_DEVICE = 1;
+constexpr int32_t SENSOR_ONLINE = 1;
 constexpr int32_t LOADSA_TIMEOUT_MS = 10000;
 } // namespace
 
@@ -58,8 +59,13 @@ int32_t SensorServiceClient::DealAfterServiceAlive()
     CHKPR(remoteObject, SENSOR_NATIVE_GET_SERVICE_ERR);
     remoteObject->AddDeathRecipient(serviceDeathObserver_);
     sensorList_.clear();
-    int32_t ret = sensorServer_->GetSensorList(sensorList_);
-    WriteHiSysIPCEvent(ISensorServiceIpcCode::COMMAND_GET_SENSOR_LIST, ret);
+    int32_t ret = AttachSensorListTable();
+    if (ret != ERR_OK || sensorList_.empty()) {
+        SEN_HILOGW("Sensor list table is unavailable, get sensor list by ipc");
+        sensorList_.clear();
+        ret = sensorServer_->GetSensorList(sensorList_);
+        WriteHiSysIPCEvent(ISensorServiceIpcCode::COMMAND_GET_SENSOR_LIST, ret);
+    }
     if (sensorList_.empty()) {
         SEN_HILOGW("sensorList_ is empty when connecting to the service for the first time");
     }
@@ -76,6 +82,7 @@ int32_t SensorServiceClient::InitServiceClient()
     std::lock_guard<std::mutex> clientLock(clientMutex_);
     if (sensorServer_ != nullptr) {
         SEN_HILOGD("Already init");
+        SyncSensorListFromTable();
         if (sensorList_.empty()) {
             int32_t ret = sensorServer_->GetSensorList(sensorList_);
             WriteHiSysIPCEvent(ISensorServiceIpcCode::COMMAND_GET_SENSOR_LIST, ret);
@@ -110,6 +117,47 @@ int32_t SensorServiceClient::InitServiceClient()
     return ret;
 }
 
+int32_t SensorServiceClient::AttachSensorListTable()
+{
+    CALL_LOG_ENTER;
+    CHKPR(sensorServer_, ERROR);
+    int32_t tableFd = -1;
+    int32_t ret = sensorServer_->GetSensorListTable(tableFd);
+    WriteHiSysIPCEvent(ISensorServiceIpcCode::COMMAND_GET_SENSOR_LIST_TABLE, ret);
+    if (ret != ERR_OK) {
+        SEN_HILOGE("GetSensorListTable failed, ret:%{public}d", ret);
+        return ret;
+    }
+    ret = sensorListTable_.Attach(tableFd);
+    if (ret != ERR_OK) {
+        SEN_HILOGE("Attach sensor list table failed, ret:%{public}d", ret);
+        return ret;
+    }
+    ret = sensorListTable_.Read(sensorList_, sensorListVersion_);
+    if (ret != ERR_OK) {
+        SEN_HILOGE("Read sensor list table failed, ret:%{public}d", ret);
+        sensorListTable_.Close();
+        sensorListVersion_ = SENSOR_LIST_TABLE_INVALID_VERSION;
+    }
+    return ret;
+}
+
+void SensorServiceClient::SyncSensorListFromTable()
+{
+    if (!sensorListTable_.IsValid() || sensorListTable_.GetVersion() == sensorListVersion_) {
+        return;
+    }
+    std::vector<Sensor> sensorList;
+    uint32_t version = SENSOR_LIST_TABLE_INVALID_VERSION;
+    if (sensorListTable_.Read(sensorList, version) != ERR_OK) {
+        SEN_HILOGW("Read sensor list table failed, keep the cached sensor list");
+        return;
+    }
+    SEN_HILOGI("Sensor list version changed from %{public}u to %{public}u", sensorListVersion_, version);
+    sensorList_ = std::move(sensorList);
+    sensorListVersion_ = version;
+}
+
 bool SensorServiceClient::LoadSensorService()
 { // LCOV_EXCL_START
     SEN_HILOGI("LoadSensorService in");
@@ -223,6 +271,32 @@ std::vector<Sensor> SensorServiceClient::GetSensorList()
     return sensorList_;
 }
 
+uint32_t SensorServiceClient::GetSensorListVersion()
+{
+    int32_t ret = InitServiceClient();
+    if (ret != ERR_OK) {
+        SEN_HILOGE("InitServiceClient failed, ret:%{public}d", ret);
+        return SENSOR_LIST_TABLE_INVALID_VERSION;
+    }
+    std::lock_guard<std::mutex> clientLock(clientMutex_);
+    return sensorListVersion_;
+}
+
+int32_t SensorServiceClient::GetSensorDescriptors(SensorDescriptorBlob &blob, uint32_t &version)
+{
+    int32_t ret = InitServiceClient();
+    if (ret != ERR_OK) {
+        SEN_HILOGE("InitServiceClient failed, ret:%{public}d", ret);
+        return ret;
+    }
+    std::lock_guard<std::mutex> clientLock(clientMutex_);
+    if (!sensorListTable_.IsValid()) {
+        SEN_HILOGD("Sensor list table is unavailable");
+        return ERROR;
+    }
+    return sensorListTable_.ReadBlob(blob, version);
+}
+
 int32_t SensorServiceClient::GetSensorListByDevice(int32_t deviceId, std::vector<Sensor> &singleDevSensors)
 {
     CALL_LOG_ENTER;
@@ -502,6 +576,10 @@ void SensorServiceClient::WriteHiSysIPCEventSplit(ISensorServiceIpcCode code, in
                 HiSysEventWrite(HiSysEvent::Domain::SENSOR, "SERVICE_IPC_EXCEPTION", HiSysEvent::EventType::FAULT,
                     "PKG_NAME", "DestroyClientRemoteObject", "ERROR_CODE", ret);
                 break;
+            case ISensorServiceIpcCode::COMMAND_GET_SENSOR_LIST_TABLE:
+                HiSysEventWrite(HiSysEvent::Domain::SENSOR, "SERVICE_IPC_EXCEPTION", HiSysEvent::EventType::FAULT,
+                    "PKG_NAME", "GetSensorListTable", "ERROR_CODE", ret);
+                break;
             default:
                 SEN_HILOGW("Code does not exist, code:%{public}d", static_cast<int32_t>(code));
                 break;
@@ -620,6 +698,46 @@ int32_t SensorServiceClient::ResumeSensors(int32_t pid)
     return ret;
 }
 
+int32_t SensorServiceClient::SuspendSensorsByPids(const std::vector<int32_t> &pids)
+{
+    CALL_LOG_ENTER;
+    int32_t ret = InitServiceClient();
+    if (ret != ERR_OK) {
+        SEN_HILOGE("InitServiceClient failed, ret:%{public}d", ret);
+        return ret;
+    }
+    std::lock_guard<std::mutex> clientLock(clientMutex_);
+    CHKPR(sensorServer_, ERROR);
+#ifdef HIVIEWDFX_HITRACE_ENABLE
+    StartTrace(HITRACE_TAG_SENSORS, "SuspendSensorsByPids");
+#endif // HIVIEWDFX_HITRACE_ENABLE
+    ret = sensorServer_->SuspendSensorsByPids(pids);
+#ifdef HIVIEWDFX_HITRACE_ENABLE
+    FinishTrace(HITRACE_TAG_SENSORS);
+#endif // HIVIEWDFX_HITRACE_ENABLE
+    return ret;
+}
+
+int32_t SensorServiceClient::ResumeSensorsByPids(const std::vector<int32_t> &pids)
+{
+    CALL_LOG_ENTER;
+    int32_t ret = InitServiceClient();
+    if (ret != ERR_OK) {
+        SEN_HILOGE("InitServiceClient failed, ret:%{public}d", ret);
+        return ret;
+    }
+    std::lock_guard<std::mutex> clientLock(clientMutex_);
+    CHKPR(sensorServer_, ERROR);
+#ifdef HIVIEWDFX_HITRACE_ENABLE
+    StartTrace(HITRACE_TAG_SENSORS, "ResumeSensorsByPids");
+#endif // HIVIEWDFX_HITRACE_ENABLE
+    ret = sensorServer_->ResumeSensorsByPids(pids);
+#ifdef HIVIEWDFX_HITRACE_ENABLE
+    FinishTrace(HITRACE_TAG_SENSORS);
+#endif // HIVIEWDFX_HITRACE_ENABLE
+    return ret;
+}
+
 int32_t SensorServiceClient::GetActiveInfoList(int32_t pid, std::vector<ActiveInfo> &activeInfoList)
 {
     CALL_LOG_ENTER;
@@ -870,24 +988,50 @@ void SensorServiceClient::SetDeviceStatus(uint32_t deviceStatus)
 #endif // HIVIEWDFX_HITRACE_ENABLE
 }
 
-bool SensorServiceClient::EraseCacheSensorList(const SensorPlugData &info)
+bool SensorServiceClient::ApplySensorPlugDelta(const SensorPlugData &info, std::vector<Sensor> &addedSensors)
 { // LCOV_EXCL_START
     CALL_LOG_ENTER;
     std::lock_guard<std::mutex> clientLock(clientMutex_);
-    if (sensorList_.empty()) {
-        SEN_HILOGE("sensorList_ cannot be empty");
-        return false;
+    uint32_t version = sensorListVersion_;
+    if (info.status == SENSOR_ONLINE) {
+        if (!sensorListTable_.IsValid()) {
+            SEN_HILOGW("Sensor list table is unavailable");
+            return false;
+        }
+        std::vector<Sensor> singleDevSensors;
+        if (sensorListTable_.ReadByDevice(info.deviceId, singleDevSensors, version) != ERR_OK) {
+            SEN_HILOGE("Read sensor list table by device failed");
+            return false;
+        }
+        for (const auto &newSensor : singleDevSensors) {
+            auto it = std::find_if(sensorList_.begin(), sensorList_.end(), [&](const Sensor& sensor) {
+                return sensor.GetDeviceId() == newSensor.GetDeviceId() &&
+                    sensor.GetSensorTypeId() == newSensor.GetSensorTypeId() &&
+                    sensor.GetSensorId() == newSensor.GetSensorId();
+            });
+            if (it == sensorList_.end()) {
+                sensorList_.push_back(newSensor);
+            }
+        }
+        addedSensors = std::move(singleDevSensors);
+    } else {
+        auto it = std::find_if(sensorList_.begin(), sensorList_.end(), [&](const Sensor& sensor) {
+            return sensor.GetDeviceId() == info.deviceId &&
+                sensor.GetSensorTypeId() == info.sensorTypeId &&
+                sensor.GetSensorId() == info.sensorId;
+        });
+        if (it != sensorList_.end()) {
+            sensorList_.erase(it);
+        } else {
+            SEN_HILOGD("sensorList_ cannot find the sensor");
+        }
+        version = sensorListTable_.GetVersion();
     }
-    auto it = std::find_if(sensorList_.begin(), sensorList_.end(), [&](const Sensor& sensor) {
-        return sensor.GetDeviceId() == info.deviceId &&
-            sensor.GetSensorTypeId() == info.sensorTypeId &&
-            sensor.GetSensorId() == info.sensorId;
-    });
-    if (it != sensorList_.end()) {
-        sensorList_.erase(it);
-        return true;
+    // The delta only brings the cache to the new generation when it directly follows the cached one and nothing
+    // else changed meanwhile, otherwise the next access resyncs the whole list from the table
+    if ((sensorListVersion_ + SENSOR_LIST_TABLE_VERSION_STEP == info.generation) && (version == info.generation)) {
+        sensorListVersion_ = info.generation;
     }
-    SEN_HILOGD("sensorList_ cannot find the sensor");
     return true;
 } // LCOV_EXCL_STOP
 
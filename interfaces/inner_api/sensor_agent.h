@@ -53,6 +53,8 @@ extern "C" {
  * For details, see {@link SensorInfo}.
  * @param count Indicates the pointer to the total number of sensors in the system.
  * @return Returns <b>0</b> if the information is obtained; returns a non-zero value otherwise.
+ * The array is owned by the sensor agent. It stays valid for the next four changes of the sensor list caused by
+ * sensors being plugged or unplugged, call this function again after such a change.
  *
  * @since 5
  */
@@ -92,6 +94,75 @@ int32_t UnsubscribeSensor(int32_t sensorTypeId, const SensorUser *user);
  * @since 5
  */
 int32_t SetBatch(int32_t sensorTypeId, const SensorUser *user, int64_t samplingInterval, int64_t reportInterval);
+/**
+ * @brief Sets the callback used to report sensor data to a subscriber in batches. Once it is set, every FIFO batch
+ * received from the service is passed to the batch callback in one call instead of calling the subscriber's
+ * per-event callback for each event. The setting is cleared when the subscriber is unsubscribed from its last sensor.
+ *
+ * @param user Indicates the pointer to the sensor subscriber. For details, see {@link SensorUser}.
+ * @param batchCallback Indicates the batch callback to set. Passing <b>nullptr</b> restores per-event reporting.
+ * @return Returns <b>0</b> if the setting is successful; returns a non-zero value otherwise.
+ *
+ * @since 26.0.0
+ */
+int32_t SetSensorBatchCallback(const SensorUser *user, RecordSensorBatchCallback batchCallback);
+/**
+ * @brief Switches a subscriber to poll mode. Sensor data for the subscriber is then queued instead of being passed
+ * to its callbacks, and is drained with {@link ReadSensorEvents} on the caller's own thread.
+ *
+ * @param user Indicates the pointer to the sensor subscriber. For details, see {@link SensorUser}.
+ * @param capacity Indicates the maximum number of queued events. When the queue is full, the oldest event is dropped.
+ * @param fd Indicates the pointer to an event fd that becomes readable when events are queued and is reset once the
+ * queue has been drained. It is owned by the sensor agent and stays valid until {@link DisableSensorPolling} is called
+ * or the subscriber is unsubscribed from its last sensor, whichever comes first.
+ * @return Returns <b>0</b> if the setting is successful; returns a non-zero value otherwise.
+ *
+ * @since 26.0.0
+ */
+int32_t EnableSensorPolling(const SensorUser *user, uint32_t capacity, int32_t *fd);
+/**
+ * @brief Reads the queued sensor data of a subscriber in poll mode without blocking.
+ *
+ * @param user Indicates the pointer to the sensor subscriber. For details, see {@link SensorUser}.
+ * @param events Indicates the caller-owned buffer that receives the events, oldest first.
+ * @param maxCount Indicates the number of events the buffer can hold.
+ * @param count Indicates the pointer to the number of events read.
+ * @return Returns <b>0</b> if the operation is successful; returns a non-zero value otherwise.
+ *
+ * @since 26.0.0
+ */
+int32_t ReadSensorEvents(const SensorUser *user, SensorEventRecord *events, uint32_t maxCount, uint32_t *count);
+/**
+ * @brief Switches a subscriber back to callback mode and releases its queue and event fd.
+ *
+ * @param user Indicates the pointer to the sensor subscriber. For details, see {@link SensorUser}.
+ * @return Returns <b>0</b> if the operation is successful; returns a non-zero value otherwise.
+ *
+ * @since 26.0.0
+ */
+int32_t DisableSensorPolling(const SensorUser *user);
+
+/**
+ * @brief Sets how the client receives sensor data. The setting takes effect when the data channel is created, so it
+ * must be called before the first sensor is subscribed to.
+ *
+ * @param config Indicates the pointer to the receive configuration. For details, see {@link SensorReceiveConfig}.
+ * @return Returns <b>0</b> if the setting is successful; returns a non-zero value otherwise.
+ *
+ * @since 26.0.0
+ */
+int32_t SetSensorReceiveConfig(const SensorReceiveConfig *config);
+
+/**
+ * @brief Obtains the receive-side latency statistics collected since the receive mode was last set. Statistics are
+ * only collected when {@link SensorReceiveConfig} enables them, otherwise all counters stay zero.
+ *
+ * @param stats Indicates the pointer to the statistics. For details, see {@link SensorReceiveStats}.
+ * @return Returns <b>0</b> if the operation is successful; returns a non-zero value otherwise.
+ *
+ * @since 26.0.0
+ */
+int32_t GetSensorReceiveStats(SensorReceiveStats *stats);
 /**
  * @brief Enables the sensor that has been subscribed to. The subscriber can obtain the sensor data
  * only after the sensor is enabled.
@@ -148,6 +219,28 @@ int32_t SuspendSensors(int32_t pid);
  */
 int32_t ResumeSensors(int32_t pid);
 
+/**
+ * @brief Suspends all sensors subscribed by a group of processes in one call.
+ * Each sensor is disabled at most once, no matter how many of the processes subscribe to it.
+ *
+ * @param pids Indicates the IDs of the processes.
+ * @return Returns <b>0</b> if all the sensors are suspended; returns a non-zero value otherwise.
+ *
+ * @since 26.0.0
+ */
+int32_t SuspendSensorsByPids(const std::vector<int32_t> &pids);
+
+/**
+ * @brief Resumes all sensors subscribed by a group of processes in one call.
+ * Each sensor is configured and enabled at most once, no matter how many of the processes subscribe to it.
+ *
+ * @param pids Indicates the IDs of the processes.
+ * @return Returns <b>0</b> if all the sensors are resumed; returns a non-zero value otherwise.
+ *
+ * @since 26.0.0
+ */
+int32_t ResumeSensorsByPids(const std::vector<int32_t> &pids);
+
 /**
  * @brief Obtains information about all sensors enabled by a process.
  *
@@ -58,6 +58,10 @@ extern "C" {
 #ifndef VERSION_MAX_LEN
 #define VERSION_MAX_LEN 16
 #endif /* SENSOR_USER_DATA_SIZE */
+/** Maximum length of the data carried by a polled sensor event, in bytes */
+#ifndef SENSOR_EVENT_DATA_MAX_LEN
+#define SENSOR_EVENT_DATA_MAX_LEN 64
+#endif /* SENSOR_EVENT_DATA_MAX_LEN */
 
 /**
  * @brief Enumerates sensor types.
@@ -175,6 +179,33 @@ typedef struct SensorEvent {
  */
 typedef void (*RecordSensorCallback)(SensorEvent *event);
 
+/**
+ * @brief Defines the callback for batched data reporting by the sensor agent. The events passed in one call
+ * are contiguous in memory and come from the same sensor, in the order they were reported.
+ *
+ * @since 26.0.0
+ */
+typedef void (*RecordSensorBatchCallback)(SensorEvent *events, uint32_t count);
+
+/**
+ * @brief Defines a sensor event read in poll mode. Unlike {@link SensorEvent}, the record owns a copy of the data,
+ * so it stays valid in the caller's buffer.
+ *
+ * @since 26.0.0
+ */
+typedef struct SensorEventRecord {
+    int32_t sensorTypeId = -1;  /**< Sensor type ID */
+    int32_t version = -1;       /**< Sensor algorithm version */
+    int64_t timestamp = -1;     /**< Time when sensor data was reported */
+    int32_t option = -1;        /**< Sensor data options, including the measurement range and accuracy */
+    int32_t mode = -1;          /**< Sensor data reporting mode (described in {@link SensorMode}) */
+    int32_t deviceId = -1;      /**< Device ID */
+    int32_t sensorId = -1;      /**< Sensor ID */
+    int32_t location = -1;      /**< Is the device a local device or an external device */
+    uint32_t dataLen = 0;       /**< Sensor data length */
+    uint8_t data[SENSOR_EVENT_DATA_MAX_LEN];  /**< Sensor data */
+} SensorEventRecord;
+
 typedef struct SensorStatusEvent {
     int64_t timestamp = -1;    /**< Time when sensor data was reported */
     int32_t sensorType = -1;   /**< Sensor type ID */
@@ -227,6 +258,49 @@ typedef enum SensorMode {
     SENSOR_MODE_MAX2,        /**< Maximum sensor data reporting mode */
 } SensorMode;
 
+/**
+ * @brief Enumerates the threading modes used by the client to receive sensor data.
+ *
+ * @since 26.0.0
+ */
+typedef enum SensorReceiveMode {
+    SENSOR_RECEIVE_SHARED = 0,     /**< Receive on the shared FFRT task pool (default) */
+    SENSOR_RECEIVE_DEDICATED = 1,  /**< Receive on a dedicated thread owned by the sensor client */
+} SensorReceiveMode;
+
+/**
+ * @brief Defines how the client receives sensor data. Priority and CPU affinity only apply to
+ * {@link SENSOR_RECEIVE_DEDICATED}.
+ *
+ * @since 26.0.0
+ */
+typedef struct SensorReceiveConfig {
+    SensorReceiveMode mode = SENSOR_RECEIVE_SHARED;  /**< Receive mode */
+    int32_t niceValue = 0;  /**< Nice value of the receive thread, 0 keeps the inherited priority */
+    int32_t cpuId = -1;     /**< CPU the receive thread is bound to, -1 means no affinity */
+    bool enableStats = false;  /**< Whether to collect {@link SensorReceiveStats}, off by default */
+} SensorReceiveConfig;
+
+/**
+ * @brief Defines receive-side latency statistics of the current receive mode. Delivery latency is measured from the
+ * event timestamp to the moment the client starts dispatching the chunk that carries it. It is given for the oldest
+ * event of each chunk, which includes the time spent in a hardware FIFO, and for the newest one, which does not.
+ * Dispatch time covers the subscriber callbacks.
+ *
+ * @since 26.0.0
+ */
+typedef struct SensorReceiveStats {
+    SensorReceiveMode mode = SENSOR_RECEIVE_SHARED;  /**< Receive mode the statistics were collected in */
+    uint64_t chunkCount = 0;        /**< Number of data chunks received */
+    uint64_t eventCount = 0;        /**< Number of sensor events received */
+    int64_t avgLatencyNs = 0;       /**< Average delivery latency of the oldest event, in nanoseconds */
+    int64_t maxLatencyNs = 0;       /**< Maximum delivery latency of the oldest event, in nanoseconds */
+    int64_t avgNewestLatencyNs = 0; /**< Average delivery latency of the newest event, in nanoseconds */
+    int64_t maxNewestLatencyNs = 0; /**< Maximum delivery latency of the newest event, in nanoseconds */
+    int64_t avgDispatchNs = 0;      /**< Average dispatch time per chunk, in nanoseconds */
+    int64_t maxDispatchNs = 0;      /**< Maximum dispatch time per chunk, in nanoseconds */
+} SensorReceiveStats;
+
 /**
  * @brief Defines the struct of the data reported by the acceleration sensor.
  * This sensor measures the acceleration applied to the device on three physical axes (x, y, and z), in m/s2.
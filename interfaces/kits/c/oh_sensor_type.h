@@ -459,6 +459,33 @@ int32_t OH_SensorSubscriptionAttribute_SetSamplingInterval(Sensor_SubscriptionAt
 int32_t OH_SensorSubscriptionAttribute_GetSamplingInterval(Sensor_SubscriptionAttribute* attribute,
     int64_t *samplingInterval);
 
+/**
+ * @brief Sets the maximum sensor data reporting latency. Sensors with a hardware FIFO may hold samples for up to
+ * this long and report them in one batch, which is delivered through {@link Sensor_BatchEventCallback} if one is set.
+ * If it is not set, data is reported at the sampling interval.
+ *
+ * @param attribute - Pointer to the sensor subscription attribute.
+ * @param reportingInterval - Maximum reporting latency to set, in nanoseconds.
+ * @return Returns <b>SENSOR_SUCCESS</b> if the operation is successful;
+ * returns an error code defined in {@link Sensor_Result} otherwise.
+ * @since 26.0.0
+ */
+int32_t OH_SensorSubscriptionAttribute_SetReportingInterval(Sensor_SubscriptionAttribute* attribute,
+    const int64_t reportingInterval);
+
+/**
+ * @brief Obtains the maximum sensor data reporting latency.
+ *
+ * @param attribute - Pointer to the sensor subscription attribute.
+ * @param reportingInterval - Pointer to the maximum reporting latency, in nanoseconds. The value is <b>-1</b>
+ * if it has not been set.
+ * @return Returns <b>SENSOR_SUCCESS</b> if the operation is successful;
+ * returns an error code defined in {@link Sensor_Result} otherwise.
+ * @since 26.0.0
+ */
+int32_t OH_SensorSubscriptionAttribute_GetReportingInterval(Sensor_SubscriptionAttribute* attribute,
+    int64_t *reportingInterval);
+
 /**
  * @brief Defines the callback function used to report sensor data.
  * @since 11
@@ -511,6 +538,129 @@ int32_t OH_SensorSubscriber_SetCallback(Sensor_Subscriber* subscriber, const Sen
  * @since 11
  */
 int32_t OH_SensorSubscriber_GetCallback(Sensor_Subscriber* subscriber, Sensor_EventCallback *callback);
+
+/**
+ * @brief Defines one sensor event of a batch. The layout is fixed, so the fields can be read directly
+ * without calling the getter functions.
+ * @since 26.0.0
+ */
+typedef struct Sensor_BatchEvent {
+    /** Sensor type, see {@link Sensor_Type}. */
+    int32_t sensorType;
+    /** Version of the sensor algorithm. */
+    int32_t version;
+    /** Timestamp of the sensor data, in nanoseconds. */
+    int64_t timestamp;
+    /** Accuracy of the sensor data, see {@link Sensor_Accuracy}. */
+    int32_t accuracy;
+    /** Data reporting mode. */
+    int32_t mode;
+    /** Sensor data, laid out as described in {@link OH_SensorEvent_GetData}. */
+    float *data;
+    /** Length of the sensor data, in bytes. */
+    uint32_t dataLength;
+    /** Reserved. */
+    int32_t reserved[3];
+} Sensor_BatchEvent;
+
+/**
+ * @brief Defines the callback function used to report sensor data in batches. The events are contiguous in memory,
+ * come from the same sensor and are ordered by timestamp. They are valid only while the callback runs.
+ *
+ * @param events - Pointer to the first event of the batch.
+ * @param count - Number of events in the batch.
+ * @since 26.0.0
+ */
+typedef void (*Sensor_BatchEventCallback)(Sensor_BatchEvent *events, uint32_t count);
+
+/**
+ * @brief Sets a callback function to report sensor data in batches. Once it is set, the subscriber receives every
+ * batch reported by the sensor in one call instead of one {@link Sensor_EventCallback} call per event.
+ * The callback set by {@link OH_SensorSubscriber_SetCallback} is still required to subscribe.
+ *
+ * @param subscriber - Pointer to the sensor subscriber information.
+ * @param callback - Batch callback function to set.
+ * @return Returns <b>SENSOR_SUCCESS</b> if the operation is successful;
+ * returns an error code defined in {@link Sensor_Result} otherwise.
+ * @since 26.0.0
+ */
+int32_t OH_SensorSubscriber_SetBatchCallback(Sensor_Subscriber* subscriber, const Sensor_BatchEventCallback callback);
+
+/**
+ * @brief Obtains the callback function used to report sensor data in batches.
+ *
+ * @param subscriber - Pointer to the sensor subscriber information.
+ * @param callback - Pointer to the batch callback function.
+ * @return Returns <b>SENSOR_SUCCESS</b> if the operation is successful;
+ * returns an error code defined in {@link Sensor_Result} otherwise.
+ * @since 26.0.0
+ */
+int32_t OH_SensorSubscriber_GetBatchCallback(Sensor_Subscriber* subscriber, Sensor_BatchEventCallback *callback);
+
+/**
+ * @brief Defines one sensor event read in poll mode. Unlike {@link Sensor_BatchEvent}, the event holds a copy of
+ * the data, so it stays valid in the caller's buffer.
+ * @since 26.0.0
+ */
+typedef struct Sensor_PolledEvent {
+    /** Sensor type, see {@link Sensor_Type}. */
+    int32_t sensorType;
+    /** Version of the sensor algorithm. */
+    int32_t version;
+    /** Timestamp of the sensor data, in nanoseconds. */
+    int64_t timestamp;
+    /** Accuracy of the sensor data, see {@link Sensor_Accuracy}. */
+    int32_t accuracy;
+    /** Data reporting mode. */
+    int32_t mode;
+    /** Reserved. */
+    int32_t reserved[3];
+    /** Length of the valid sensor data, in bytes. */
+    uint32_t dataLength;
+    /** Sensor data, laid out as described in {@link OH_SensorEvent_GetData}. */
+    float data[16];
+} Sensor_PolledEvent;
+
+/**
+ * @brief Switches a subscriber to poll mode. Sensor data for the subscriber is then queued instead of being passed
+ * to its callbacks, and is read with {@link OH_SensorSubscriber_ReadEvents} on the caller's own thread.
+ * Poll mode ends when {@link OH_SensorSubscriber_DisablePolling} is called or the subscriber is unsubscribed from
+ * its last sensor. It must be enabled again before the subscriber is reused.
+ *
+ * @param subscriber - Pointer to the sensor subscriber information.
+ * @param capacity - Maximum number of queued events. When the queue is full, the oldest event is dropped.
+ * @param fd - Pointer to a file descriptor that becomes readable when events are queued and is reset once the queue
+ * has been drained. It can be added to an epoll set but must not be closed by the caller, and is valid only while
+ * the subscriber is in poll mode.
+ * @return Returns <b>SENSOR_SUCCESS</b> if the operation is successful;
+ * returns an error code defined in {@link Sensor_Result} otherwise.
+ * @since 26.0.0
+ */
+int32_t OH_SensorSubscriber_EnablePolling(Sensor_Subscriber* subscriber, uint32_t capacity, int32_t *fd);
+
+/**
+ * @brief Reads the queued sensor data of a subscriber in poll mode without blocking.
+ *
+ * @param subscriber - Pointer to the sensor subscriber information.
+ * @param events - Caller-owned buffer that receives the events, oldest first.
+ * @param maxCount - Number of events the buffer can hold.
+ * @param count - Pointer to the number of events read.
+ * @return Returns <b>SENSOR_SUCCESS</b> if the operation is successful;
+ * returns an error code defined in {@link Sensor_Result} otherwise.
+ * @since 26.0.0
+ */
+int32_t OH_SensorSubscriber_ReadEvents(Sensor_Subscriber* subscriber, Sensor_PolledEvent *events, uint32_t maxCount,
+    uint32_t *count);
+
+/**
+ * @brief Switches a subscriber back to callback mode and releases its queue and file descriptor.
+ *
+ * @param subscriber - Pointer to the sensor subscriber information.
+ * @return Returns <b>SENSOR_SUCCESS</b> if the operation is successful;
+ * returns an error code defined in {@link Sensor_Result} otherwise.
+ * @since 26.0.0
+ */
+int32_t OH_SensorSubscriber_DisablePolling(Sensor_Subscriber* subscriber);
 #ifdef __cplusplus
 }
 #endif
@@ -42,6 +42,7 @@ public:
 private:
     DISALLOW_COPY_AND_MOVE(CompatibleConnection);
     static void ReportSensorDataCallback(SensorEvent *event);
+    static void ReportSensorPlugCallback(const SensorInfo &sensorInfo, bool isOnline);
     static ReportDataCb reportDataCb_;
     static sptr<ReportDataCallback> reportDataCallback_;
     static DevicePlugCallback reportPlugDataCb_;
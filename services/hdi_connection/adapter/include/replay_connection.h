@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef REPLAY_CONNECTION_H
+#define REPLAY_CONNECTION_H
+
+#include <set>
+#include <thread>
+
+#include "i_sensor_hdi_connection.h"
+#include "sensor_trace_file.h"
+
+namespace OHOS {
+namespace Sensors {
+/*
+ * Feeds a recorded sensor trace into the service instead of the sensor HDI. The speed is a multiple of the recorded
+ * pace, 0 replays as fast as possible. Pacing starts when the first sensor is enabled, and only events of enabled
+ * sensors are reported, stamped with the current time.
+ */
+class ReplayConnection : public ISensorHdiConnection {
+public:
+    ReplayConnection(const std::string &tracePath, int32_t speed, bool isLoop);
+    virtual ~ReplayConnection();
+    int32_t ConnectHdi() override;
+    int32_t GetSensorList(std::vector<Sensor> &sensorList) override;
+    int32_t GetSensorListByDevice(int32_t deviceId, std::vector<Sensor> &singleDevSensors) override;
+    int32_t EnableSensor(const SensorDescription &sensorDesc) override;
+    int32_t DisableSensor(const SensorDescription &sensorDesc)  override;
+    int32_t SetBatch(const SensorDescription &sensorDesc, int64_t samplingInterval, int64_t reportInterval) override;
+    int32_t SetMode(const SensorDescription &sensorDesc, int32_t mode) override;
+    int32_t RegisterDataReport(ReportDataCb cb, sptr<ReportDataCallback> reportDataCallback) override;
+    int32_t DestroyHdiConnection() override;
+    int32_t RegSensorPlugCallback(DevicePlugCallback cb) override;
+    DevicePlugCallback GetSensorPlugCb() override;
+    int32_t ConnectSensorTransformHdi() override;
+    int32_t TransformSensorData(uint32_t state, uint32_t policy, SensorData* sensorData) override;
+
+private:
+    DISALLOW_COPY_AND_MOVE(ReplayConnection);
+    void StartReplayLocked();
+    void ReplayThread();
+    bool WaitUntil(int64_t traceTime, int64_t traceStartTime, int64_t replayStartTime);
+    bool IsSensorEnabled(const SensorData &data);
+    void ReportSensorData(SensorData &data);
+    std::string tracePath_;
+    int32_t speed_ { 1 };
+    bool isLoop_ { false };
+    SensorTraceReader traceReader_;
+    std::vector<Sensor> sensorList_;
+    std::mutex enableMutex_;
+    std::set<SensorDescription> enabledSensors_;
+    ReportDataCb reportDataCb_ = nullptr;
+    sptr<ReportDataCallback> reportDataCallback_ = nullptr;
+    std::thread replayThread_;
+    std::atomic_bool isStop_ { false };
+};
+} // namespace Sensors
+} // namespace OHOS
+#endif // REPLAY_CONNECTION_H
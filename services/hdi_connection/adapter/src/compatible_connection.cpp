@@ -23,9 +23,14 @@
 namespace OHOS {
 namespace Sensors {
 using namespace OHOS::HiviewDFX;
+namespace {
+constexpr int32_t SENSOR_OFFLINE = 0;
+constexpr int32_t SENSOR_ONLINE = 1;
+} // namespace
 
 ReportDataCb CompatibleConnection::reportDataCb_ = nullptr;
 sptr<ReportDataCallback> CompatibleConnection::reportDataCallback_ = nullptr;
+DevicePlugCallback CompatibleConnection::reportPlugDataCb_ = nullptr;
 int32_t CompatibleConnection::ConnectHdi()
 {
     SEN_HILOGI("Connect hdi success");
@@ -217,14 +222,35 @@ int32_t CompatibleConnection::GetSensorListByDevice(int32_t deviceId, std::vecto
     return ERR_OK;
 }
 
+void CompatibleConnection::ReportSensorPlugCallback(const SensorInfo &sensorInfo, bool isOnline)
+{
+    CHKPV(reportPlugDataCb_);
+    SensorPlugInfo sensorPlugInfo;
+    sensorPlugInfo.deviceName = sensorInfo.sensorName;
+    sensorPlugInfo.deviceSensorInfo.deviceId = sensorInfo.deviceId;
+    sensorPlugInfo.deviceSensorInfo.sensorType = sensorInfo.sensorTypeId;
+    sensorPlugInfo.deviceSensorInfo.sensorId = sensorInfo.sensorIndex;
+    sensorPlugInfo.deviceSensorInfo.location = sensorInfo.location;
+    sensorPlugInfo.status = isOnline ? SENSOR_ONLINE : SENSOR_OFFLINE;
+    sensorPlugInfo.reserved = 0;
+    reportPlugDataCb_(sensorPlugInfo);
+}
+
 int32_t CompatibleConnection::RegSensorPlugCallback(DevicePlugCallback cb)
 {
+    CHKPR(cb, ERR_INVALID_VALUE);
+    reportPlugDataCb_ = cb;
+    int32_t ret = hdiServiceImpl_.RegisterPlugCallback(ReportSensorPlugCallback);
+    if (ret != 0) {
+        SEN_HILOGE("Register plug callback failed");
+        return ret;
+    }
     return ERR_OK;
 }
 
 DevicePlugCallback CompatibleConnection::GetSensorPlugCb()
 {
-    return NULL;
+    return reportPlugDataCb_;
 }
 
 int32_t CompatibleConnection::ConnectSensorTransformHdi()
@@ -0,0 +1,261 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "replay_connection.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <ctime>
+#include <sys/prctl.h>
+
+#include "sensor_errors.h"
+
+#undef LOG_TAG
+#define LOG_TAG "ReplayConnection"
+
+namespace OHOS {
+namespace Sensors {
+using namespace OHOS::HiviewDFX;
+namespace {
+const std::string SENSOR_REPLAY_THREAD_NAME = "OS_SenReplay";
+constexpr int64_t NS_PER_SECOND = 1000000000;
+constexpr int64_t MAX_SLEEP_SLICE_NS = 100000000;
+constexpr int64_t MIN_SAMPLE_PERIOD_NS = 1000000;
+constexpr int64_t MAX_SAMPLE_PERIOD_NS = 1000000000;
+constexpr float MAX_RANGE = 9999.0F;
+constexpr float RESOLUTION = 0.000001F;
+
+int64_t GetClockTimeNs(clockid_t clockId)
+{
+    struct timespec ts = { 0, 0 };
+    clock_gettime(clockId, &ts);
+    return static_cast<int64_t>(ts.tv_sec) * NS_PER_SECOND + ts.tv_nsec;
+}
+} // namespace
+
+ReplayConnection::ReplayConnection(const std::string &tracePath, int32_t speed, bool isLoop)
+    : tracePath_(tracePath), speed_(speed), isLoop_(isLoop)
+{}
+
+ReplayConnection::~ReplayConnection()
+{
+    DestroyHdiConnection();
+}
+
+int32_t ReplayConnection::ConnectHdi()
+{
+    CALL_LOG_ENTER;
+    if (speed_ < 0) {
+        SEN_HILOGE("Invalid replay speed:%{public}d", speed_);
+        return ERROR;
+    }
+    int32_t ret = traceReader_.Open(tracePath_);
+    if (ret != ERR_OK) {
+        SEN_HILOGE("Open sensor trace failed");
+        return ret;
+    }
+    std::set<SensorDescription> sensorDescs;
+    SensorData data = {};
+    while (traceReader_.Next(data)) {
+        sensorDescs.insert({data.deviceId, data.sensorTypeId, data.sensorId, data.location});
+    }
+    traceReader_.Rewind();
+    isStop_ = false;
+    sensorList_.clear();
+    for (const auto &sensorDesc : sensorDescs) {
+        Sensor sensor;
+        sensor.SetDeviceId(sensorDesc.deviceId);
+        sensor.SetSensorTypeId(sensorDesc.sensorType);
+        sensor.SetSensorId(sensorDesc.sensorId);
+        sensor.SetLocation(sensorDesc.location);
+        sensor.SetSensorName("sensor_replay");
+        sensor.SetVendorName("default");
+        sensor.SetFirmwareVersion("1.0.0");
+        sensor.SetHardwareVersion("1.0.0");
+        sensor.SetMaxRange(MAX_RANGE);
+        sensor.SetResolution(RESOLUTION);
+        sensor.SetMinSamplePeriodNs(MIN_SAMPLE_PERIOD_NS);
+        sensor.SetMaxSamplePeriodNs(MAX_SAMPLE_PERIOD_NS);
+        sensorList_.push_back(sensor);
+    }
+    SEN_HILOGI("Connect replay success, sensorCount:%{public}zu, speed:%{public}d, isLoop:%{public}d",
+        sensorList_.size(), speed_, isLoop_);
+    return ERR_OK;
+}
+
+int32_t ReplayConnection::GetSensorList(std::vector<Sensor> &sensorList)
+{
+    sensorList.insert(sensorList.end(), sensorList_.begin(), sensorList_.end());
+    return ERR_OK;
+}
+
+int32_t ReplayConnection::GetSensorListByDevice(int32_t deviceId, std::vector<Sensor> &singleDevSensors)
+{
+    for (const auto &sensor : sensorList_) {
+        if (sensor.GetDeviceId() == deviceId) {
+            singleDevSensors.push_back(sensor);
+        }
+    }
+    return ERR_OK;
+}
+
+int32_t ReplayConnection::EnableSensor(const SensorDescription &sensorDesc)
+{
+    std::lock_guard<std::mutex> enableLock(enableMutex_);
+    enabledSensors_.insert(sensorDesc);
+    StartReplayLocked();
+    return ERR_OK;
+}
+
+int32_t ReplayConnection::DisableSensor(const SensorDescription &sensorDesc)
+{
+    std::lock_guard<std::mutex> enableLock(enableMutex_);
+    enabledSensors_.erase(sensorDesc);
+    return ERR_OK;
+}
+
+int32_t ReplayConnection::SetBatch(const SensorDescription &sensorDesc, int64_t samplingInterval,
+    int64_t reportInterval)
+{
+    return ERR_OK;
+}
+
+int32_t ReplayConnection::SetMode(const SensorDescription &sensorDesc, int32_t mode)
+{
+    return ERR_OK;
+}
+
+int32_t ReplayConnection::RegisterDataReport(ReportDataCb cb, sptr<ReportDataCallback> reportDataCallback)
+{
+    CHKPR(reportDataCallback, ERR_INVALID_VALUE);
+    std::lock_guard<std::mutex> enableLock(enableMutex_);
+    reportDataCb_ = cb;
+    reportDataCallback_ = reportDataCallback;
+    StartReplayLocked();
+    return ERR_OK;
+}
+
+int32_t ReplayConnection::DestroyHdiConnection()
+{
+    std::thread replayThread;
+    {
+        std::lock_guard<std::mutex> enableLock(enableMutex_);
+        isStop_ = true;
+        replayThread = std::move(replayThread_);
+    }
+    if (replayThread.joinable()) {
+        replayThread.join();
+    }
+    return ERR_OK;
+}
+
+int32_t ReplayConnection::RegSensorPlugCallback(DevicePlugCallback cb)
+{
+    return ERR_OK;
+}
+
+DevicePlugCallback ReplayConnection::GetSensorPlugCb()
+{
+    return NULL;
+}
+
+int32_t ReplayConnection::ConnectSensorTransformHdi()
+{
+    return ERR_OK;
+}
+
+int32_t ReplayConnection::TransformSensorData(uint32_t state, uint32_t policy, SensorData* sensorData)
+{
+    return ERR_OK;
+}
+
+void ReplayConnection::StartReplayLocked()
+{
+    // The service registers its callback long before anyone subscribes, and the events of disabled sensors are
+    // dropped, so a trace that does not loop would be used up before the first client could see any of it
+    if (isStop_ || replayThread_.joinable() || (reportDataCallback_ == nullptr) || enabledSensors_.empty()) {
+        return;
+    }
+    SEN_HILOGI("Start replay on first enable");
+    replayThread_ = std::thread(&ReplayConnection::ReplayThread, this);
+}
+
+void ReplayConnection::ReplayThread()
+{
+    CALL_LOG_ENTER;
+    prctl(PR_SET_NAME, SENSOR_REPLAY_THREAD_NAME.c_str());
+    SensorData data = {};
+    bool isPassStart = true;
+    int64_t traceStartTime = 0;
+    int64_t replayStartTime = 0;
+    uint64_t reportCount = 0;
+    while (!isStop_) {
+        if (!traceReader_.Next(data)) {
+            if (!isLoop_ || isPassStart) {
+                break;
+            }
+            traceReader_.Rewind();
+            isPassStart = true;
+            continue;
+        }
+        if (isPassStart) {
+            traceStartTime = data.timestamp;
+            replayStartTime = GetClockTimeNs(CLOCK_MONOTONIC);
+            isPassStart = false;
+        }
+        if ((speed_ > 0) && !WaitUntil(data.timestamp, traceStartTime, replayStartTime)) {
+            break;
+        }
+        if (IsSensorEnabled(data)) {
+            ReportSensorData(data);
+            ++reportCount;
+        }
+    }
+    SEN_HILOGI("Replay finished, reportCount:%{public}" PRIu64, reportCount);
+}
+
+bool ReplayConnection::WaitUntil(int64_t traceTime, int64_t traceStartTime, int64_t replayStartTime)
+{
+    int64_t targetTime = replayStartTime + (traceTime - traceStartTime) / speed_;
+    int64_t now = GetClockTimeNs(CLOCK_MONOTONIC);
+    while (now < targetTime) {
+        if (isStop_) {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::nanoseconds(std::min(targetTime - now, MAX_SLEEP_SLICE_NS)));
+        now = GetClockTimeNs(CLOCK_MONOTONIC);
+    }
+    return !isStop_;
+}
+
+bool ReplayConnection::IsSensorEnabled(const SensorData &data)
+{
+    std::lock_guard<std::mutex> enableLock(enableMutex_);
+    return enabledSensors_.find({data.deviceId, data.sensorTypeId, data.sensorId, data.location}) !=
+        enabledSensors_.end();
+}
+
+void ReplayConnection::ReportSensorData(SensorData &data)
+{
+    CHKPV(reportDataCallback_);
+    CHKPV(reportDataCb_);
+    data.timestamp = GetClockTimeNs(CLOCK_BOOTTIME);
+    std::unique_lock<std::mutex> lk(ISensorHdiConnection::dataMutex_);
+    (void)(reportDataCallback_->*reportDataCb_)(&data, reportDataCallback_);
+    ISensorHdiConnection::dataReady_.store(true);
+    ISensorHdiConnection::dataCondition_.notify_one();
+}
+} // namespace Sensors
+} // namespace OHOS
@@ -16,6 +16,12 @@
 #ifndef HDI_SERVICE_IMPL_H
 #define HDI_SERVICE_IMPL_H
 
+#include <condition_variable>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <random>
+#include <set>
 #include <thread>
 
 #include "sensor_agent_type.h"
@@ -24,10 +30,18 @@
 
 namespace OHOS {
 namespace Sensors {
+struct MockSensorConfig {
+    std::vector<int32_t> sensorTypes;  // Sensor types of each simulated device, empty advertises the accelerometer
+    int32_t deviceCount { 1 };         // The first device is local, the others are external and can be plugged
+    uint32_t seed { 0 };               // Seed of the data generator, 0 picks a random seed
+    int64_t plugInterval { 0 };        // Interval in ns to toggle one external device online or offline, 0 disables
+};
+using MockPlugCallback = std::function<void(const SensorInfo &sensorInfo, bool isOnline)>;
+
 class HdiServiceImpl : public Singleton<HdiServiceImpl> {
 public:
-    HdiServiceImpl() = default;
-    virtual ~HdiServiceImpl() {}
+    HdiServiceImpl();
+    virtual ~HdiServiceImpl();
     int32_t GetSensorList(std::vector<SensorInfo> &sensorList);
     int32_t GetSensorListByDevice(int32_t deviceId, std::vector<SensorInfo> &singleDevSensors);
     int32_t EnableSensor(const SensorDescription &sensorDesc);
@@ -36,22 +50,49 @@ public:
     int32_t SetMode(const SensorDescription &sensorDesc, int32_t mode);
     int32_t Register(RecordSensorCallback cb);
     int32_t Unregister();
+    int32_t RegisterPlugCallback(MockPlugCallback cb);
+    int32_t SetMockConfig(const MockSensorConfig &config);
+    int32_t SimulateDevicePlug(int32_t deviceId, bool isOnline);
 
 private:
     DISALLOW_COPY_AND_MOVE(HdiServiceImpl);
-    static void DataReportThread();
-    static void GenerateEvent();
-    static void GenerateAccelerometerEvent();
-    static void GenerateColorEvent();
-    static void GenerateSarEvent();
-    static void GenerateHeadPostureEvent();
-    static void GenerateProximityEvent();
-    static std::vector<int32_t> enableSensors_;
+    static constexpr uint32_t SENSOR_DATA_MAX_FLOAT_COUNT = 16;
+    struct MockSensorState {
+        int64_t samplingInterval { 0 };
+        int64_t reportInterval { 0 };
+        int64_t nextSampleTime { 0 };
+        int64_t nextReportTime { 0 };
+    };
+    struct MockEvent {
+        SensorEvent event;
+        float data[SENSOR_DATA_MAX_FLOAT_COUNT];
+    };
+    void LoadMockConfig();
+    void DataReportThread();
+    int64_t CollectDueEvents(int64_t now, std::vector<MockEvent> &events);
+    void CollectSensorEvents(const SensorDescription &sensorDesc, MockSensorState &state, int64_t now,
+        std::vector<MockEvent> &events);
+    uint32_t GenerateData(int32_t sensorType, float *data);
+    void GenerateAccelerometerData(float *data);
+    void GenerateHeadPostureData(float *data);
+    void GenerateUniformData(float *data, uint32_t count, float maxValue);
+    bool IsMockSensorType(int32_t sensorType);
+    bool IsSupportSensor(const SensorDescription &sensorDesc);
+    std::vector<SensorInfo> CreateDeviceSensorInfos(int32_t deviceId);
+    int32_t GetPlugDevice(int64_t now, bool &isOnline, int64_t &wakeTime);
+    std::mutex mockMutex_;
+    std::condition_variable stateCondition_;
+    MockSensorConfig config_;
+    std::set<int32_t> offlineDevices_;
+    std::map<SensorDescription, std::pair<int64_t, int64_t>> batchParams_;
+    std::map<SensorDescription, MockSensorState> enableSensors_;
+    std::vector<RecordSensorCallback> callbacks_;
+    MockPlugCallback plugCallback_ = nullptr;
+    std::mt19937 engine_;
     std::thread dataReportThread_;
-    static std::vector<RecordSensorCallback> callbacks_;
-    static int64_t samplingInterval_;
-    static int64_t reportInterval_;
-    static std::atomic_bool isStop_;
+    bool isStop_ { true };
+    int64_t nextPlugTime_ { 0 };
+    int32_t nextPlugDevice_ { 0 };
 };
 } // namespace Sensors
 } // namespace OHOS
@@ -14,9 +14,18 @@
  */
 #include "hdi_service_impl.h"
 
-#include <random>
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cinttypes>
+#include <cmath>
+#include <ctime>
+#include <sstream>
 #include <sys/prctl.h>
+#include <unordered_map>
 
+#include "parameters.h"
+#include "securec.h"
 #include "sensor_errors.h"
 
 #undef LOG_TAG
@@ -28,110 +37,149 @@ using namespace OHOS::HiviewDFX;
 
 namespace {
 constexpr int64_t SAMPLING_INTERVAL_NS = 200000000;
+constexpr int64_t MIN_SAMPLING_INTERVAL_NS = 10000;
+constexpr int64_t MAX_SAMPLING_INTERVAL_NS = 1000000000;
+constexpr int64_t MIN_WAIT_NS = 100000;
+constexpr int64_t NS_PER_SECOND = 1000000000;
+constexpr int64_t NS_PER_MS = 1000000;
+constexpr int64_t MAX_PLUG_INTERVAL_MS = 3600000;
+constexpr int64_t MAX_FIFO_EVENT_COUNT = 4096;
+constexpr int32_t MAX_DEVICE_COUNT = 8;
 constexpr float TARGET_SUM = 9.8F * 9.8F;
 constexpr float MAX_RANGE = 9999.0F;
+constexpr float RESOLUTION = 0.000001F;
+constexpr float POWER = 23.0F;
 constexpr int32_t DEFAULT_DEVICE_ID = -1;
 constexpr int32_t DEFAULT_SENSOR_ID = 0;
 constexpr int32_t IS_LOCAL_DEVICE = 1;
+constexpr int32_t IS_EXTERNAL_DEVICE = 0;
+constexpr int32_t DEFAULT_OPTION = 3;
+constexpr int32_t INVALID_DEVICE_ID = -2;
+constexpr uint32_t ACC_FLOAT_COUNT = 3;
+constexpr uint32_t HEAD_POSTURE_FLOAT_COUNT = 5;
+constexpr uint32_t DEFAULT_FLOAT_COUNT = 3;
 const std::string SENSOR_PRODUCE_THREAD_NAME = "OS_SenMock";
-std::vector<SensorInfo> g_sensorInfos = {
-    {"sensor_test", "default", "1.0.0", "1.0.0", 1, 1, 9999.0, 0.000001, 23.0, 100000000, 1000000000, -1, 1, 0},
+const std::string MOCK_TYPES_KEY = "sensors.mock.types";
+const std::string MOCK_DEVICE_COUNT_KEY = "sensors.mock.device.count";
+const std::string MOCK_SEED_KEY = "sensors.mock.seed";
+const std::string MOCK_PLUG_INTERVAL_KEY = "sensors.mock.plug.interval";
+// Advertised when sensors.mock.types is not set, list more types there to simulate a richer device
+const std::vector<int32_t> DEFAULT_SENSOR_TYPES = {
+    SENSOR_TYPE_ID_ACCELEROMETER
 };
-std::vector<int32_t> g_supportSensors = {
+// SensorHdiConnection routes these types to the mock when the real hdi lacks them, so they can always be enabled
+const std::vector<int32_t> COMPATIBLE_SENSOR_TYPES = {
     SENSOR_TYPE_ID_ACCELEROMETER,
     SENSOR_TYPE_ID_COLOR,
     SENSOR_TYPE_ID_SAR,
     SENSOR_TYPE_ID_HEADPOSTURE,
     SENSOR_TYPE_ID_PROXIMITY1
 };
-float g_accData[3];
-float g_colorData[2];
-float g_sarData[1];
-float g_headPostureData[5];
-float g_proximityData[1];
-SensorEvent g_accEvent = {
-    .sensorTypeId = SENSOR_TYPE_ID_ACCELEROMETER,
-    .option = 3,
-    .dataLen = 12,
-    .deviceId = DEFAULT_DEVICE_ID,
-    .sensorId = DEFAULT_SENSOR_ID,
-    .location = IS_LOCAL_DEVICE
-};
-SensorEvent g_colorEvent = {
-    .sensorTypeId = SENSOR_TYPE_ID_COLOR,
-    .option = 3,
-    .dataLen = 8,
-    .deviceId = DEFAULT_DEVICE_ID,
-    .sensorId = DEFAULT_SENSOR_ID,
-    .location = IS_LOCAL_DEVICE
-};
-SensorEvent g_sarEvent = {
-    .sensorTypeId = SENSOR_TYPE_ID_SAR,
-    .option = 3,
-    .dataLen = 4,
-    .deviceId = DEFAULT_DEVICE_ID,
-    .sensorId = DEFAULT_SENSOR_ID,
-    .location = IS_LOCAL_DEVICE
-};
-SensorEvent g_headPostureEvent = {
-    .sensorTypeId = SENSOR_TYPE_ID_HEADPOSTURE,
-    .option = 3,
-    .dataLen = 20,
-    .deviceId = DEFAULT_DEVICE_ID,
-    .sensorId = DEFAULT_SENSOR_ID,
-    .location = IS_LOCAL_DEVICE
-};
-SensorEvent g_proximityEvent = {
-    .sensorTypeId = SENSOR_TYPE_ID_PROXIMITY1,
-    .option = 3,
-    .dataLen = 4,
-    .deviceId = DEFAULT_DEVICE_ID,
-    .sensorId = DEFAULT_SENSOR_ID,
-    .location = IS_LOCAL_DEVICE
+const std::unordered_map<int32_t, uint32_t> DATA_FLOAT_COUNTS = {
+    { SENSOR_TYPE_ID_ACCELEROMETER, ACC_FLOAT_COUNT },
+    { SENSOR_TYPE_ID_COLOR, 2 },
+    { SENSOR_TYPE_ID_SAR, 1 },
+    { SENSOR_TYPE_ID_HEADPOSTURE, HEAD_POSTURE_FLOAT_COUNT },
+    { SENSOR_TYPE_ID_PROXIMITY1, 1 },
+    { SENSOR_TYPE_ID_AMBIENT_LIGHT, 2 },
+    { SENSOR_TYPE_ID_BAROMETER, 1 },
 };
+
+int64_t GetBootTimeNs()
+{
+    struct timespec ts = { 0, 0 };
+    clock_gettime(CLOCK_BOOTTIME, &ts);
+    return static_cast<int64_t>(ts.tv_sec) * NS_PER_SECOND + ts.tv_nsec;
+}
+
+std::vector<int32_t> ParseSensorTypes(const std::string &sensorTypes)
+{
+    std::vector<int32_t> result;
+    std::stringstream stream(sensorTypes);
+    std::string item;
+    while (std::getline(stream, item, ',')) {
+        int32_t sensorType = 0;
+        auto res = std::from_chars(item.data(), item.data() + item.size(), sensorType);
+        if (res.ec != std::errc() || sensorType <= 0) {
+            SEN_HILOGW("Ignore invalid sensor type %{public}s", item.c_str());
+            continue;
+        }
+        result.push_back(sensorType);
+    }
+    return result;
+}
 } // namespace
-std::vector<int32_t> HdiServiceImpl::enableSensors_;
-std::vector<RecordSensorCallback> HdiServiceImpl::callbacks_;
-int64_t HdiServiceImpl::samplingInterval_ = -1;
-int64_t HdiServiceImpl::reportInterval_ = -1;
-std::atomic_bool HdiServiceImpl::isStop_ = false;
 
-void HdiServiceImpl::GenerateEvent()
+HdiServiceImpl::HdiServiceImpl()
 {
-    for (const auto &sensorType : enableSensors_) {
-        switch (sensorType) {
-            case SENSOR_TYPE_ID_ACCELEROMETER:
-                GenerateAccelerometerEvent();
-                break;
-            case SENSOR_TYPE_ID_COLOR:
-                GenerateColorEvent();
-                break;
-            case SENSOR_TYPE_ID_SAR:
-                GenerateSarEvent();
-                break;
-            case SENSOR_TYPE_ID_HEADPOSTURE:
-                GenerateHeadPostureEvent();
-                break;
-            case SENSOR_TYPE_ID_PROXIMITY1:
-                GenerateProximityEvent();
-                break;
-            default:
-                SEN_HILOGW("Unknown sensorType:%{public}d", sensorType);
-                break;
+    LoadMockConfig();
+}
+
+HdiServiceImpl::~HdiServiceImpl()
+{
+    Unregister();
+}
+
+void HdiServiceImpl::LoadMockConfig()
+{
+    MockSensorConfig config;
+    config.sensorTypes = ParseSensorTypes(OHOS::system::GetParameter(MOCK_TYPES_KEY, ""));
+    config.deviceCount = OHOS::system::GetIntParameter<int32_t>(MOCK_DEVICE_COUNT_KEY, 1, 1, MAX_DEVICE_COUNT);
+    config.seed = OHOS::system::GetUintParameter<uint32_t>(MOCK_SEED_KEY, 0);
+    config.plugInterval =
+        OHOS::system::GetIntParameter<int64_t>(MOCK_PLUG_INTERVAL_KEY, 0, 0, MAX_PLUG_INTERVAL_MS) * NS_PER_MS;
+    if (SetMockConfig(config) != ERR_OK) {
+        SEN_HILOGE("Set mock config failed");
+    }
+}
+
+int32_t HdiServiceImpl::SetMockConfig(const MockSensorConfig &config)
+{
+    CALL_LOG_ENTER;
+    if ((config.deviceCount < 1) || (config.deviceCount > MAX_DEVICE_COUNT) || (config.plugInterval < 0)) {
+        SEN_HILOGE("Invalid mock config, deviceCount:%{public}d", config.deviceCount);
+        return ERR_INVALID_VALUE;
+    }
+    std::lock_guard<std::mutex> mockLock(mockMutex_);
+    config_ = config;
+    if (config_.sensorTypes.empty()) {
+        config_.sensorTypes = DEFAULT_SENSOR_TYPES;
+    }
+    engine_.seed((config_.seed != 0) ? config_.seed : std::random_device()());
+    offlineDevices_.clear();
+    nextPlugTime_ = 0;
+    nextPlugDevice_ = 1;
+    SEN_HILOGI("sensorTypeCount:%{public}zu, deviceCount:%{public}d, seed:%{public}u, plugInterval:%{public}" PRId64,
+        config_.sensorTypes.size(), config_.deviceCount, config_.seed, config_.plugInterval);
+    return ERR_OK;
+}
+
+uint32_t HdiServiceImpl::GenerateData(int32_t sensorType, float *data)
+{
+    switch (sensorType) {
+        case SENSOR_TYPE_ID_ACCELEROMETER:
+            GenerateAccelerometerData(data);
+            return ACC_FLOAT_COUNT;
+        case SENSOR_TYPE_ID_HEADPOSTURE:
+            GenerateHeadPostureData(data);
+            return HEAD_POSTURE_FLOAT_COUNT;
+        default: {
+            auto it = DATA_FLOAT_COUNTS.find(sensorType);
+            uint32_t count = (it != DATA_FLOAT_COUNTS.end()) ? it->second : DEFAULT_FLOAT_COUNT;
+            GenerateUniformData(data, count, MAX_RANGE);
+            return count;
         }
     }
 }
 
-void HdiServiceImpl::GenerateAccelerometerEvent()
+void HdiServiceImpl::GenerateAccelerometerData(float *data)
 {
-    std::random_device rd;
-    std::default_random_engine eng(rd());
     std::uniform_real_distribution<float> distr(0.0, TARGET_SUM);
     float num1 = 0.0;
     float num2 = 0.0;
     while (true) {
-        num1 = distr(eng);
-        num2 = distr(eng);
+        num1 = distr(engine_);
+        num2 = distr(engine_);
         if ((num1 > num2) && (std::fabs(num1 - num2) > std::numeric_limits<float>::epsilon())) {
             float temp = num1;
             num1 = num2;
@@ -139,173 +187,265 @@ void HdiServiceImpl::GenerateAccelerometerEvent()
             break;
         }
     }
-    g_accData[0] = static_cast<float>(sqrt(num1));
-    g_accData[1] = static_cast<float>(sqrt(num2 - num1));
-    g_accData[2] = static_cast<float>(sqrt(TARGET_SUM - num2));
-    g_accEvent.data = reinterpret_cast<uint8_t *>(g_accData);
-}
-
-void HdiServiceImpl::GenerateColorEvent()
-{
-    std::random_device rd;
-    std::default_random_engine eng(rd());
-    std::uniform_real_distribution<float> distr(0.0, MAX_RANGE);
-    g_colorData[0] = distr(eng);
-    g_colorData[1] = distr(eng);
-    g_colorEvent.data = reinterpret_cast<uint8_t *>(g_colorData);
+    data[0] = static_cast<float>(sqrt(num1));
+    data[1] = static_cast<float>(sqrt(num2 - num1));
+    data[2] = static_cast<float>(sqrt(TARGET_SUM - num2));
 }
 
-void HdiServiceImpl::GenerateSarEvent()
+void HdiServiceImpl::GenerateUniformData(float *data, uint32_t count, float maxValue)
 {
-    std::random_device rd;
-    std::default_random_engine eng(rd());
-    std::uniform_real_distribution<float> distr(0.0, MAX_RANGE);
-    g_sarData[0] = distr(eng);
-    g_sarEvent.data = reinterpret_cast<uint8_t *>(g_sarData);
+    std::uniform_real_distribution<float> distr(0.0, maxValue);
+    for (uint32_t i = 0; i < count; ++i) {
+        data[i] = distr(engine_);
+    }
 }
 
-void HdiServiceImpl::GenerateHeadPostureEvent()
+void HdiServiceImpl::GenerateHeadPostureData(float *data)
 {
-    std::random_device rd;
-    std::default_random_engine eng(rd());
     std::uniform_real_distribution<float> distr(0.0, 1.0);
-    std::vector<float> nums(4);
+    std::array<float, 4> nums = {};
     while (true) {
-        nums[0] = distr(eng);
-        nums[1] = distr(eng);
-        nums[2] = distr(eng);
-        nums[3] = distr(eng);
-        sort(nums.begin(), nums.end());
+        nums[0] = distr(engine_);
+        nums[1] = distr(engine_);
+        nums[2] = distr(engine_);
+        nums[3] = distr(engine_);
+        std::sort(nums.begin(), nums.end());
         if ((std::fabs(nums[1] - nums[0]) > std::numeric_limits<float>::epsilon()) &&
             (std::fabs(nums[2] - nums[1]) > std::numeric_limits<float>::epsilon()) &&
             (std::fabs(nums[3] - nums[2]) > std::numeric_limits<float>::epsilon())) {
             break;
         }
     }
-    g_headPostureData[0] = static_cast<float>(sqrt(nums[0]));
-    g_headPostureData[1] = static_cast<float>(sqrt(nums[1] - nums[0]));
-    g_headPostureData[2] = static_cast<float>(sqrt(nums[2] - nums[1]));
-    g_headPostureData[3] = static_cast<float>(sqrt(nums[3] - nums[2]));
-    g_headPostureData[4] = static_cast<float>(sqrt(1.0 - nums[3]));
-    g_headPostureEvent.data = reinterpret_cast<uint8_t *>(g_headPostureData);
+    data[0] = static_cast<float>(sqrt(nums[0]));
+    data[1] = static_cast<float>(sqrt(nums[1] - nums[0]));
+    data[2] = static_cast<float>(sqrt(nums[2] - nums[1]));
+    data[3] = static_cast<float>(sqrt(nums[3] - nums[2]));
+    data[4] = static_cast<float>(sqrt(1.0 - nums[3]));
 }
 
-void HdiServiceImpl::GenerateProximityEvent()
+std::vector<SensorInfo> HdiServiceImpl::CreateDeviceSensorInfos(int32_t deviceId)
 {
-    std::random_device rd;
-    std::default_random_engine eng(rd());
-    std::uniform_real_distribution<float> distr(0.0, MAX_RANGE);
-    g_proximityData[0] = distr(eng);
-    g_proximityEvent.data = reinterpret_cast<uint8_t *>(g_proximityData);
+    std::vector<SensorInfo> sensorInfos;
+    for (const auto &sensorType : config_.sensorTypes) {
+        SensorInfo sensorInfo;
+        if ((strcpy_s(sensorInfo.sensorName, NAME_MAX_LEN, "sensor_test") != EOK) ||
+            (strcpy_s(sensorInfo.vendorName, NAME_MAX_LEN, "default") != EOK) ||
+            (strcpy_s(sensorInfo.firmwareVersion, VERSION_MAX_LEN, "1.0.0") != EOK) ||
+            (strcpy_s(sensorInfo.hardwareVersion, VERSION_MAX_LEN, "1.0.0") != EOK)) {
+            SEN_HILOGE("strcpy_s failed");
+            continue;
+        }
+        sensorInfo.sensorTypeId = sensorType;
+        sensorInfo.sensorId = DEFAULT_SENSOR_ID;
+        sensorInfo.maxRange = MAX_RANGE;
+        sensorInfo.precision = RESOLUTION;
+        sensorInfo.power = POWER;
+        sensorInfo.minSamplePeriod = MIN_SAMPLING_INTERVAL_NS;
+        sensorInfo.maxSamplePeriod = MAX_SAMPLING_INTERVAL_NS;
+        sensorInfo.deviceId = deviceId;
+        sensorInfo.location = (deviceId == DEFAULT_DEVICE_ID) ? IS_LOCAL_DEVICE : IS_EXTERNAL_DEVICE;
+        sensorInfo.sensorIndex = DEFAULT_SENSOR_ID;
+        sensorInfo.isMockSensor = true;
+        sensorInfos.push_back(sensorInfo);
+    }
+    return sensorInfos;
 }
 
 int32_t HdiServiceImpl::GetSensorList(std::vector<SensorInfo> &sensorList)
 {
     CALL_LOG_ENTER;
-    sensorList.assign(g_sensorInfos.begin(), g_sensorInfos.end());
+    std::lock_guard<std::mutex> mockLock(mockMutex_);
+    sensorList.clear();
+    for (int32_t i = 0; i < config_.deviceCount; ++i) {
+        int32_t deviceId = (i == 0) ? DEFAULT_DEVICE_ID : i;
+        if (offlineDevices_.find(deviceId) != offlineDevices_.end()) {
+            continue;
+        }
+        std::vector<SensorInfo> sensorInfos = CreateDeviceSensorInfos(deviceId);
+        sensorList.insert(sensorList.end(), sensorInfos.begin(), sensorInfos.end());
+    }
     return ERR_OK;
 }
 
 int32_t HdiServiceImpl::GetSensorListByDevice(int32_t deviceId, std::vector<SensorInfo> &singleDevSensors)
 {
     CALL_LOG_ENTER;
-    singleDevSensors.assign(g_sensorInfos.begin(), g_sensorInfos.end());
-    for (auto& sensor : singleDevSensors) {
-        sensor.deviceId = deviceId;
+    std::lock_guard<std::mutex> mockLock(mockMutex_);
+    if (offlineDevices_.find(deviceId) != offlineDevices_.end()) {
+        SEN_HILOGW("deviceId:%{public}d is offline", deviceId);
+        singleDevSensors.clear();
+        return ERR_OK;
     }
+    singleDevSensors = CreateDeviceSensorInfos(deviceId);
     return ERR_OK;
 }
 
+int64_t HdiServiceImpl::CollectDueEvents(int64_t now, std::vector<MockEvent> &events)
+{
+    int64_t wakeTime = std::numeric_limits<int64_t>::max();
+    for (auto &[sensorDesc, state] : enableSensors_) {
+        int64_t dueTime = (state.reportInterval > 0) ? state.nextReportTime : state.nextSampleTime;
+        if (dueTime <= now) {
+            CollectSensorEvents(sensorDesc, state, now, events);
+            dueTime = (state.reportInterval > 0) ? state.nextReportTime : state.nextSampleTime;
+        }
+        wakeTime = std::min(wakeTime, dueTime);
+    }
+    return wakeTime;
+}
+
+void HdiServiceImpl::CollectSensorEvents(const SensorDescription &sensorDesc, MockSensorState &state, int64_t now,
+    std::vector<MockEvent> &events)
+{
+    // All samples taken since the last report are delivered at once, like a hardware FIFO flush
+    int64_t pendingCount = (state.nextSampleTime <= now) ?
+        ((now - state.nextSampleTime) / state.samplingInterval + 1) : 0;
+    if (pendingCount > MAX_FIFO_EVENT_COUNT) {
+        state.nextSampleTime += (pendingCount - MAX_FIFO_EVENT_COUNT) * state.samplingInterval;
+        pendingCount = MAX_FIFO_EVENT_COUNT;
+    }
+    for (int64_t i = 0; i < pendingCount; ++i) {
+        MockEvent &mockEvent = events.emplace_back();
+        mockEvent.event.sensorTypeId = sensorDesc.sensorType;
+        mockEvent.event.timestamp = state.nextSampleTime;
+        mockEvent.event.option = DEFAULT_OPTION;
+        mockEvent.event.dataLen =
+            static_cast<uint32_t>(GenerateData(sensorDesc.sensorType, mockEvent.data) * sizeof(float));
+        mockEvent.event.deviceId = sensorDesc.deviceId;
+        mockEvent.event.sensorId = sensorDesc.sensorId;
+        mockEvent.event.location = sensorDesc.location;
+        state.nextSampleTime += state.samplingInterval;
+    }
+    if (state.reportInterval > 0) {
+        state.nextReportTime += state.reportInterval;
+        if (state.nextReportTime <= now) {
+            state.nextReportTime = now + state.reportInterval;
+        }
+    }
+}
+
+int32_t HdiServiceImpl::GetPlugDevice(int64_t now, bool &isOnline, int64_t &wakeTime)
+{
+    if ((config_.plugInterval <= 0) || (config_.deviceCount <= 1)) {
+        return INVALID_DEVICE_ID;
+    }
+    if (nextPlugTime_ == 0) {
+        nextPlugTime_ = now + config_.plugInterval;
+    }
+    if (now < nextPlugTime_) {
+        wakeTime = std::min(wakeTime, nextPlugTime_);
+        return INVALID_DEVICE_ID;
+    }
+    nextPlugTime_ = now + config_.plugInterval;
+    wakeTime = std::min(wakeTime, nextPlugTime_);
+    int32_t deviceId = nextPlugDevice_;
+    nextPlugDevice_ = nextPlugDevice_ % (config_.deviceCount - 1) + 1;
+    isOnline = offlineDevices_.find(deviceId) != offlineDevices_.end();
+    return deviceId;
+}
+
 void HdiServiceImpl::DataReportThread()
 {
     CALL_LOG_ENTER;
     prctl(PR_SET_NAME, SENSOR_PRODUCE_THREAD_NAME.c_str());
+    std::vector<MockEvent> events;
+    std::vector<RecordSensorCallback> callbacks;
     while (true) {
-        GenerateEvent();
-        std::this_thread::sleep_for(std::chrono::nanoseconds(samplingInterval_));
-        for (const auto &it : callbacks_) {
-            if (it == nullptr) {
-                SEN_HILOGW("RecordSensorCallback is null");
-                continue;
+        bool isOnline = false;
+        int32_t plugDeviceId = INVALID_DEVICE_ID;
+        {
+            std::unique_lock<std::mutex> mockLock(mockMutex_);
+            if (isStop_) {
+                break;
             }
-            for (const auto &sensorType : enableSensors_) {
-                switch (sensorType) {
-                    case SENSOR_TYPE_ID_ACCELEROMETER:
-                        it(&g_accEvent);
-                        break;
-                    case SENSOR_TYPE_ID_COLOR:
-                        it(&g_colorEvent);
-                        break;
-                    case SENSOR_TYPE_ID_SAR:
-                        it(&g_sarEvent);
-                        break;
-                    case SENSOR_TYPE_ID_HEADPOSTURE:
-                        it(&g_headPostureEvent);
-                        break;
-                    case SENSOR_TYPE_ID_PROXIMITY1:
-                        it(&g_proximityEvent);
-                        break;
-                    default:
-                        SEN_HILOGW("Unknown sensorType:%{public}d", sensorType);
-                        break;
+            int64_t now = GetBootTimeNs();
+            int64_t wakeTime = CollectDueEvents(now, events);
+            plugDeviceId = GetPlugDevice(now, isOnline, wakeTime);
+            if (events.empty() && (plugDeviceId == INVALID_DEVICE_ID)) {
+                if (wakeTime == std::numeric_limits<int64_t>::max()) {
+                    stateCondition_.wait(mockLock);
+                } else {
+                    // High rates are reported in bursts rather than with one wakeup per sample
+                    int64_t waitTime = std::max(wakeTime - now, MIN_WAIT_NS);
+                    stateCondition_.wait_for(mockLock, std::chrono::nanoseconds(waitTime));
                 }
+                continue;
             }
+            callbacks = callbacks_;
         }
-        if (isStop_) {
-            break;
+        for (auto &mockEvent : events) {
+            mockEvent.event.data = reinterpret_cast<uint8_t *>(mockEvent.data);
+            for (const auto &it : callbacks) {
+                it(&mockEvent.event);
+            }
+        }
+        events.clear();
+        if (plugDeviceId != INVALID_DEVICE_ID) {
+            SimulateDevicePlug(plugDeviceId, isOnline);
         }
     }
     SEN_HILOGI("Thread stop");
-    return;
+}
+
+bool HdiServiceImpl::IsMockSensorType(int32_t sensorType)
+{
+    return (std::find(config_.sensorTypes.begin(), config_.sensorTypes.end(), sensorType) !=
+        config_.sensorTypes.end()) || (std::find(COMPATIBLE_SENSOR_TYPES.begin(), COMPATIBLE_SENSOR_TYPES.end(),
+        sensorType) != COMPATIBLE_SENSOR_TYPES.end());
+}
+
+bool HdiServiceImpl::IsSupportSensor(const SensorDescription &sensorDesc)
+{
+    return IsMockSensorType(sensorDesc.sensorType) &&
+        (offlineDevices_.find(sensorDesc.deviceId) == offlineDevices_.end());
 }
 
 int32_t HdiServiceImpl::EnableSensor(const SensorDescription &sensorDesc)
 {
     CALL_LOG_ENTER;
-    if (std::find(g_supportSensors.begin(), g_supportSensors.end(), sensorDesc.sensorType) == g_supportSensors.end()) {
-        SEN_HILOGE("Not support enable sensorType:%{public}d", sensorDesc.sensorType);
+    std::lock_guard<std::mutex> mockLock(mockMutex_);
+    if (!IsSupportSensor(sensorDesc)) {
+        SEN_HILOGE("Not support enable deviceIndex:%{public}d, sensorType:%{public}d",
+            sensorDesc.deviceId, sensorDesc.sensorType);
         return ERR_NO_INIT;
     }
-    if (std::find(enableSensors_.begin(), enableSensors_.end(), sensorDesc.sensorType) != enableSensors_.end()) {
+    if (enableSensors_.find(sensorDesc) != enableSensors_.end()) {
         SEN_HILOGI("sensorType:%{public}d has been enabled", sensorDesc.sensorType);
         return ERR_OK;
     }
-    enableSensors_.push_back(sensorDesc.sensorType);
-    if (!dataReportThread_.joinable() || isStop_) {
-        if (dataReportThread_.joinable()) {
-            dataReportThread_.join();
-        }
-        std::thread senocdDataThread(HdiServiceImpl::DataReportThread);
-        dataReportThread_ = std::move(senocdDataThread);
+    MockSensorState state;
+    state.samplingInterval = SAMPLING_INTERVAL_NS;
+    auto it = batchParams_.find(sensorDesc);
+    if (it != batchParams_.end()) {
+        state.samplingInterval = it->second.first;
+        state.reportInterval = it->second.second;
+    }
+    int64_t now = GetBootTimeNs();
+    state.nextSampleTime = now + state.samplingInterval;
+    state.nextReportTime = now + state.reportInterval;
+    enableSensors_.emplace(sensorDesc, state);
+    if (!dataReportThread_.joinable()) {
         isStop_ = false;
+        dataReportThread_ = std::thread(&HdiServiceImpl::DataReportThread, this);
     }
+    stateCondition_.notify_one();
     return ERR_OK;
 };
 
 int32_t HdiServiceImpl::DisableSensor(const SensorDescription &sensorDesc)
 {
     CALL_LOG_ENTER;
-    if (std::find(g_supportSensors.begin(), g_supportSensors.end(), sensorDesc.sensorType) == g_supportSensors.end()) {
+    std::lock_guard<std::mutex> mockLock(mockMutex_);
+    if (!IsMockSensorType(sensorDesc.sensorType)) {
         SEN_HILOGE("Not support disable deviceIndex:%{public}d, sensortypeId:%{public}d, sensorId:%{public}d",
             sensorDesc.deviceId, sensorDesc.sensorType, sensorDesc.sensorId);
         return ERR_NO_INIT;
     }
-    if (std::find(enableSensors_.begin(), enableSensors_.end(), sensorDesc.sensorType) == enableSensors_.end()) {
+    if (enableSensors_.erase(sensorDesc) == 0) {
         SEN_HILOGE("sensorType:%{public}d should be enable first", sensorDesc.sensorType);
         return ERR_NO_INIT;
     }
-    std::vector<int32_t>::iterator iter;
-    for (iter = enableSensors_.begin(); iter != enableSensors_.end();) {
-        if (*iter == sensorDesc.sensorType) {
-            iter = enableSensors_.erase(iter);
-            break;
-        } else {
-            ++iter;
-        }
-    }
-    if (enableSensors_.empty()) {
-        isStop_ = true;
-    }
+    stateCondition_.notify_one();
     return ERR_OK;
 }
 
@@ -316,8 +456,18 @@ int32_t HdiServiceImpl::SetBatch(const SensorDescription &sensorDesc, int64_t sa
         samplingInterval = SAMPLING_INTERVAL_NS;
         reportInterval = 0;
     }
-    samplingInterval_ = samplingInterval;
-    reportInterval_ = reportInterval;
+    samplingInterval = std::clamp(samplingInterval, MIN_SAMPLING_INTERVAL_NS, MAX_SAMPLING_INTERVAL_NS);
+    std::lock_guard<std::mutex> mockLock(mockMutex_);
+    batchParams_[sensorDesc] = std::make_pair(samplingInterval, reportInterval);
+    auto it = enableSensors_.find(sensorDesc);
+    if (it != enableSensors_.end()) {
+        int64_t now = GetBootTimeNs();
+        it->second.samplingInterval = samplingInterval;
+        it->second.reportInterval = reportInterval;
+        it->second.nextSampleTime = now + samplingInterval;
+        it->second.nextReportTime = now + reportInterval;
+        stateCondition_.notify_one();
+    }
     return ERR_OK;
 }
 
@@ -329,13 +479,68 @@ int32_t HdiServiceImpl::SetMode(const SensorDescription &sensorDesc, int32_t mod
 int32_t HdiServiceImpl::Register(RecordSensorCallback cb)
 {
     CHKPR(cb, ERROR);
+    std::lock_guard<std::mutex> mockLock(mockMutex_);
     callbacks_.push_back(cb);
     return ERR_OK;
 }
 
 int32_t HdiServiceImpl::Unregister()
 {
-    isStop_ = true;
+    std::thread dataReportThread;
+    {
+        std::lock_guard<std::mutex> mockLock(mockMutex_);
+        isStop_ = true;
+        dataReportThread = std::move(dataReportThread_);
+        stateCondition_.notify_one();
+    }
+    if (dataReportThread.joinable()) {
+        dataReportThread.join();
+    }
+    return ERR_OK;
+}
+
+int32_t HdiServiceImpl::RegisterPlugCallback(MockPlugCallback cb)
+{
+    CHKPR(cb, ERROR);
+    std::lock_guard<std::mutex> mockLock(mockMutex_);
+    plugCallback_ = cb;
+    return ERR_OK;
+}
+
+int32_t HdiServiceImpl::SimulateDevicePlug(int32_t deviceId, bool isOnline)
+{
+    CALL_LOG_ENTER;
+    std::vector<SensorInfo> sensorInfos;
+    MockPlugCallback plugCallback = nullptr;
+    {
+        std::lock_guard<std::mutex> mockLock(mockMutex_);
+        if ((deviceId <= 0) || (deviceId >= config_.deviceCount)) {
+            SEN_HILOGE("Only external mock devices can be plugged, deviceId:%{public}d", deviceId);
+            return ERR_INVALID_VALUE;
+        }
+        bool isOffline = offlineDevices_.find(deviceId) != offlineDevices_.end();
+        if (isOnline != isOffline) {
+            SEN_HILOGI("deviceId:%{public}d is already %{public}s", deviceId, isOnline ? "online" : "offline");
+            return ERR_OK;
+        }
+        if (isOnline) {
+            offlineDevices_.erase(deviceId);
+        } else {
+            offlineDevices_.insert(deviceId);
+            for (auto it = enableSensors_.begin(); it != enableSensors_.end();) {
+                it = (it->first.deviceId == deviceId) ? enableSensors_.erase(it) : std::next(it);
+            }
+        }
+        sensorInfos = CreateDeviceSensorInfos(deviceId);
+        plugCallback = plugCallback_;
+    }
+    SEN_HILOGI("deviceId:%{public}d is %{public}s", deviceId, isOnline ? "online" : "offline");
+    if (plugCallback == nullptr) {
+        return ERR_OK;
+    }
+    for (const auto &sensorInfo : sensorInfos) {
+        plugCallback(sensorInfo, isOnline);
+    }
     return ERR_OK;
 }
 } // namespace Sensors
@@ -50,10 +50,14 @@ private:
     std::vector<Sensor> sensorList_;
     std::unordered_set<int32_t> sensorSet_;
     std::unordered_set<int32_t> mockSet_;
+    std::unordered_set<int32_t> mockDeviceSet_;
     int32_t ConnectHdiService();
     int32_t ConnectCompatibleHdi();
+    int32_t ConnectReplayHdi(const std::string &tracePath);
     bool FindAllInSensorSet(const std::unordered_set<int32_t> &sensors);
-    bool FindOneInMockSet(int32_t sensorType);
+    bool IsRoutedToMock(const SensorDescription &sensorDesc);
+    bool IsMockDevice(int32_t deviceId);
+    void ReportMockDevicePlug(const SensorPlugInfo &info, DevicePlugCallback cb);
     Sensor GenerateColorSensor();
     Sensor GenerateSarSensor();
     Sensor GenerateHeadPostureSensor();
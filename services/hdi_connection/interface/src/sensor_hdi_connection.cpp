@@ -16,6 +16,8 @@
 
 #ifdef BUILD_VARIANT_ENG
 #include "compatible_connection.h"
+#include "parameters.h"
+#include "replay_connection.h"
 #endif // BUILD_VARIANT_ENG
 
 #include "hdi_connection.h"
@@ -51,6 +53,10 @@ constexpr int32_t IS_LOCAL_DEVICE = 1;
 constexpr int32_t DEFAULT_SENSORID = 0;
 constexpr int32_t DEFAULT_LOCATION = 1;
 static int32_t localDeviceId_ = -1;
+const std::string TRACE_REPLAY_PATH_KEY = "sensors.trace.replay.path";
+const std::string TRACE_REPLAY_SPEED_KEY = "sensors.trace.replay.speed";
+const std::string TRACE_REPLAY_LOOP_KEY = "sensors.trace.replay.loop";
+constexpr int32_t DEFAULT_REPLAY_SPEED = 1;
 #endif // BUILD_VARIANT_ENG
 constexpr uint32_t CONVERT_ROTATION_270 = 3;
 constexpr uint32_t CONVERT_ROTATION_0 = 0;
@@ -59,6 +65,12 @@ constexpr int32_t HDI_DISABLE_SENSOR_TIMEOUT = -23;
 
 int32_t SensorHdiConnection::ConnectHdi()
 {
+#ifdef BUILD_VARIANT_ENG
+    std::string tracePath = OHOS::system::GetParameter(TRACE_REPLAY_PATH_KEY, "");
+    if (!tracePath.empty()) {
+        return ConnectReplayHdi(tracePath);
+    }
+#endif // BUILD_VARIANT_ENG
     iSensorHdiConnection_ = std::make_unique<HdiConnection>();
     int32_t ret = ConnectHdiService();
     if (ret != ERR_OK) {
@@ -133,6 +145,21 @@ int32_t SensorHdiConnection::ConnectHdiService()
 }
 
 #ifdef BUILD_VARIANT_ENG
+int32_t SensorHdiConnection::ConnectReplayHdi(const std::string &tracePath)
+{
+    int32_t speed = OHOS::system::GetIntParameter(TRACE_REPLAY_SPEED_KEY, DEFAULT_REPLAY_SPEED);
+    bool isLoop = OHOS::system::GetBoolParameter(TRACE_REPLAY_LOOP_KEY, false);
+    SEN_HILOGI("Replay sensor trace instead of connecting hdi");
+    iSensorHdiConnection_ = std::make_unique<ReplayConnection>(tracePath, speed, isLoop);
+    int32_t ret = ConnectHdiService();
+    if (ret != ERR_OK) {
+        SEN_HILOGE("Connect replay connection failed, ret:%{public}d", ret);
+        return ret;
+    }
+    hdiConnectionStatus_ = false;
+    return ERR_OK;
+}
+
 int32_t SensorHdiConnection::ConnectCompatibleHdi()
 {
     if (iSensorCompatibleHdiConnection_ == nullptr) {
@@ -159,10 +186,32 @@ bool SensorHdiConnection::FindAllInSensorSet(const std::unordered_set<int32_t> &
     return count == 0 ? true : false;
 }
 
-bool SensorHdiConnection::FindOneInMockSet(int32_t sensorType)
+bool SensorHdiConnection::IsRoutedToMock(const SensorDescription &sensorDesc)
 {
     std::lock_guard<std::mutex> sensorLock(sensorMutex_);
-    return mockSet_.find(sensorType) != mockSet_.end();
+    return (mockSet_.find(sensorDesc.sensorType) != mockSet_.end()) ||
+        (mockDeviceSet_.find(sensorDesc.deviceId) != mockDeviceSet_.end());
+}
+
+bool SensorHdiConnection::IsMockDevice(int32_t deviceId)
+{
+    std::lock_guard<std::mutex> sensorLock(sensorMutex_);
+    return mockDeviceSet_.find(deviceId) != mockDeviceSet_.end();
+}
+
+void SensorHdiConnection::ReportMockDevicePlug(const SensorPlugInfo &info, DevicePlugCallback cb)
+{
+    int32_t deviceId = info.deviceSensorInfo.deviceId;
+    {
+        std::lock_guard<std::mutex> sensorLock(sensorMutex_);
+        if (deviceId == localDeviceId_) {
+            SEN_HILOGW("Mock deviceId:%{public}d is the local device, ignore it", deviceId);
+            return;
+        }
+        // The simulated devices only exist in the mock, later calls for them must not reach the real hdi
+        mockDeviceSet_.insert(deviceId);
+    }
+    cb(info);
 }
 
 Sensor SensorHdiConnection::GenerateColorSensor()
@@ -290,7 +339,7 @@ int32_t SensorHdiConnection::EnableSensor(const SensorDescription &sensorDesc)
 #endif // HIVIEWDFX_HITRACE_ENABLE
     int32_t ret = ENABLE_SENSOR_ERR;
 #ifdef BUILD_VARIANT_ENG
-    if (FindOneInMockSet(sensorDesc.sensorType)) {
+    if (IsRoutedToMock(sensorDesc)) {
         CHKPR(iSensorCompatibleHdiConnection_, ENABLE_SENSOR_ERR);
         ret = iSensorCompatibleHdiConnection_->EnableSensor(sensorDesc);
 #ifdef HIVIEWDFX_HITRACE_ENABLE
@@ -325,7 +374,7 @@ int32_t SensorHdiConnection::DisableSensor(const SensorDescription &sensorDesc)
 #endif // HIVIEWDFX_HITRACE_ENABLE
     int32_t ret = DISABLE_SENSOR_ERR;
 #ifdef BUILD_VARIANT_ENG
-    if (FindOneInMockSet(sensorDesc.sensorType)) {
+    if (IsRoutedToMock(sensorDesc)) {
         CHKPR(iSensorCompatibleHdiConnection_, DISABLE_SENSOR_ERR);
         ret = iSensorCompatibleHdiConnection_->DisableSensor(sensorDesc);
 #ifdef HIVIEWDFX_HITRACE_ENABLE
@@ -364,7 +413,7 @@ int32_t SensorHdiConnection::SetBatch(const SensorDescription &sensorDesc, int64
 #endif // HIVIEWDFX_HITRACE_ENABLE
     int32_t ret = SET_SENSOR_CONFIG_ERR;
 #ifdef BUILD_VARIANT_ENG
-    if (FindOneInMockSet(sensorDesc.sensorType)) {
+    if (IsRoutedToMock(sensorDesc)) {
         CHKPR(iSensorCompatibleHdiConnection_, SET_SENSOR_CONFIG_ERR);
         ret = iSensorCompatibleHdiConnection_->SetBatch(sensorDesc, samplingInterval, reportInterval);
 #ifdef HIVIEWDFX_HITRACE_ENABLE
@@ -399,7 +448,7 @@ int32_t SensorHdiConnection::SetMode(const SensorDescription &sensorDesc, int32_
 #endif // HIVIEWDFX_HITRACE_ENABLE
     int32_t ret = SET_SENSOR_MODE_ERR;
 #ifdef BUILD_VARIANT_ENG
-    if (FindOneInMockSet(sensorDesc.sensorType)) {
+    if (IsRoutedToMock(sensorDesc)) {
         CHKPR(iSensorCompatibleHdiConnection_, SET_SENSOR_MODE_ERR);
         ret = iSensorCompatibleHdiConnection_->SetMode(sensorDesc, mode);
 #ifdef HIVIEWDFX_HITRACE_ENABLE
@@ -497,8 +546,14 @@ int32_t SensorHdiConnection::GetSensorListByDevice(int32_t deviceId, std::vector
 {
     CALL_LOG_ENTER;
     CHKPR(iSensorHdiConnection_, GET_SENSOR_LIST_ERR);
+    ISensorHdiConnection *connection = iSensorHdiConnection_.get();
+#ifdef BUILD_VARIANT_ENG
+    if ((iSensorCompatibleHdiConnection_ != nullptr) && IsMockDevice(deviceId)) {
+        connection = iSensorCompatibleHdiConnection_.get();
+    }
+#endif // BUILD_VARIANT_ENG
     std::lock_guard<std::mutex> sensorLock(sensorMutex_);
-    if (iSensorHdiConnection_->GetSensorListByDevice(deviceId, singleDevSensors) != ERR_OK) {
+    if (connection->GetSensorListByDevice(deviceId, singleDevSensors) != ERR_OK) {
         SEN_HILOGW("Get sensor list by device failed");
     }
     if (singleDevSensors.empty()) {
@@ -548,7 +603,9 @@ int32_t SensorHdiConnection::RegSensorPlugCallback(DevicePlugCallback cb)
     }
 #ifdef BUILD_VARIANT_ENG
     if (iSensorCompatibleHdiConnection_ != nullptr) {
-        ret = iSensorCompatibleHdiConnection_->RegSensorPlugCallback(cb);
+        ret = iSensorCompatibleHdiConnection_->RegSensorPlugCallback([this, cb](const SensorPlugInfo &info) {
+            ReportMockDevicePlug(info, cb);
+        });
         if (ret != ERR_OK) {
             SEN_HILOGE("Registe sensor plug callback failed in compatible");
             return REGIST_CALLBACK_ERR;
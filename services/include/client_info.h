@@ -19,6 +19,7 @@
 #include <map>
 #include <queue>
 #include <set>
+#include <unordered_set>
 
 #include "singleton.h"
 
@@ -41,6 +42,7 @@ public:
     bool GetSensorState(const SensorDescription &sensorDesc);
     SensorBasicInfo GetBestSensorInfo(const SensorDescription &sensorDesc);
     bool OnlyCurPidSensorEnabled(const SensorDescription &sensorDesc, int32_t pid);
+    bool OnlyPidsSensorEnabled(const SensorDescription &sensorDesc, const std::unordered_set<int32_t> &pids);
     std::vector<sptr<SensorBasicDataChannel>> GetSensorChannel(const SensorDescription &sensorDesc);
     std::vector<sptr<SensorBasicDataChannel>> GetSensorChannelByUid(int32_t uid);
     sptr<SensorBasicDataChannel> GetSensorChannelByPid(int32_t pid);
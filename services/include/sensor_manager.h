@@ -17,6 +17,7 @@
 #define SENSOR_MANAGER_H
 
 #include <thread>
+#include <unordered_set>
 
 #ifdef HDF_DRIVERS_INTERFACE_SENSOR
 #include "sensor_data_processer.h"
@@ -35,6 +36,10 @@ public:
         sptr<SensorDataProcesser> dataProcesser, sptr<ReportDataCallback> dataCallback);
     bool SetBestSensorParams(const SensorDescription &sensorDesc, int64_t samplingPeriodNs, int64_t maxReportDelayNs);
     bool ResetBestSensorParams(const SensorDescription &sensorDesc);
+    ErrCode EnableSensor(const SensorDescription &sensorDesc);
+    void ClearSensorParams(const SensorDescription &sensorDesc);
+    void BeginReconfigure();
+    void EndReconfigure(std::unordered_set<SensorDescription> &failedSensorSet);
     void StartDataReportThread();
 #else
     void InitSensorMap(const std::unordered_map<SensorDescription, Sensor> &sensorMap);
@@ -44,12 +49,27 @@ public:
     SensorBasicInfo GetSensorInfo(const SensorDescription &sensorDesc, int64_t samplingPeriodNs,
         int64_t maxReportDelayNs);
     bool IsOtherClientUsingSensor(const SensorDescription &sensorDesc, int32_t clientPid);
+    bool IsOtherClientUsingSensor(const SensorDescription &sensorDesc, const std::unordered_set<int32_t> &clientPids);
     ErrCode AfterDisableSensor(const SensorDescription &sensorDesc);
     void GetPackageName(AccessTokenID tokenId, std::string &packageName, bool isAccessTokenServiceActive = false);
 
 private:
 #ifdef HDF_DRIVERS_INTERFACE_SENSOR
+    struct BatchConfig {
+        int64_t samplingPeriodNs;
+        int64_t maxReportDelayNs;
+    };
+    struct ReconfigWindow {
+        int32_t depth = 0;
+        std::unordered_set<SensorDescription> pendingBatchSet;
+        std::unordered_set<SensorDescription> pendingEnableSet;
+    };
+    bool SetBatchLocked(const SensorDescription &sensorDesc, const BatchConfig &config);
+    ReconfigWindow *GetReconfigWindowLocked();
     SensorHdiConnection &sensorHdiConnection_ = SensorHdiConnection::GetInstance();
+    std::mutex reconfigMutex_;
+    std::unordered_map<std::thread::id, ReconfigWindow> reconfigWindowMap_;
+    std::unordered_map<SensorDescription, BatchConfig> appliedBatchMap_;
     std::thread dataThread_;
     sptr<SensorDataProcesser> sensorDataProcesser_ = nullptr;
     sptr<ReportDataCallback> reportDataCallback_ = nullptr;
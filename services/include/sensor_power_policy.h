@@ -30,6 +30,8 @@ class SensorPowerPolicy : public Singleton<SensorPowerPolicy> {
 public:
     ErrCode SuspendSensors(int32_t pid);
     ErrCode ResumeSensors(int32_t pid);
+    ErrCode SuspendSensors(const std::vector<int32_t> &pids);
+    ErrCode ResumeSensors(const std::vector<int32_t> &pids);
     ErrCode ResetSensors();
     std::vector<ActiveInfo> GetActiveInfoList(int32_t pid);
     void ReportActiveInfo(const ActiveInfo &activeInfo, const std::vector<SessionPtr> &sessionList);
@@ -40,6 +42,9 @@ private:
     bool CheckFreezingSensor(int32_t sensorType);
     bool Suspend(int32_t pid, const std::vector<SensorDescription> &sensorDescList,
         std::unordered_map<SensorDescription, SensorBasicInfo> &SensorInfoMap);
+    ErrCode ResumePidSensors(int32_t pid, std::vector<SensorDescription> &resumedSensors);
+    ErrCode CommitResumedSensors(int32_t pid, const std::vector<SensorDescription> &resumedSensors,
+        const std::unordered_set<SensorDescription> &failedSensorSet);
     bool Resume(int32_t pid, const SensorDescription &sensorDesc, int64_t samplingPeriodNs, int64_t maxReportDelayNs);
     ErrCode RestoreSensorInfo(int32_t pid, const SensorDescription &sensorDesc, int64_t samplingPeriodNs,
         int64_t maxReportDelayNs);
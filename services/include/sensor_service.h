@@ -22,6 +22,7 @@
 #include "death_recipient_template.h"
 #include "sensor_common_event_subscriber.h"
 #include "sensor_delayed_sp_singleton.h"
+#include "sensor_list_table.h"
 #include "sensor_power_policy.h"
 #include "sensor_service_stub.h"
 #include "stream_server.h"
@@ -66,11 +67,15 @@ public:
     ErrCode DestroyClientRemoteObject(const sptr<IRemoteObject> &sensorClient) override;
     ErrCode BlockSensorDataByPid(int32_t targetPid, const std::vector<int32_t> &sensorTypes) override;
     ErrCode UnblockSensorDataByClient(int32_t targetPid) override;
+    ErrCode GetSensorListTable(int32_t &tableFd) override;
+    ErrCode SuspendSensorsByPids(const std::vector<int32_t> &pids) override;
+    ErrCode ResumeSensorsByPids(const std::vector<int32_t> &pids) override;
 
 private:
     DISALLOW_COPY_AND_MOVE(SensorService);
     std::vector<Sensor> GetSensorList();
     std::vector<Sensor> GetSensorListByDevice(int32_t deviceId);
+    void UpdateSensorListTable();
     void InitShakeControl();
     void OnAddSystemAbility(int32_t systemAbilityId, const std::string &deviceId) override;
     void OnRemoveSystemAbility(int32_t systemAbilityId, const std::string &deviceId) override;
@@ -120,6 +125,7 @@ private:
     std::mutex sensorsMutex_;
     std::mutex sensorMapMutex_;
     std::vector<Sensor> sensors_;
+    SensorListTable sensorListTable_;
     std::unordered_map<SensorDescription, Sensor> sensorMap_;
 #ifdef HDF_DRIVERS_INTERFACE_SENSOR
     bool InitInterface();
@@ -129,6 +135,10 @@ private:
     SensorHdiConnection &sensorHdiConnection_ = SensorHdiConnection::GetInstance();
     sptr<SensorDataProcesser> sensorDataProcesser_ = nullptr;
     sptr<ReportDataCallback> reportDataCallback_ = nullptr;
+#ifdef BUILD_VARIANT_ENG
+    void StartTraceRecord();
+    std::shared_ptr<SensorTraceWriter> traceWriter_ = nullptr;
+#endif // BUILD_VARIANT_ENG
 #endif // HDF_DRIVERS_INTERFACE_SENSOR
     ClientInfo &clientInfo_ = ClientInfo::GetInstance();
     SensorManager &sensorManager_ = SensorManager::GetInstance();
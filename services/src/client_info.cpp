@@ -129,6 +129,35 @@ bool ClientInfo::OnlyCurPidSensorEnabled(const SensorDescription &sensorDesc, in
     return ret;
 }
 
+bool ClientInfo::OnlyPidsSensorEnabled(const SensorDescription &sensorDesc, const std::unordered_set<int32_t> &pids)
+{
+    SEN_HILOGD("In, sensorType:%{public}d, pidCount:%{public}zu", sensorDesc.sensorType, pids.size());
+    if ((sensorDesc.sensorType == INVALID_SENSOR_ID) || pids.empty()) {
+        SEN_HILOGE("sensorType or pids is invalid");
+        return false;
+    }
+    std::lock_guard<std::mutex> clientLock(clientMutex_);
+    auto it = clientMap_.find(sensorDesc);
+    if (it == clientMap_.end()) {
+        SEN_HILOGE("Can't find deviceIndex:%{public}d, sensortypeId:%{public}d, sensorId:%{public}d",
+            sensorDesc.deviceId, sensorDesc.sensorType, sensorDesc.sensorId);
+        return false;
+    }
+    bool ret = false;
+    for (const auto &pidIt : it->second) {
+        if (!pidIt.second.GetSensorState()) {
+            continue;
+        }
+        if (pids.find(pidIt.first) == pids.end()) {
+            SEN_HILOGD("Current sensor is also used by other pid");
+            return false;
+        }
+        ret = true;
+    }
+    SEN_HILOGI("Done, sensorType:%{public}d", sensorDesc.sensorType);
+    return ret;
+}
+
 bool ClientInfo::UpdateAppThreadInfo(int32_t pid, int32_t uid, AccessTokenID callerToken)
 {
     SEN_HILOGD("In, pid:%{public}d", pid);
@@ -60,12 +60,13 @@ bool SensorManager::SetBestSensorParams(const SensorDescription &sensorDesc, int
     bestSamplingPeriodNs = (samplingPeriodNs < bestSamplingPeriodNs) ? samplingPeriodNs : bestSamplingPeriodNs;
     bestReportDelayNs = (maxReportDelayNs < bestReportDelayNs) ? maxReportDelayNs : bestReportDelayNs;
     SEN_HILOGD("bestSamplingPeriodNs : %{public}" PRId64, bestSamplingPeriodNs);
-    auto ret = sensorHdiConnection_.SetBatch(sensorDesc, bestSamplingPeriodNs, bestReportDelayNs);
-    if (ret != ERR_OK) {
-        SEN_HILOGE("SetBatch is failed");
-        return false;
+    std::lock_guard<std::mutex> reconfigLock(reconfigMutex_);
+    ReconfigWindow *window = GetReconfigWindowLocked();
+    if (window != nullptr) {
+        window->pendingBatchSet.insert(sensorDesc);
+        return true;
     }
-    return true;
+    return SetBatchLocked(sensorDesc, { bestSamplingPeriodNs, bestReportDelayNs });
 }
 
 bool SensorManager::ResetBestSensorParams(const SensorDescription &sensorDesc)
@@ -76,17 +77,111 @@ bool SensorManager::ResetBestSensorParams(const SensorDescription &sensorDesc)
         SEN_HILOGE("sensorType is invalid");
         return false;
     }
+    std::lock_guard<std::mutex> reconfigLock(reconfigMutex_);
+    ReconfigWindow *window = GetReconfigWindowLocked();
+    if (window != nullptr) {
+        window->pendingBatchSet.insert(sensorDesc);
+        return true;
+    }
     SensorBasicInfo sensorInfo = clientInfo_.GetBestSensorInfo(sensorDesc);
-    auto ret = sensorHdiConnection_.SetBatch(sensorDesc,
-        sensorInfo.GetSamplingPeriodNs(), sensorInfo.GetMaxReportDelayNs());
+    if (!SetBatchLocked(sensorDesc, { sensorInfo.GetSamplingPeriodNs(), sensorInfo.GetMaxReportDelayNs() })) {
+        return false;
+    }
+    SEN_HILOGI("Done, sensorType:%{public}d", sensorDesc.sensorType);
+    return true;
+}
+
+bool SensorManager::SetBatchLocked(const SensorDescription &sensorDesc, const BatchConfig &config)
+{
+    auto it = appliedBatchMap_.find(sensorDesc);
+    if ((it != appliedBatchMap_.end()) && (it->second.samplingPeriodNs == config.samplingPeriodNs) &&
+        (it->second.maxReportDelayNs == config.maxReportDelayNs)) {
+        SEN_HILOGD("Sensor params not changed, sensorType:%{public}d", sensorDesc.sensorType);
+        return true;
+    }
+    auto ret = sensorHdiConnection_.SetBatch(sensorDesc, config.samplingPeriodNs, config.maxReportDelayNs);
     if (ret != ERR_OK) {
         SEN_HILOGE("SetBatch is failed");
+        appliedBatchMap_.erase(sensorDesc);
         return false;
     }
-    SEN_HILOGI("Done, sensorType:%{public}d", sensorDesc.sensorType);
+    appliedBatchMap_[sensorDesc] = config;
     return true;
 }
 
+ErrCode SensorManager::EnableSensor(const SensorDescription &sensorDesc)
+{
+    std::lock_guard<std::mutex> reconfigLock(reconfigMutex_);
+    ReconfigWindow *window = GetReconfigWindowLocked();
+    if (window != nullptr) {
+        window->pendingEnableSet.insert(sensorDesc);
+        return ERR_OK;
+    }
+    return sensorHdiConnection_.EnableSensor(sensorDesc);
+}
+
+void SensorManager::ClearSensorParams(const SensorDescription &sensorDesc)
+{
+    // The driver drops its params once the sensor is disabled or unplugged, so they must be sent again on next enable
+    std::lock_guard<std::mutex> reconfigLock(reconfigMutex_);
+    appliedBatchMap_.erase(sensorDesc);
+}
+
+SensorManager::ReconfigWindow *SensorManager::GetReconfigWindowLocked()
+{
+    // A window only holds back the calls of the thread that opened it, other clients still reach the driver at once
+    auto it = reconfigWindowMap_.find(std::this_thread::get_id());
+    return (it == reconfigWindowMap_.end()) ? nullptr : &it->second;
+}
+
+void SensorManager::BeginReconfigure()
+{
+    std::lock_guard<std::mutex> reconfigLock(reconfigMutex_);
+    ++reconfigWindowMap_[std::this_thread::get_id()].depth;
+}
+
+void SensorManager::EndReconfigure(std::unordered_set<SensorDescription> &failedSensorSet)
+{
+    CALL_LOG_ENTER;
+    std::lock_guard<std::mutex> reconfigLock(reconfigMutex_);
+    auto windowIt = reconfigWindowMap_.find(std::this_thread::get_id());
+    if (windowIt == reconfigWindowMap_.end()) {
+        SEN_HILOGW("Reconfigure is not started");
+        return;
+    }
+    if (--windowIt->second.depth > 0) {
+        return;
+    }
+    ReconfigWindow window = std::move(windowIt->second);
+    reconfigWindowMap_.erase(windowIt);
+    // The params are read back from the subscribers now, so only the final effective rate reaches the driver, and
+    // it reaches it before the enable. A sensor whose params failed is not enabled, as in the immediate path. The
+    // caller gets every failed sensor back, since its calls were answered with success when they were queued.
+    for (const auto &sensorDesc : window.pendingBatchSet) {
+        if (!clientInfo_.GetSensorState(sensorDesc)) {
+            SEN_HILOGW("No subscriber left, skip sensor params, sensorType:%{public}d", sensorDesc.sensorType);
+            continue;
+        }
+        SensorBasicInfo sensorInfo = clientInfo_.GetBestSensorInfo(sensorDesc);
+        if (!SetBatchLocked(sensorDesc, { sensorInfo.GetSamplingPeriodNs(), sensorInfo.GetMaxReportDelayNs() })) {
+            SEN_HILOGE("Apply sensor params failed, sensorType:%{public}d", sensorDesc.sensorType);
+            failedSensorSet.insert(sensorDesc);
+        }
+    }
+    for (const auto &sensorDesc : window.pendingEnableSet) {
+        if (failedSensorSet.find(sensorDesc) != failedSensorSet.end()) {
+            continue;
+        }
+        auto ret = sensorHdiConnection_.EnableSensor(sensorDesc);
+        if (ret != ERR_OK) {
+            SEN_HILOGE("Hdi enable sensor failed, sensorType:%{public}d, ret:%{public}d", sensorDesc.sensorType, ret);
+            failedSensorSet.insert(sensorDesc);
+        }
+    }
+    SEN_HILOGI("Reconfigure done, batch:%{public}zu, enable:%{public}zu, failed:%{public}zu",
+        window.pendingBatchSet.size(), window.pendingEnableSet.size(), failedSensorSet.size());
+}
+
 void SensorManager::StartDataReportThread()
 {
     CALL_LOG_ENTER;
@@ -165,10 +260,33 @@ bool SensorManager::IsOtherClientUsingSensor(const SensorDescription &sensorDesc
     return true;
 }
 
+bool SensorManager::IsOtherClientUsingSensor(const SensorDescription &sensorDesc,
+    const std::unordered_set<int32_t> &clientPids)
+{
+    SEN_HILOGD("In, sensorType:%{public}d, clientCount:%{public}zu", sensorDesc.sensorType, clientPids.size());
+    if (clientInfo_.OnlyPidsSensorEnabled(sensorDesc, clientPids)) {
+        SEN_HILOGD("Only given clients using this sensor");
+        return false;
+    }
+    for (const auto &clientPid : clientPids) {
+        clientInfo_.ClearCurPidSensorInfo(sensorDesc, clientPid);
+    }
+#ifdef HDF_DRIVERS_INTERFACE_SENSOR
+    if (!ResetBestSensorParams(sensorDesc)) {
+        SEN_HILOGW("ResetBestSensorParams is failed");
+    }
+#endif // HDF_DRIVERS_INTERFACE_SENSOR
+    SEN_HILOGI("Done, sensorType:%{public}d, clientCount:%{public}zu", sensorDesc.sensorType, clientPids.size());
+    return true;
+}
+
 ErrCode SensorManager::AfterDisableSensor(const SensorDescription &sensorDesc)
 {
     SEN_HILOGD("In, sensorType:%{public}d", sensorDesc.sensorType);
     clientInfo_.ClearSensorInfo(sensorDesc);
+#ifdef HDF_DRIVERS_INTERFACE_SENSOR
+    ClearSensorParams(sensorDesc);
+#endif // HDF_DRIVERS_INTERFACE_SENSOR
     if (sensorDesc.sensorType == PROXIMITY_SENSOR_ID) {
         SensorData sensorData;
         auto ret = clientInfo_.GetStoreEvent(sensorDesc, sensorData);
@@ -48,8 +48,7 @@ ErrCode SensorPowerPolicy::SuspendSensors(int32_t pid)
     std::lock_guard<std::mutex> pidSensorInfoLock(pidSensorInfoMutex_);
     auto pidSensorInfoIt = pidSensorInfoMap_.find(pid);
     if (pidSensorInfoIt != pidSensorInfoMap_.end()) {
-        std::unordered_map<SensorDescription, SensorBasicInfo> sensorInfoMap = pidSensorInfoIt->second;
-        if (!Suspend(pid, sensorDescList, sensorInfoMap)) {
+        if (!Suspend(pid, sensorDescList, pidSensorInfoIt->second)) {
             SEN_HILOGE("Suspend part sensors, but some failed, pid:%{public}d", pid);
             return SUSPEND_ERR;
         }
@@ -97,32 +96,139 @@ bool SensorPowerPolicy::Suspend(int32_t pid, const std::vector<SensorDescription
     return isAllSuspend;
 }
 
+ErrCode SensorPowerPolicy::SuspendSensors(const std::vector<int32_t> &pids)
+{
+    CALL_LOG_ENTER;
+    std::unordered_map<SensorDescription, std::unordered_set<int32_t>> sensorPidsMap;
+    for (const auto &pid : pids) {
+        std::vector<SensorDescription> sensorDescList = clientInfo_.GetSensorIdByPid(pid);
+        for (const auto &sensorDesc : sensorDescList) {
+            if (CheckFreezingSensor(sensorDesc.sensorType)) {
+                SEN_HILOGD("Current sensor is pedometer detection or pedometer, can not suspend");
+                continue;
+            }
+            sensorPidsMap[sensorDesc].insert(pid);
+        }
+    }
+    if (sensorPidsMap.empty()) {
+        SEN_HILOGD("Suspend sensors failed, sensorIdList is empty, pidCount:%{public}zu", pids.size());
+        return ERR_OK;
+    }
+    std::lock_guard<std::mutex> pidSensorInfoLock(pidSensorInfoMutex_);
+    bool isAllSuspend = true;
+    for (const auto &sensorPids : sensorPidsMap) {
+        const SensorDescription &sensorDesc = sensorPids.first;
+        for (const auto &pid : sensorPids.second) {
+            auto sensorInfo = clientInfo_.GetCurPidSensorInfo(sensorDesc, pid);
+            pidSensorInfoMap_[pid].insert(std::make_pair(sensorDesc, sensorInfo));
+        }
+        if (sensorManager_.IsOtherClientUsingSensor(sensorDesc, sensorPids.second)) {
+            SEN_HILOGD("Other client is using this sensor now, cannot suspend, sensorType:%{public}d",
+                sensorDesc.sensorType);
+            continue;
+        }
+#ifdef HDF_DRIVERS_INTERFACE_SENSOR
+        auto ret = sensorHdiConnection_.DisableSensor(sensorDesc);
+        if (ret != ERR_OK) {
+            isAllSuspend = false;
+            SEN_HILOGE("Hdi disable sensor failed, sensorType:%{public}d, ret:%{public}d", sensorDesc.sensorType, ret);
+        }
+#endif // HDF_DRIVERS_INTERFACE_SENSOR
+        sensorManager_.AfterDisableSensor(sensorDesc);
+    }
+    if (!isAllSuspend) {
+        SEN_HILOGE("Suspend sensors, but some failed, pidCount:%{public}zu", pids.size());
+        return SUSPEND_ERR;
+    }
+    SEN_HILOGI("Suspend sensors success, pidCount:%{public}zu, sensorCount:%{public}zu", pids.size(),
+        sensorPidsMap.size());
+    return ERR_OK;
+}
+
 ErrCode SensorPowerPolicy::ResumeSensors(int32_t pid)
+{
+    CALL_LOG_ENTER;
+    return ResumeSensors(std::vector<int32_t> { pid });
+}
+
+ErrCode SensorPowerPolicy::ResumeSensors(const std::vector<int32_t> &pids)
 {
     CALL_LOG_ENTER;
     std::lock_guard<std::mutex> pidSensorInfoLock(pidSensorInfoMutex_);
+    bool isAllResume = true;
+    std::unordered_map<int32_t, std::vector<SensorDescription>> resumedSensorMap;
+#ifdef HDF_DRIVERS_INTERFACE_SENSOR
+    sensorManager_.BeginReconfigure();
+#endif // HDF_DRIVERS_INTERFACE_SENSOR
+    for (const auto &pid : pids) {
+        if (resumedSensorMap.find(pid) != resumedSensorMap.end()) {
+            continue;
+        }
+        if (ResumePidSensors(pid, resumedSensorMap[pid]) != ERR_OK) {
+            isAllResume = false;
+        }
+    }
+    std::unordered_set<SensorDescription> failedSensorSet;
+#ifdef HDF_DRIVERS_INTERFACE_SENSOR
+    sensorManager_.EndReconfigure(failedSensorSet);
+#endif // HDF_DRIVERS_INTERFACE_SENSOR
+    for (const auto &[pid, resumedSensors] : resumedSensorMap) {
+        if (CommitResumedSensors(pid, resumedSensors, failedSensorSet) != ERR_OK) {
+            isAllResume = false;
+        }
+    }
+    if (!isAllResume) {
+        SEN_HILOGE("Resume sensors, but some failed, pidCount:%{public}zu", pids.size());
+        return RESUME_ERR;
+    }
+    SEN_HILOGI("Resume sensors success, pidCount:%{public}zu", pids.size());
+    return ERR_OK;
+}
+
+ErrCode SensorPowerPolicy::ResumePidSensors(int32_t pid, std::vector<SensorDescription> &resumedSensors)
+{
     auto pidSensorInfoIt = pidSensorInfoMap_.find(pid);
     if (pidSensorInfoIt == pidSensorInfoMap_.end()) {
         SEN_HILOGD("Resume sensors failed, please suspend sensors first, pid:%{public}d", pid);
         return ERR_OK;
     }
     bool isAllResume = true;
-    std::unordered_map<SensorDescription, SensorBasicInfo> sensorInfoMap = pidSensorInfoIt->second;
-    for (auto sensorIt = sensorInfoMap.begin(); sensorIt != sensorInfoMap.end();) {
-        int64_t samplingPeriodNs = sensorIt->second.GetSamplingPeriodNs();
-        int64_t maxReportDelayNs = sensorIt->second.GetMaxReportDelayNs();
-        if (!Resume(pid, sensorIt->first, samplingPeriodNs, maxReportDelayNs)) {
-            SEN_HILOGE("Resume sensor failed, sensorType:%{public}d", sensorIt->first.sensorType);
+    for (const auto &[sensorDesc, sensorInfo] : pidSensorInfoIt->second) {
+        if (!Resume(pid, sensorDesc, sensorInfo.GetSamplingPeriodNs(), sensorInfo.GetMaxReportDelayNs())) {
+            SEN_HILOGE("Resume sensor failed, sensorType:%{public}d", sensorDesc.sensorType);
             isAllResume = false;
-            ++sensorIt;
-        } else {
-            sensorIt = sensorInfoMap.erase(sensorIt);
+            continue;
         }
+        resumedSensors.push_back(sensorDesc);
     }
     if (!isAllResume) {
         SEN_HILOGE("Resume all sensors, but some failed, pid:%{public}d", pid);
         return RESUME_ERR;
     }
+    return ERR_OK;
+}
+
+ErrCode SensorPowerPolicy::CommitResumedSensors(int32_t pid, const std::vector<SensorDescription> &resumedSensors,
+    const std::unordered_set<SensorDescription> &failedSensorSet)
+{
+    auto pidSensorInfoIt = pidSensorInfoMap_.find(pid);
+    if (pidSensorInfoIt == pidSensorInfoMap_.end()) {
+        return ERR_OK;
+    }
+    // Only a sensor the driver really enabled leaves the suspend record, a failed one stays there to be resumed again
+    for (const auto &sensorDesc : resumedSensors) {
+        if (failedSensorSet.find(sensorDesc) != failedSensorSet.end()) {
+            SEN_HILOGE("Resume sensor failed in driver, pid:%{public}d, sensorType:%{public}d", pid,
+                sensorDesc.sensorType);
+            clientInfo_.RemoveSubscriber(sensorDesc, pid);
+            continue;
+        }
+        pidSensorInfoIt->second.erase(sensorDesc);
+    }
+    if (!pidSensorInfoIt->second.empty()) {
+        SEN_HILOGE("Resume all sensors, but some failed, pid:%{public}d", pid);
+        return RESUME_ERR;
+    }
     pidSensorInfoMap_.erase(pidSensorInfoIt);
     SEN_HILOGI("Resume sensors success, pid:%{public}d", pid);
     return ERR_OK;
@@ -152,7 +258,7 @@ bool SensorPowerPolicy::Resume(int32_t pid, const SensorDescription &sensorDesc,
         return false;
     }
 #ifdef HDF_DRIVERS_INTERFACE_SENSOR
-    ret = sensorHdiConnection_.EnableSensor(sensorDesc);
+    ret = sensorManager_.EnableSensor(sensorDesc);
     if (ret != ERR_OK) {
         SEN_HILOGE("Hdi enable sensor failed, sensorType:%{public}d, ret:%{public}d", sensorDesc.sensorType, ret);
         clientInfo_.RemoveSubscriber(sensorDesc, pid);
@@ -197,17 +303,12 @@ ErrCode SensorPowerPolicy::ResetSensors()
 {
     CALL_LOG_ENTER;
     std::vector<int32_t> suspendPidList = GetSuspendPidList();
-    bool resetStatus = true;
-    for (const auto &pid : suspendPidList) {
-        if (ResumeSensors(pid) != ERR_OK) {
-            SEN_HILOGE("Reset pid sensors failed, pid:%{public}d", pid);
-            resetStatus = false;
-        }
+    if (ResumeSensors(suspendPidList) != ERR_OK) {
+        SEN_HILOGE("Reset sensors failed, pidCount:%{public}zu", suspendPidList.size());
+        return RESET_ERR;
     }
-    if (resetStatus) {
-        SEN_HILOGI("Reset sensors success");
-    }
-    return resetStatus ? ERR_OK : RESET_ERR;
+    SEN_HILOGI("Reset sensors success");
+    return ERR_OK;
 }
 
 
@@ -15,11 +15,13 @@
 
 #include "sensor_service.h"
 
+#include <algorithm>
 #include <charconv>
 #include <cinttypes>
 #include <string_ex.h>
 #include <sys/time.h>
 #include <tokenid_kit.h>
+#include <unistd.h>
 
 #ifdef HIVIEWDFX_HISYSEVENT_ENABLE
 #include "hisysevent.h"
@@ -38,6 +40,9 @@
 #include "sensor_data_manager.h"
 #include "sensor_data_block_policy.h"
 #include "sensor_dump.h"
+#ifdef BUILD_VARIANT_ENG
+#include "sensor_trace_file.h"
+#endif // BUILD_VARIANT_ENG
 #include "sensor_utils.h"
 #include "system_ability_definition.h"
 
@@ -52,9 +57,13 @@ auto g_sensorService = SensorDelayedSpSingleton<SensorService>::GetInstance();
 const bool G_REGISTER_RESULT = SystemAbility::MakeAndRegisterAbility(g_sensorService.GetRefPtr());
 constexpr int32_t INVALID_PID = -1;
 constexpr int64_t MAX_EVENT_COUNT = 1000;
+constexpr size_t MAX_PID_COUNT = 1000;
 constexpr int32_t SENSOR_ONLINE = 1;
 std::atomic_bool g_isRegister = false;
 const std::string DEFAULTS_FOLD_TYPE = "0,0,0,0";
+#if defined(HDF_DRIVERS_INTERFACE_SENSOR) && defined(BUILD_VARIANT_ENG)
+const std::string TRACE_RECORD_PATH_KEY = "sensors.trace.record.path";
+#endif // HDF_DRIVERS_INTERFACE_SENSOR && BUILD_VARIANT_ENG
 const std::set<int32_t> g_systemApiSensorCall = {
     SENSOR_TYPE_ID_COLOR, SENSOR_TYPE_ID_SAR, SENSOR_TYPE_ID_HEADPOSTURE
 };
@@ -417,9 +426,30 @@ bool SensorService::InitDataCallback()
         SEN_HILOGE("RegisterDataReport failed");
         return false;
     } // LCOV_EXCL_STOP
+#ifdef BUILD_VARIANT_ENG
+    StartTraceRecord();
+#endif // BUILD_VARIANT_ENG
     return true;
 }
 
+#ifdef BUILD_VARIANT_ENG
+void SensorService::StartTraceRecord()
+{
+    std::string path = OHOS::system::GetParameter(TRACE_RECORD_PATH_KEY, "");
+    if (path.empty()) {
+        return;
+    }
+    auto traceWriter = std::make_shared<SensorTraceWriter>();
+    if (traceWriter->Open(path) != ERR_OK) {
+        SEN_HILOGE("Open sensor trace failed");
+        return;
+    }
+    reportDataCallback_->SetTraceWriter(traceWriter);
+    traceWriter_ = traceWriter;
+    SEN_HILOGI("Recording sensor trace to %{public}s", path.c_str());
+}
+#endif // BUILD_VARIANT_ENG
+
 bool SensorService::InitSensorList()
 {
     std::lock_guard<std::mutex> sensorLock(sensorsMutex_);
@@ -428,6 +458,7 @@ bool SensorService::InitSensorList()
         SEN_HILOGE("GetSensorList is failed");
         return false;
     } // LCOV_EXCL_STOP
+    UpdateSensorListTable();
     {
         std::lock_guard<std::mutex> sensorMapLock(sensorMapMutex_);
         for (const auto &it : sensors_) {
@@ -459,6 +490,13 @@ void SensorService::OnStop()
     if (ret != ERR_OK) {
         SEN_HILOGE("Destroy hdi connect fail");
     }
+#ifdef BUILD_VARIANT_ENG
+    if (traceWriter_ != nullptr) {
+        reportDataCallback_->SetTraceWriter(nullptr);
+        traceWriter_->Close();
+        traceWriter_ = nullptr;
+    }
+#endif // BUILD_VARIANT_ENG
 #endif // HDF_DRIVERS_INTERFACE_SENSOR
     UnregisterPermCallback();
 #ifdef MEMMGR_ENABLE
@@ -843,6 +881,7 @@ std::vector<Sensor> SensorService::GetSensorListByDevice(int32_t deviceId)
         SEN_HILOGW("GetSensorListByDevice is failed or empty");
         return sensors_;
     }
+    std::vector<Sensor> addedSensors;
     for (const auto& newSensor : singleDevSensors) { // LCOV_EXCL_START
         bool found = false;
         for (auto& oldSensor : sensors_) {
@@ -856,27 +895,27 @@ std::vector<Sensor> SensorService::GetSensorListByDevice(int32_t deviceId)
         }
         if (!found) {
             SEN_HILOGD("Sensor not found in sensorList_");
-                found = true;
             sensors_.push_back(newSensor);
+            addedSensors.push_back(newSensor);
         }
     } // LCOV_EXCL_STOP
-#endif // HDF_DRIVERS_INTERFACE_SENSOR
+    if (addedSensors.empty()) {
+        return singleDevSensors;
+    }
+    UpdateSensorListTable();
     // LCOV_EXCL_START
     std::lock_guard<std::mutex> sensorMapLock(sensorMapMutex_);
-    for (const auto &it : sensors_) {
-        auto iter = sensorMap_.find({it.GetDeviceId(), it.GetSensorTypeId(), it.GetSensorId(), it.GetLocation()});
-        if (iter != sensorMap_.end()) {
-            iter->second = it;
-        } else {
-            sensorMap_.insert(std::pair<SensorDescription, Sensor>(
-                {it.GetDeviceId(), it.GetSensorTypeId(), it.GetSensorId(), it.GetLocation()}, it));
-            if (sensorDataProcesser_ != nullptr) {
-                sensorDataProcesser_->UpdateSensorMap(sensorMap_);
-            }
-        }
+    for (const auto &it : addedSensors) {
+        sensorMap_[{it.GetDeviceId(), it.GetSensorTypeId(), it.GetSensorId(), it.GetLocation()}] = it;
+    }
+    if (sensorDataProcesser_ != nullptr) {
+        sensorDataProcesser_->UpdateSensorMap(sensorMap_);
     }
     return singleDevSensors;
     // LCOV_EXCL_STOP
+#else
+    return sensors_;
+#endif // HDF_DRIVERS_INTERFACE_SENSOR
 }
 
 std::vector<Sensor> SensorService::GetSensorList()
@@ -888,6 +927,7 @@ std::vector<Sensor> SensorService::GetSensorList()
         SEN_HILOGE("GetSensorList is failed");
         return sensors_;
     }
+    UpdateSensorListTable();
 #endif // HDF_DRIVERS_INTERFACE_SENSOR
     // LCOV_EXCL_START
     for (const auto &it : sensors_) {
@@ -899,6 +939,36 @@ std::vector<Sensor> SensorService::GetSensorList()
     // LCOV_EXCL_STOP
 }
 
+void SensorService::UpdateSensorListTable()
+{
+    if (!sensorListTable_.IsValid() && sensorListTable_.Create(MAX_SENSOR_COUNT) != ERR_OK) {
+        SEN_HILOGE("Create sensor list table failed");
+        return;
+    }
+    if (sensorListTable_.Publish(sensors_) != ERR_OK) {
+        SEN_HILOGE("Publish sensor list table failed");
+    }
+}
+
+ErrCode SensorService::GetSensorListTable(int32_t &tableFd)
+{
+    CALL_LOG_ENTER;
+    std::lock_guard<std::mutex> sensorLock(sensorsMutex_);
+    UpdateSensorListTable();
+    if (!sensorListTable_.IsValid()) {
+        SEN_HILOGE("Sensor list table is not available");
+        return ERROR;
+    }
+    // The stub closes the returned fd once it is written to the reply, so hand out a duplicate
+    tableFd = dup(sensorListTable_.GetFd());
+    if (tableFd < 0) {
+        SEN_HILOGE("dup failed, errno:%{public}d", errno);
+        return ERROR;
+    }
+    fdsan_exchange_owner_tag(tableFd, 0, TAG);
+    return ERR_OK;
+}
+
 ErrCode SensorService::TransferDataChannel(int32_t sendFd, const sptr<IRemoteObject> &sensorClient)
 {
     CALL_LOG_ENTER;
@@ -1079,6 +1149,54 @@ ErrCode SensorService::ResumeSensors(int32_t pid)
     return POWER_POLICY.ResumeSensors(pid);
 }
 
+ErrCode SensorService::SuspendSensorsByPids(const std::vector<int32_t> &pids)
+{
+    CALL_LOG_ENTER;
+    PermissionUtil &permissionUtil = PermissionUtil::GetInstance();
+    if (!permissionUtil.IsNativeToken(GetCallingTokenID())) { // LCOV_EXCL_START
+        SEN_HILOGE("TokenType is not TOKEN_NATIVE");
+        return PERMISSION_DENIED;
+    } // LCOV_EXCL_STOP
+    int32_t ret = permissionUtil.CheckManageSensorPermission(GetCallingTokenID());
+    if (ret != PERMISSION_GRANTED) { // LCOV_EXCL_START
+        SEN_HILOGE("Check manage sensor permission failed, ret:%{public}d", ret);
+        return PERMISSION_DENIED;
+    } // LCOV_EXCL_STOP
+    if (pids.empty() || (pids.size() > MAX_PID_COUNT)) {
+        SEN_HILOGE("Pid count is invalid, count:%{public}zu", pids.size());
+        return PARAMETER_ERROR;
+    }
+    if (std::any_of(pids.begin(), pids.end(), [](int32_t pid) { return pid < 0; })) {
+        SEN_HILOGE("Pid is invalid");
+        return CLIENT_PID_INVALID_ERR;
+    }
+    return POWER_POLICY.SuspendSensors(pids);
+}
+
+ErrCode SensorService::ResumeSensorsByPids(const std::vector<int32_t> &pids)
+{
+    CALL_LOG_ENTER;
+    PermissionUtil &permissionUtil = PermissionUtil::GetInstance();
+    if (!permissionUtil.IsNativeToken(GetCallingTokenID())) { // LCOV_EXCL_START
+        SEN_HILOGE("TokenType is not TOKEN_NATIVE");
+        return PERMISSION_DENIED;
+    } // LCOV_EXCL_STOP
+    int32_t ret = permissionUtil.CheckManageSensorPermission(GetCallingTokenID());
+    if (ret != PERMISSION_GRANTED) { // LCOV_EXCL_START
+        SEN_HILOGE("Check manage sensor permission failed, ret:%{public}d", ret);
+        return PERMISSION_DENIED;
+    } // LCOV_EXCL_STOP
+    if (pids.empty() || (pids.size() > MAX_PID_COUNT)) {
+        SEN_HILOGE("Pid count is invalid, count:%{public}zu", pids.size());
+        return PARAMETER_ERROR;
+    }
+    if (std::any_of(pids.begin(), pids.end(), [](int32_t pid) { return pid < 0; })) {
+        SEN_HILOGE("Pid is invalid");
+        return CLIENT_PID_INVALID_ERR;
+    }
+    return POWER_POLICY.ResumeSensors(pids);
+}
+
 ErrCode SensorService::GetActiveInfoList(int32_t pid, std::vector<ActiveInfo> &activeInfoList)
 {
     CALL_LOG_ENTER;
@@ -1273,6 +1391,8 @@ void SensorService::ReportPlugEventCallback(const SensorPlugInfo &info)
         if (!sensorHdiConnection_.PlugEraseSensorData(info)) {
             SEN_HILOGW("sensorHdiConnection Cache update failure");
         }
+        sensorManager_.ClearSensorParams({info.deviceSensorInfo.deviceId, info.deviceSensorInfo.sensorType,
+            info.deviceSensorInfo.sensorId, info.deviceSensorInfo.location});
         {
             std::lock_guard<std::mutex> sensorLock(sensorsMutex_);
             auto it = std::find_if(sensors_.begin(), sensors_.end(), [&](const Sensor& sensor) {
@@ -1282,6 +1402,7 @@ void SensorService::ReportPlugEventCallback(const SensorPlugInfo &info)
             });
             if (it != sensors_.end()) {
                 sensors_.erase(it);
+                UpdateSensorListTable();
             }
         }
         std::lock_guard<std::mutex> sensorMapLock(sensorMapMutex_);
@@ -1303,7 +1424,8 @@ void SensorService::ReportPlugEventCallback(const SensorPlugInfo &info)
         .deviceName = info.deviceName,
         .status = info.status,
         .reserved = info.reserved,
-        .timestamp = static_cast<int64_t>(curTime.tv_sec * 1000 + curTime.tv_usec / 1000) //1000:milliSecond
+        .timestamp = static_cast<int64_t>(curTime.tv_sec * 1000 + curTime.tv_usec / 1000), //1000:milliSecond
+        .generation = sensorListTable_.GetVersion()
     };
     clientInfo_.SendMsgToClient(sensorPlugData);
 }
@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cinttypes>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "hdi_service_impl.h"
+#include "sensor_errors.h"
+
+#undef LOG_TAG
+#define LOG_TAG "HdiServiceImplTest"
+
+namespace OHOS {
+namespace Sensors {
+using namespace testing::ext;
+using namespace OHOS::HiviewDFX;
+
+namespace {
+constexpr uint32_t MOCK_SEED = 42;
+constexpr int32_t MOCK_DEVICE_COUNT = 2;
+constexpr int32_t EXTERNAL_DEVICE_ID = 1;
+constexpr int64_t SAMPLING_INTERVAL_NS = 10000;
+constexpr int64_t REPORT_INTERVAL_NS = 20000000;
+constexpr size_t SAMPLE_COUNT = 10;
+constexpr double MIN_EVENT_RATE = 100000.0;
+constexpr float ACC_DATA_SUM = 9.8F * 9.8F;
+constexpr float ACC_DATA_EPSILON = 0.01F;
+const SensorDescription ACC_DESC = { -1, SENSOR_TYPE_ID_ACCELEROMETER, 0, 1 };
+const SensorDescription GYRO_DESC = { -1, SENSOR_TYPE_ID_GYROSCOPE, 0, 1 };
+std::mutex g_eventMutex;
+std::vector<std::vector<float>> g_accData;
+std::atomic<uint64_t> g_eventCount = 0;
+std::atomic<uint64_t> g_gyroEventCount = 0;
+
+void RecordEvent(SensorEvent *event)
+{
+    ++g_eventCount;
+    if (event->sensorTypeId == SENSOR_TYPE_ID_GYROSCOPE) {
+        ++g_gyroEventCount;
+        return;
+    }
+    std::lock_guard<std::mutex> eventLock(g_eventMutex);
+    if (g_accData.size() < SAMPLE_COUNT) {
+        const float *data = reinterpret_cast<const float *>(event->data);
+        g_accData.emplace_back(data, data + event->dataLen / sizeof(float));
+    }
+}
+
+std::vector<std::vector<float>> CollectAccData(HdiServiceImpl &hdiServiceImpl)
+{
+    MockSensorConfig config;
+    config.sensorTypes = { SENSOR_TYPE_ID_ACCELEROMETER, SENSOR_TYPE_ID_GYROSCOPE };
+    config.seed = MOCK_SEED;
+    EXPECT_EQ(hdiServiceImpl.SetMockConfig(config), ERR_OK);
+    {
+        std::lock_guard<std::mutex> eventLock(g_eventMutex);
+        g_accData.clear();
+    }
+    EXPECT_EQ(hdiServiceImpl.SetBatch(ACC_DESC, SAMPLING_INTERVAL_NS, 0), ERR_OK);
+    EXPECT_EQ(hdiServiceImpl.EnableSensor(ACC_DESC), ERR_OK);
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    EXPECT_EQ(hdiServiceImpl.DisableSensor(ACC_DESC), ERR_OK);
+    EXPECT_EQ(hdiServiceImpl.Unregister(), ERR_OK);
+    std::lock_guard<std::mutex> eventLock(g_eventMutex);
+    return g_accData;
+}
+} // namespace
+
+class HdiServiceImplTest : public testing::Test {
+public:
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp();
+    void TearDown();
+};
+
+void HdiServiceImplTest::SetUpTestCase()
+{
+    ASSERT_EQ(HdiServiceImpl::GetInstance().Register(RecordEvent), ERR_OK);
+}
+
+void HdiServiceImplTest::TearDownTestCase()
+{
+    HdiServiceImpl::GetInstance().Unregister();
+}
+
+void HdiServiceImplTest::SetUp() {}
+
+void HdiServiceImplTest::TearDown() {}
+
+HWTEST_F(HdiServiceImplTest, HdiServiceImplTest_001, TestSize.Level1)
+{
+    SEN_HILOGI("HdiServiceImplTest_001 in");
+    HdiServiceImpl &hdiServiceImpl = HdiServiceImpl::GetInstance();
+    std::vector<std::vector<float>> first = CollectAccData(hdiServiceImpl);
+    std::vector<std::vector<float>> second = CollectAccData(hdiServiceImpl);
+    ASSERT_EQ(first.size(), SAMPLE_COUNT);
+    ASSERT_EQ(first, second);
+    for (const auto &data : first) {
+        ASSERT_EQ(data.size(), 3U);
+        float sum = data[0] * data[0] + data[1] * data[1] + data[2] * data[2];
+        EXPECT_NEAR(sum, ACC_DATA_SUM, ACC_DATA_EPSILON);
+    }
+}
+
+HWTEST_F(HdiServiceImplTest, HdiServiceImplTest_002, TestSize.Level1)
+{
+    SEN_HILOGI("HdiServiceImplTest_002 in");
+    HdiServiceImpl &hdiServiceImpl = HdiServiceImpl::GetInstance();
+    MockSensorConfig config;
+    config.sensorTypes = { SENSOR_TYPE_ID_ACCELEROMETER, SENSOR_TYPE_ID_GYROSCOPE };
+    ASSERT_EQ(hdiServiceImpl.SetMockConfig(config), ERR_OK);
+    g_eventCount = 0;
+    g_gyroEventCount = 0;
+    ASSERT_EQ(hdiServiceImpl.SetBatch(ACC_DESC, SAMPLING_INTERVAL_NS, 0), ERR_OK);
+    ASSERT_EQ(hdiServiceImpl.SetBatch(GYRO_DESC, SAMPLING_INTERVAL_NS, REPORT_INTERVAL_NS), ERR_OK);
+    auto startTime = std::chrono::steady_clock::now();
+    ASSERT_EQ(hdiServiceImpl.EnableSensor(ACC_DESC), ERR_OK);
+    ASSERT_EQ(hdiServiceImpl.EnableSensor(GYRO_DESC), ERR_OK);
+    std::this_thread::sleep_for(std::chrono::seconds(1));
+    ASSERT_EQ(hdiServiceImpl.DisableSensor(ACC_DESC), ERR_OK);
+    ASSERT_EQ(hdiServiceImpl.DisableSensor(GYRO_DESC), ERR_OK);
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - startTime;
+    ASSERT_EQ(hdiServiceImpl.Unregister(), ERR_OK);
+    double eventRate = static_cast<double>(g_eventCount.load()) / elapsed.count();
+    SEN_HILOGI("eventCount:%{public}" PRIu64 ", gyroEventCount:%{public}" PRIu64 ", eventRate:%{public}.0f/s",
+        g_eventCount.load(), g_gyroEventCount.load(), eventRate);
+    EXPECT_GT(g_gyroEventCount.load(), 0);
+    EXPECT_GT(g_eventCount.load(), g_gyroEventCount.load());
+    // Both sensors sample at 100 kHz, the generator must sustain at least half of it
+    EXPECT_GE(eventRate, MIN_EVENT_RATE);
+}
+
+HWTEST_F(HdiServiceImplTest, HdiServiceImplTest_003, TestSize.Level1)
+{
+    SEN_HILOGI("HdiServiceImplTest_003 in");
+    HdiServiceImpl &hdiServiceImpl = HdiServiceImpl::GetInstance();
+    MockSensorConfig config;
+    config.deviceCount = 0;
+    ASSERT_NE(hdiServiceImpl.SetMockConfig(config), ERR_OK);
+    config.sensorTypes = { SENSOR_TYPE_ID_ACCELEROMETER, SENSOR_TYPE_ID_GYROSCOPE };
+    config.deviceCount = MOCK_DEVICE_COUNT;
+    ASSERT_EQ(hdiServiceImpl.SetMockConfig(config), ERR_OK);
+    std::vector<int32_t> plugStatus;
+    ASSERT_EQ(hdiServiceImpl.RegisterPlugCallback([&plugStatus](const SensorInfo &sensorInfo, bool isOnline) {
+        EXPECT_EQ(sensorInfo.deviceId, EXTERNAL_DEVICE_ID);
+        plugStatus.push_back(isOnline ? 1 : 0);
+    }), ERR_OK);
+    std::vector<SensorInfo> sensorList;
+    ASSERT_EQ(hdiServiceImpl.GetSensorList(sensorList), ERR_OK);
+    ASSERT_EQ(sensorList.size(), config.sensorTypes.size() * MOCK_DEVICE_COUNT);
+    ASSERT_NE(hdiServiceImpl.SimulateDevicePlug(-1, false), ERR_OK);
+    ASSERT_EQ(hdiServiceImpl.SimulateDevicePlug(EXTERNAL_DEVICE_ID, false), ERR_OK);
+    ASSERT_EQ(hdiServiceImpl.GetSensorList(sensorList), ERR_OK);
+    ASSERT_EQ(sensorList.size(), config.sensorTypes.size());
+    SensorDescription externalDesc = { EXTERNAL_DEVICE_ID, SENSOR_TYPE_ID_ACCELEROMETER, 0, 0 };
+    ASSERT_NE(hdiServiceImpl.EnableSensor(externalDesc), ERR_OK);
+    ASSERT_EQ(hdiServiceImpl.SimulateDevicePlug(EXTERNAL_DEVICE_ID, true), ERR_OK);
+    ASSERT_EQ(plugStatus, std::vector<int32_t>({ 0, 0, 1, 1 }));
+    hdiServiceImpl.RegisterPlugCallback([](const SensorInfo &sensorInfo, bool isOnline) {});
+}
+
+HWTEST_F(HdiServiceImplTest, HdiServiceImplTest_004, TestSize.Level1)
+{
+    SEN_HILOGI("HdiServiceImplTest_004 in");
+    HdiServiceImpl &hdiServiceImpl = HdiServiceImpl::GetInstance();
+    MockSensorConfig config;
+    ASSERT_EQ(hdiServiceImpl.SetMockConfig(config), ERR_OK);
+    std::vector<SensorInfo> sensorList;
+    ASSERT_EQ(hdiServiceImpl.GetSensorList(sensorList), ERR_OK);
+    ASSERT_EQ(sensorList.size(), 1U);
+    EXPECT_EQ(sensorList[0].sensorTypeId, SENSOR_TYPE_ID_ACCELEROMETER);
+    // Types that are not advertised can still be enabled for SensorHdiConnection, unknown ones can not
+    SensorDescription colorDesc = { -1, SENSOR_TYPE_ID_COLOR, 0, 1 };
+    ASSERT_EQ(hdiServiceImpl.EnableSensor(colorDesc), ERR_OK);
+    EXPECT_EQ(hdiServiceImpl.DisableSensor(colorDesc), ERR_OK);
+    EXPECT_NE(hdiServiceImpl.EnableSensor(GYRO_DESC), ERR_OK);
+}
+} // namespace Sensors
+} // namespace OHOS
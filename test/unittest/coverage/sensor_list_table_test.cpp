@@ -0,0 +1,218 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstring>
+
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+#include "sensor_errors.h"
+#include "sensor_list_table.h"
+
+#undef LOG_TAG
+#define LOG_TAG "SensorListTableTest"
+
+namespace OHOS {
+namespace Sensors {
+using namespace testing::ext;
+using namespace OHOS::HiviewDFX;
+
+namespace {
+constexpr uint32_t TABLE_CAPACITY = 4;
+constexpr int32_t INVALID_FD = -1;
+
+Sensor CreateSensor(int32_t sensorTypeId, int32_t sensorId)
+{
+    Sensor sensor;
+    sensor.SetDeviceId(1);
+    sensor.SetSensorTypeId(sensorTypeId);
+    sensor.SetSensorId(sensorId);
+    sensor.SetLocation(1);
+    sensor.SetSensorName("sensor_test");
+    sensor.SetVendorName("default");
+    sensor.SetFirmwareVersion("1.0.0");
+    sensor.SetHardwareVersion("1.0.0");
+    sensor.SetMaxRange(100.0f);
+    sensor.SetResolution(0.1f);
+    sensor.SetPower(1.5f);
+    sensor.SetMinSamplePeriodNs(10000000);
+    sensor.SetMaxSamplePeriodNs(200000000);
+    return sensor;
+}
+} // namespace
+
+class SensorListTableTest : public testing::Test {
+public:
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp();
+    void TearDown();
+};
+
+void SensorListTableTest::SetUpTestCase() {}
+
+void SensorListTableTest::TearDownTestCase() {}
+
+void SensorListTableTest::SetUp() {}
+
+void SensorListTableTest::TearDown() {}
+
+HWTEST_F(SensorListTableTest, SensorListTableTest_001, TestSize.Level1)
+{
+    SEN_HILOGI("SensorListTableTest_001 in");
+    SensorListTable table;
+    ASSERT_EQ(table.Create(TABLE_CAPACITY), ERR_OK);
+    ASSERT_TRUE(table.IsValid());
+    ASSERT_EQ(table.GetVersion(), SENSOR_LIST_TABLE_INVALID_VERSION);
+    std::vector<Sensor> sensorList = { CreateSensor(1, 1), CreateSensor(2, 1) };
+    ASSERT_EQ(table.Publish(sensorList), ERR_OK);
+    std::vector<Sensor> readList;
+    uint32_t version = SENSOR_LIST_TABLE_INVALID_VERSION;
+    ASSERT_EQ(table.Read(readList, version), ERR_OK);
+    ASSERT_NE(version, SENSOR_LIST_TABLE_INVALID_VERSION);
+    ASSERT_EQ(readList.size(), sensorList.size());
+    EXPECT_EQ(readList[1].GetSensorTypeId(), 2);
+    EXPECT_EQ(readList[1].GetSensorName(), "sensor_test");
+    EXPECT_EQ(readList[1].GetFirmwareVersion(), "1.0.0");
+    EXPECT_FLOAT_EQ(readList[1].GetPower(), 1.5f);
+    EXPECT_EQ(readList[1].GetMaxSamplePeriodNs(), 200000000);
+}
+
+HWTEST_F(SensorListTableTest, SensorListTableTest_002, TestSize.Level1)
+{
+    SEN_HILOGI("SensorListTableTest_002 in");
+    SensorListTable table;
+    ASSERT_EQ(table.Create(TABLE_CAPACITY), ERR_OK);
+    std::vector<Sensor> sensorList = { CreateSensor(1, 1) };
+    ASSERT_EQ(table.Publish(sensorList), ERR_OK);
+    uint32_t version = table.GetVersion();
+    ASSERT_EQ(table.Publish(sensorList), ERR_OK);
+    EXPECT_EQ(table.GetVersion(), version);
+    sensorList.push_back(CreateSensor(2, 1));
+    ASSERT_EQ(table.Publish(sensorList), ERR_OK);
+    EXPECT_NE(table.GetVersion(), version);
+}
+
+HWTEST_F(SensorListTableTest, SensorListTableTest_003, TestSize.Level1)
+{
+    SEN_HILOGI("SensorListTableTest_003 in");
+    SensorListTable table;
+    ASSERT_EQ(table.Create(TABLE_CAPACITY), ERR_OK);
+    ASSERT_EQ(table.Publish({ CreateSensor(1, 1) }), ERR_OK);
+    SensorListTable reader;
+    ASSERT_EQ(reader.Attach(dup(table.GetFd())), ERR_OK);
+    std::vector<Sensor> readList;
+    uint32_t version = SENSOR_LIST_TABLE_INVALID_VERSION;
+    ASSERT_EQ(reader.Read(readList, version), ERR_OK);
+    ASSERT_EQ(readList.size(), 1);
+    ASSERT_EQ(table.Publish({ CreateSensor(1, 1), CreateSensor(2, 1), CreateSensor(3, 1) }), ERR_OK);
+    ASSERT_NE(reader.GetVersion(), version);
+    ASSERT_EQ(reader.Read(readList, version), ERR_OK);
+    EXPECT_EQ(readList.size(), 3);
+    EXPECT_EQ(version, table.GetVersion());
+    EXPECT_NE(reader.Publish(readList), ERR_OK);
+}
+
+HWTEST_F(SensorListTableTest, SensorListTableTest_004, TestSize.Level1)
+{
+    SEN_HILOGI("SensorListTableTest_004 in");
+    SensorListTable table;
+    EXPECT_NE(table.Attach(INVALID_FD), ERR_OK);
+    EXPECT_NE(table.Create(0), ERR_OK);
+    std::vector<Sensor> readList;
+    uint32_t version = SENSOR_LIST_TABLE_INVALID_VERSION;
+    EXPECT_NE(table.Read(readList, version), ERR_OK);
+    ASSERT_EQ(table.Create(TABLE_CAPACITY), ERR_OK);
+    EXPECT_NE(table.Read(readList, version), ERR_OK);
+    std::vector<Sensor> sensorList(TABLE_CAPACITY + 1, CreateSensor(1, 1));
+    ASSERT_EQ(table.Publish(sensorList), ERR_OK);
+    ASSERT_EQ(table.Read(readList, version), ERR_OK);
+    EXPECT_EQ(readList.size(), TABLE_CAPACITY);
+}
+
+HWTEST_F(SensorListTableTest, SensorListTableTest_005, TestSize.Level1)
+{
+    SEN_HILOGI("SensorListTableTest_005 in");
+    SensorListTable table;
+    ASSERT_EQ(table.Create(TABLE_CAPACITY), ERR_OK);
+    Sensor externalSensor = CreateSensor(1, 1);
+    externalSensor.SetDeviceId(2);
+    ASSERT_EQ(table.Publish({ CreateSensor(1, 1), CreateSensor(2, 1) }), ERR_OK);
+    uint32_t previousVersion = table.GetVersion();
+    ASSERT_EQ(table.Publish({ CreateSensor(1, 1), CreateSensor(2, 1), externalSensor }), ERR_OK);
+    std::vector<Sensor> readList;
+    uint32_t version = SENSOR_LIST_TABLE_INVALID_VERSION;
+    ASSERT_EQ(table.ReadByDevice(2, readList, version), ERR_OK);
+    ASSERT_EQ(readList.size(), 1);
+    EXPECT_EQ(readList[0].GetDeviceId(), 2);
+    EXPECT_EQ(version, previousVersion + SENSOR_LIST_TABLE_VERSION_STEP);
+    ASSERT_EQ(table.ReadByDevice(3, readList, version), ERR_OK);
+    EXPECT_TRUE(readList.empty());
+}
+
+HWTEST_F(SensorListTableTest, SensorListTableTest_006, TestSize.Level1)
+{
+    SEN_HILOGI("SensorListTableTest_006 in");
+    Sensor renamedSensor = CreateSensor(3, 1);
+    renamedSensor.SetSensorName("sensor_other");
+    std::vector<Sensor> sensorList = { CreateSensor(1, 1), CreateSensor(2, 1), renamedSensor };
+    SensorDescriptorBlob blob;
+    ASSERT_EQ(blob.Pack(sensorList), ERR_OK);
+    ASSERT_EQ(blob.GetCount(), sensorList.size());
+    // "sensor_test", "default", "1.0.0" and "sensor_other" are stored once whatever the number of sensors
+    size_t stringTableSize = sizeof("sensor_test") + sizeof("default") + sizeof("1.0.0") + sizeof("sensor_other");
+    EXPECT_EQ(blob.GetSize(), sizeof(SensorDescriptor) * sensorList.size() + stringTableSize);
+    EXPECT_EQ(blob.GetDescriptor(0).vendorNameOffset, blob.GetDescriptor(2).vendorNameOffset);
+    SensorInfo sensorInfo;
+    ASSERT_EQ(blob.ToSensorInfo(2, sensorInfo), ERR_OK);
+    EXPECT_STREQ(sensorInfo.sensorName, "sensor_other");
+    EXPECT_STREQ(sensorInfo.vendorName, "default");
+    EXPECT_STREQ(sensorInfo.hardwareVersion, "1.0.0");
+    EXPECT_EQ(sensorInfo.sensorTypeId, 3);
+    EXPECT_EQ(sensorInfo.sensorIndex, 1);
+    EXPECT_FLOAT_EQ(sensorInfo.precision, 0.1f);
+    EXPECT_EQ(sensorInfo.minSamplePeriod, 10000000);
+    EXPECT_NE(blob.ToSensorInfo(3, sensorInfo), ERR_OK);
+    SensorListTable table;
+    ASSERT_EQ(table.Create(TABLE_CAPACITY), ERR_OK);
+    ASSERT_EQ(table.Publish(sensorList), ERR_OK);
+    SensorDescriptorBlob readBlob;
+    uint32_t version = SENSOR_LIST_TABLE_INVALID_VERSION;
+    ASSERT_EQ(table.ReadBlob(readBlob, version), ERR_OK);
+    ASSERT_EQ(readBlob.GetSize(), blob.GetSize());
+    EXPECT_EQ(memcmp(readBlob.GetData(), blob.GetData(), blob.GetSize()), 0);
+}
+
+HWTEST_F(SensorListTableTest, SensorListTableTest_007, TestSize.Level1)
+{
+    SEN_HILOGI("SensorListTableTest_007 in");
+    SensorDescriptorBlob blob;
+    ASSERT_EQ(blob.Pack({ CreateSensor(1, 1) }), ERR_OK);
+    std::vector<uint8_t> data(blob.GetData(), blob.GetData() + blob.GetSize());
+    SensorDescriptorBlob copy;
+    ASSERT_EQ(copy.Assign(data.data(), data.size(), 1), ERR_OK);
+    EXPECT_NE(copy.Assign(data.data(), sizeof(SensorDescriptor) - 1, 1), ERR_OK);
+    std::vector<uint8_t> unterminated = data;
+    unterminated.back() = 'x';
+    EXPECT_NE(copy.Assign(unterminated.data(), unterminated.size(), 1), ERR_OK);
+    std::vector<uint8_t> outOfRange = data;
+    reinterpret_cast<SensorDescriptor *>(outOfRange.data())->vendorNameOffset = static_cast<uint32_t>(data.size());
+    EXPECT_NE(copy.Assign(outOfRange.data(), outOfRange.size(), 1), ERR_OK);
+    Sensor longNameSensor = CreateSensor(1, 1);
+    longNameSensor.SetFirmwareVersion(std::string(VERSION_MAX_LEN, 'v'));
+    EXPECT_NE(blob.Pack({ longNameSensor }), ERR_OK);
+}
+} // namespace Sensors
+} // namespace OHOS
@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <poll.h>
+
+#include "securec.h"
+
+#include "sensor_errors.h"
+#include "sensor_poll_queue.h"
+
+#undef LOG_TAG
+#define LOG_TAG "SensorPollQueueTest"
+
+namespace OHOS {
+namespace Sensors {
+using namespace testing::ext;
+using namespace OHOS::HiviewDFX;
+
+namespace {
+constexpr uint32_t QUEUE_CAPACITY = 4;
+constexpr int32_t DATA_COUNT = 3;
+constexpr int32_t POLL_TIMEOUT_MS = 1000;
+constexpr int32_t EVENT_COUNT = 1000;
+
+bool IsReadable(int32_t fd, int32_t timeout)
+{
+    struct pollfd pfd = { .fd = fd, .events = POLLIN, .revents = 0 };
+    return (poll(&pfd, 1, timeout) == 1) && ((pfd.revents & POLLIN) != 0);
+}
+
+class EventSource {
+public:
+    void Fill(int64_t timestamp)
+    {
+        for (int32_t i = 0; i < DATA_COUNT; ++i) {
+            data_[i] = static_cast<float>(timestamp + i);
+        }
+        event_.sensorTypeId = SENSOR_TYPE_ID_ACCELEROMETER;
+        event_.timestamp = timestamp;
+        event_.option = 0;
+        event_.mode = 0;
+        event_.data = reinterpret_cast<uint8_t *>(data_);
+        event_.dataLen = sizeof(data_);
+        event_.deviceId = 1;
+        event_.sensorId = 0;
+        event_.location = 1;
+    }
+    const SensorEvent *Get() const
+    {
+        return &event_;
+    }
+
+private:
+    float data_[DATA_COUNT] = {};
+    SensorEvent event_;
+};
+
+void ExpectRecord(const SensorEventRecord &record, int64_t timestamp)
+{
+    EXPECT_EQ(record.sensorTypeId, SENSOR_TYPE_ID_ACCELEROMETER);
+    EXPECT_EQ(record.timestamp, timestamp);
+    ASSERT_EQ(record.dataLen, sizeof(float) * DATA_COUNT);
+    float data[DATA_COUNT] = {};
+    ASSERT_EQ(memcpy_s(data, sizeof(data), record.data, record.dataLen), EOK);
+    EXPECT_FLOAT_EQ(data[0], static_cast<float>(timestamp));
+    EXPECT_FLOAT_EQ(data[DATA_COUNT - 1], static_cast<float>(timestamp + DATA_COUNT - 1));
+}
+} // namespace
+
+class SensorPollQueueTest : public testing::Test {
+public:
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp();
+    void TearDown();
+};
+
+void SensorPollQueueTest::SetUpTestCase() {}
+
+void SensorPollQueueTest::TearDownTestCase() {}
+
+void SensorPollQueueTest::SetUp() {}
+
+void SensorPollQueueTest::TearDown() {}
+
+HWTEST_F(SensorPollQueueTest, SensorPollQueueTest_001, TestSize.Level1)
+{
+    SEN_HILOGI("SensorPollQueueTest_001 in");
+    SensorPollQueue queue(QUEUE_CAPACITY);
+    ASSERT_EQ(queue.Init(), ERR_OK);
+    int32_t fd = queue.GetFd();
+    ASSERT_GE(fd, 0);
+    EXPECT_FALSE(IsReadable(fd, 0));
+    EventSource source;
+    for (int64_t timestamp = 1; timestamp <= 2; ++timestamp) {
+        source.Fill(timestamp);
+        queue.Push(source.Get(), 1);
+    }
+    ASSERT_TRUE(IsReadable(fd, 0));
+    SensorEventRecord records[QUEUE_CAPACITY];
+    ASSERT_EQ(queue.Read(records, 1), 1U);
+    ExpectRecord(records[0], 1);
+    EXPECT_TRUE(IsReadable(fd, 0));
+    ASSERT_EQ(queue.Read(records, QUEUE_CAPACITY), 1U);
+    ExpectRecord(records[0], 2);
+    EXPECT_FALSE(IsReadable(fd, 0));
+    EXPECT_EQ(queue.Read(records, QUEUE_CAPACITY), 0U);
+}
+
+HWTEST_F(SensorPollQueueTest, SensorPollQueueTest_002, TestSize.Level1)
+{
+    SEN_HILOGI("SensorPollQueueTest_002 in");
+    SensorPollQueue queue(QUEUE_CAPACITY);
+    ASSERT_EQ(queue.Init(), ERR_OK);
+    EventSource source;
+    constexpr int64_t pushCount = QUEUE_CAPACITY + 2;
+    for (int64_t timestamp = 1; timestamp <= pushCount; ++timestamp) {
+        source.Fill(timestamp);
+        queue.Push(source.Get(), 1);
+    }
+    SensorEventRecord records[QUEUE_CAPACITY];
+    ASSERT_EQ(queue.Read(records, QUEUE_CAPACITY), QUEUE_CAPACITY);
+    for (uint32_t i = 0; i < QUEUE_CAPACITY; ++i) {
+        ExpectRecord(records[i], pushCount - QUEUE_CAPACITY + 1 + i);
+    }
+    EXPECT_FALSE(IsReadable(queue.GetFd(), 0));
+}
+
+HWTEST_F(SensorPollQueueTest, SensorPollQueueTest_003, TestSize.Level1)
+{
+    SEN_HILOGI("SensorPollQueueTest_003 in");
+    SensorPollQueue queue(EVENT_COUNT);
+    ASSERT_EQ(queue.Init(), ERR_OK);
+    std::thread producer([&queue]() {
+        EventSource source;
+        for (int64_t timestamp = 1; timestamp <= EVENT_COUNT; ++timestamp) {
+            source.Fill(timestamp);
+            queue.Push(source.Get(), 1);
+        }
+    });
+    std::vector<SensorEventRecord> records(QUEUE_CAPACITY);
+    int64_t expected = 1;
+    while (expected <= EVENT_COUNT) {
+        if (!IsReadable(queue.GetFd(), POLL_TIMEOUT_MS)) {
+            break;
+        }
+        uint32_t count = queue.Read(records.data(), QUEUE_CAPACITY);
+        for (uint32_t i = 0; i < count; ++i) {
+            ExpectRecord(records[i], expected++);
+        }
+    }
+    producer.join();
+    ASSERT_EQ(expected, EVENT_COUNT + 1);
+    EXPECT_FALSE(IsReadable(queue.GetFd(), 0));
+}
+
+HWTEST_F(SensorPollQueueTest, SensorPollQueueTest_004, TestSize.Level1)
+{
+    SEN_HILOGI("SensorPollQueueTest_004 in");
+    SensorPollQueue emptyQueue(0);
+    EXPECT_EQ(emptyQueue.Init(), PARAMETER_ERROR);
+    SensorPollQueue queue(QUEUE_CAPACITY);
+    ASSERT_EQ(queue.Init(), ERR_OK);
+    SensorEvent event;
+    queue.Push(&event, 1);
+    EXPECT_FALSE(IsReadable(queue.GetFd(), 0));
+    EXPECT_EQ(queue.Read(nullptr, QUEUE_CAPACITY), 0U);
+}
+} // namespace Sensors
+} // namespace OHOS
@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstring>
+
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+#include "sensor_agent_type.h"
+#include "sensor_errors.h"
+#include "sensor_trace_file.h"
+
+#undef LOG_TAG
+#define LOG_TAG "SensorTraceFileTest"
+
+namespace OHOS {
+namespace Sensors {
+using namespace testing::ext;
+using namespace OHOS::HiviewDFX;
+
+namespace {
+const std::string TRACE_PATH = "/data/local/tmp/sensor_trace_test.bin";
+constexpr int64_t BASE_TIMESTAMP = 1000000000;
+constexpr int64_t SAMPLING_INTERVAL_NS = 5000000;
+constexpr uint32_t RECORD_COUNT = 1000;
+constexpr uint32_t LARGE_RECORD_COUNT = 20000;
+constexpr uint32_t ACC_DATA_LEN = 12;
+
+SensorData CreateSensorData(uint32_t index)
+{
+    SensorData data = {};
+    data.sensorTypeId = (index % 2 == 0) ? SENSOR_TYPE_ID_ACCELEROMETER : SENSOR_TYPE_ID_GYROSCOPE;
+    data.version = 1;
+    data.timestamp = BASE_TIMESTAMP + static_cast<int64_t>(index) * SAMPLING_INTERVAL_NS;
+    data.option = static_cast<int32_t>(index % 3);
+    data.mode = SENSOR_REALTIME_MODE;
+    data.dataLen = ACC_DATA_LEN;
+    for (uint32_t i = 0; i < ACC_DATA_LEN; ++i) {
+        data.data[i] = static_cast<uint8_t>(index + i);
+    }
+    data.deviceId = 1;
+    data.sensorId = 0;
+    data.location = 1;
+    return data;
+}
+} // namespace
+
+class SensorTraceFileTest : public testing::Test {
+public:
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp();
+    void TearDown();
+};
+
+void SensorTraceFileTest::SetUpTestCase() {}
+
+void SensorTraceFileTest::TearDownTestCase()
+{
+    unlink(TRACE_PATH.c_str());
+}
+
+void SensorTraceFileTest::SetUp() {}
+
+void SensorTraceFileTest::TearDown() {}
+
+HWTEST_F(SensorTraceFileTest, SensorTraceFileTest_001, TestSize.Level1)
+{
+    SEN_HILOGI("SensorTraceFileTest_001 in");
+    SensorTraceWriter writer;
+    ASSERT_EQ(writer.Open(TRACE_PATH), ERR_OK);
+    ASSERT_TRUE(writer.IsOpen());
+    for (uint32_t i = 0; i < RECORD_COUNT; ++i) {
+        ASSERT_EQ(writer.Append(CreateSensorData(i)), ERR_OK);
+    }
+    ASSERT_EQ(writer.Close(), ERR_OK);
+    SensorTraceReader reader;
+    ASSERT_EQ(reader.Open(TRACE_PATH), ERR_OK);
+    const SensorTraceHeader *header = reader.GetHeader();
+    ASSERT_NE(header, nullptr);
+    EXPECT_EQ(header->recordCount, RECORD_COUNT);
+    EXPECT_EQ(header->firstTimestamp, BASE_TIMESTAMP);
+    EXPECT_LT(header->payloadSize, sizeof(SensorData) * RECORD_COUNT);
+    SensorData data = {};
+    uint32_t count = 0;
+    while (reader.Next(data)) {
+        SensorData expected = CreateSensorData(count);
+        ASSERT_EQ(data.sensorTypeId, expected.sensorTypeId);
+        ASSERT_EQ(data.timestamp, expected.timestamp);
+        ASSERT_EQ(data.option, expected.option);
+        ASSERT_EQ(data.dataLen, expected.dataLen);
+        ASSERT_EQ(memcmp(data.data, expected.data, expected.dataLen), 0);
+        ++count;
+    }
+    EXPECT_EQ(count, RECORD_COUNT);
+    reader.Rewind();
+    ASSERT_TRUE(reader.Next(data));
+    EXPECT_EQ(data.timestamp, BASE_TIMESTAMP);
+}
+
+HWTEST_F(SensorTraceFileTest, SensorTraceFileTest_002, TestSize.Level1)
+{
+    SEN_HILOGI("SensorTraceFileTest_002 in");
+    SensorTraceWriter writer;
+    ASSERT_NE(writer.Append(CreateSensorData(0)), ERR_OK);
+    ASSERT_EQ(writer.Open(TRACE_PATH), ERR_OK);
+    ASSERT_NE(writer.Open(TRACE_PATH), ERR_OK);
+    SensorData data = CreateSensorData(0);
+    data.dataLen = SENSOR_MAX_LENGTH + 1;
+    ASSERT_NE(writer.Append(data), ERR_OK);
+    ASSERT_EQ(writer.Close(), ERR_OK);
+    SensorTraceReader reader;
+    ASSERT_NE(reader.Open(""), ERR_OK);
+    ASSERT_EQ(reader.Open(TRACE_PATH), ERR_OK);
+    ASSERT_FALSE(reader.Next(data));
+}
+
+HWTEST_F(SensorTraceFileTest, SensorTraceFileTest_003, TestSize.Level1)
+{
+    SEN_HILOGI("SensorTraceFileTest_003 in");
+    SensorTraceWriter writer;
+    ASSERT_EQ(writer.Open(TRACE_PATH), ERR_OK);
+    for (uint32_t i = 0; i < LARGE_RECORD_COUNT; ++i) {
+        ASSERT_EQ(writer.Append(CreateSensorData(i)), ERR_OK);
+    }
+    ASSERT_EQ(writer.Close(), ERR_OK);
+    ASSERT_FALSE(writer.IsOpen());
+    ASSERT_NE(writer.Append(CreateSensorData(0)), ERR_OK);
+    SensorTraceReader reader;
+    ASSERT_EQ(reader.Open(TRACE_PATH), ERR_OK);
+    const SensorTraceHeader *header = reader.GetHeader();
+    ASSERT_NE(header, nullptr);
+    EXPECT_EQ(header->recordCount, LARGE_RECORD_COUNT);
+    SensorData data = {};
+    uint32_t count = 0;
+    while (reader.Next(data)) {
+        SensorData expected = CreateSensorData(count);
+        ASSERT_EQ(data.timestamp, expected.timestamp);
+        ASSERT_EQ(memcmp(data.data, expected.data, expected.dataLen), 0);
+        ++count;
+    }
+    EXPECT_EQ(count, LARGE_RECORD_COUNT);
+}
+} // namespace Sensors
+} // namespace OHOS
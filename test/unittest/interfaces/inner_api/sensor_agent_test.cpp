@@ -14,6 +14,7 @@
  */
 
 #include <cinttypes>
+#include <sched.h>
 #include <gtest/gtest.h>
 #include <thread>
 
@@ -671,5 +672,72 @@ HWTEST_F(SensorAgentTest, UnsubscribeSensorPlugTest_002, TestSize.Level1)
     ret = UnsubscribeSensorPlug(&user);
     ASSERT_EQ(ret, OHOS::ERR_OK);
 }
+
+HWTEST_F(SensorAgentTest, EnableSensorPollingTest_001, TestSize.Level1)
+{
+    SEN_HILOGI("EnableSensorPollingTest_001 in");
+    SensorUser user;
+    user.callback = SensorDataCallbackImpl;
+    int32_t fd = -1;
+    int32_t ret = EnableSensorPolling(nullptr, 1, &fd);
+    ASSERT_NE(ret, OHOS::ERR_OK);
+    ret = EnableSensorPolling(&user, 0, &fd);
+    ASSERT_NE(ret, OHOS::ERR_OK);
+    ret = EnableSensorPolling(&user, 1, nullptr);
+    ASSERT_NE(ret, OHOS::ERR_OK);
+    ret = DisableSensorPolling(&user);
+    ASSERT_NE(ret, OHOS::ERR_OK);
+}
+
+HWTEST_F(SensorAgentTest, ReadSensorEventsTest_001, TestSize.Level1)
+{
+    SEN_HILOGI("ReadSensorEventsTest_001 in");
+    SensorUser user;
+    user.callback = SensorDataCallbackImpl;
+    int32_t fd = -1;
+    int32_t ret = EnableSensorPolling(&user, 8, &fd);
+    ASSERT_EQ(ret, OHOS::ERR_OK);
+    ASSERT_GE(fd, 0);
+    ret = EnableSensorPolling(&user, 8, &fd);
+    ASSERT_NE(ret, OHOS::ERR_OK);
+    SensorEventRecord events[8];
+    uint32_t count = 1;
+    ret = ReadSensorEvents(&user, events, 8, &count);
+    ASSERT_EQ(ret, OHOS::ERR_OK);
+    ASSERT_EQ(count, 0);
+    ret = DisableSensorPolling(&user);
+    ASSERT_EQ(ret, OHOS::ERR_OK);
+    ret = ReadSensorEvents(&user, events, 8, &count);
+    ASSERT_NE(ret, OHOS::ERR_OK);
+}
+
+HWTEST_F(SensorAgentTest, SetSensorReceiveConfigTest_001, TestSize.Level1)
+{
+    SEN_HILOGI("SetSensorReceiveConfigTest_001 in");
+    int32_t ret = SetSensorReceiveConfig(nullptr);
+    ASSERT_NE(ret, OHOS::ERR_OK);
+    SensorReceiveConfig config;
+    config.mode = static_cast<SensorReceiveMode>(INVALID_VALUE);
+    ret = SetSensorReceiveConfig(&config);
+    ASSERT_NE(ret, OHOS::ERR_OK);
+    config.mode = SENSOR_RECEIVE_DEDICATED;
+    config.cpuId = CPU_SETSIZE;
+    ret = SetSensorReceiveConfig(&config);
+    ASSERT_NE(ret, OHOS::ERR_OK);
+}
+
+HWTEST_F(SensorAgentTest, GetSensorReceiveStatsTest_001, TestSize.Level1)
+{
+    SEN_HILOGI("GetSensorReceiveStatsTest_001 in");
+    int32_t ret = GetSensorReceiveStats(nullptr);
+    ASSERT_NE(ret, OHOS::ERR_OK);
+    SensorReceiveStats stats;
+    ret = GetSensorReceiveStats(&stats);
+    ASSERT_EQ(ret, OHOS::ERR_OK);
+    ASSERT_GE(stats.maxLatencyNs, stats.avgLatencyNs);
+    ASSERT_GE(stats.maxNewestLatencyNs, stats.avgNewestLatencyNs);
+    ASSERT_GE(stats.maxLatencyNs, stats.maxNewestLatencyNs);
+    ASSERT_GE(stats.maxDispatchNs, stats.avgDispatchNs);
+}
 } // namespace Sensors
 } // namespace OHOS
@@ -16,6 +16,7 @@
 #include <cinttypes>
 #include <memory>
 #include <gtest/gtest.h>
+#include <poll.h>
 #include <thread>
 
 #include "accesstoken_kit.h"
@@ -40,6 +41,7 @@ constexpr int64_t SENSOR_SAMPLE_PERIOD = 200000000;
 constexpr int32_t SLEEP_TIME_MS = 1000;
 constexpr int64_t INVALID_VALUE = -1;
 constexpr float INVALID_RESOLUTION = -1.0F;
+constexpr uint32_t POLL_QUEUE_CAPACITY = 16;
 Sensor_Subscriber *g_user = nullptr;
 std::atomic_bool g_existAmbientLight = false;
 } // namespace
@@ -111,6 +113,18 @@ void SensorDataCallbackImpl(Sensor_Event *event)
     }
 }
 
+void SensorBatchDataCallbackImpl(Sensor_BatchEvent *events, uint32_t count)
+{
+    if (events == nullptr) {
+        SEN_HILOGE("events is null");
+        return;
+    }
+    for (uint32_t i = 0; i < count; ++i) {
+        SEN_HILOGI("sensorType:%{public}d, timestamp:%{public}" PRId64 ", dataLen:%{public}u",
+            events[i].sensorType, events[i].timestamp, events[i].dataLength);
+    }
+}
+
 void SensorDataCallbackImpl1(Sensor_Event *event)
 {
     if (event == nullptr) {
@@ -712,5 +726,177 @@ HWTEST_F(SensorAgentTest, OH_SensorSubscriber_GetCallback_003, TestSize.Level1)
         OH_Sensor_DestroySubscriber(g_user);
     }
 }
+
+HWTEST_F(SensorAgentTest, OH_SensorSubscriptionAttribute_SetReportingInterval_001, TestSize.Level1)
+{
+    SEN_HILOGI("OH_SensorSubscriptionAttribute_SetReportingInterval_001 in");
+    int32_t ret = OH_SensorSubscriptionAttribute_SetReportingInterval(nullptr, SENSOR_SAMPLE_PERIOD);
+    ASSERT_EQ(ret, SENSOR_PARAMETER_ERROR);
+    Sensor_SubscriptionAttribute *attr = OH_Sensor_CreateSubscriptionAttribute();
+    ret = OH_SensorSubscriptionAttribute_SetReportingInterval(attr, INVALID_VALUE);
+    ASSERT_EQ(ret, SENSOR_PARAMETER_ERROR);
+    int64_t reportingInterval = 0;
+    ret = OH_SensorSubscriptionAttribute_GetReportingInterval(attr, &reportingInterval);
+    ASSERT_EQ(ret, SENSOR_SUCCESS);
+    ASSERT_EQ(reportingInterval, INVALID_VALUE);
+    ret = OH_SensorSubscriptionAttribute_SetReportingInterval(attr, SENSOR_SAMPLE_PERIOD);
+    ASSERT_EQ(ret, SENSOR_SUCCESS);
+    ret = OH_SensorSubscriptionAttribute_GetReportingInterval(attr, &reportingInterval);
+    ASSERT_EQ(ret, SENSOR_SUCCESS);
+    ASSERT_EQ(reportingInterval, SENSOR_SAMPLE_PERIOD);
+    if (attr != nullptr) {
+        OH_Sensor_DestroySubscriptionAttribute(attr);
+    }
+}
+
+HWTEST_F(SensorAgentTest, OH_SensorSubscriber_SetBatchCallback_001, TestSize.Level1)
+{
+    SEN_HILOGI("OH_SensorSubscriber_SetBatchCallback_001 in");
+    int32_t ret = OH_SensorSubscriber_SetBatchCallback(nullptr, SensorBatchDataCallbackImpl);
+    ASSERT_EQ(ret, SENSOR_PARAMETER_ERROR);
+    g_user = OH_Sensor_CreateSubscriber();
+    ret = OH_SensorSubscriber_SetBatchCallback(g_user, nullptr);
+    ASSERT_EQ(ret, SENSOR_PARAMETER_ERROR);
+    Sensor_BatchEventCallback callback = nullptr;
+    ret = OH_SensorSubscriber_GetBatchCallback(g_user, nullptr);
+    ASSERT_EQ(ret, SENSOR_PARAMETER_ERROR);
+    ret = OH_SensorSubscriber_SetBatchCallback(g_user, SensorBatchDataCallbackImpl);
+    ASSERT_EQ(ret, SENSOR_SUCCESS);
+    ret = OH_SensorSubscriber_GetBatchCallback(g_user, &callback);
+    ASSERT_EQ(ret, SENSOR_SUCCESS);
+    ASSERT_EQ(callback, SensorBatchDataCallbackImpl);
+    if (g_user != nullptr) {
+        OH_Sensor_DestroySubscriber(g_user);
+        g_user = nullptr;
+    }
+}
+
+HWTEST_F(SensorAgentTest, OH_SensorSubscriber_SetBatchCallback_002, TestSize.Level1)
+{
+    SEN_HILOGI("OH_SensorSubscriber_SetBatchCallback_002 in");
+    if (g_existAmbientLight) {
+        g_user = OH_Sensor_CreateSubscriber();
+        int32_t ret = OH_SensorSubscriber_SetCallback(g_user, SensorDataCallbackImpl);
+        ASSERT_EQ(ret, SENSOR_SUCCESS);
+        ret = OH_SensorSubscriber_SetBatchCallback(g_user, SensorBatchDataCallbackImpl);
+        ASSERT_EQ(ret, SENSOR_SUCCESS);
+
+        Sensor_SubscriptionId *id = OH_Sensor_CreateSubscriptionId();
+        ret = OH_SensorSubscriptionId_SetType(id, SENSOR_ID);
+        ASSERT_EQ(ret, SENSOR_SUCCESS);
+
+        Sensor_SubscriptionAttribute *attr = OH_Sensor_CreateSubscriptionAttribute();
+        ret = OH_SensorSubscriptionAttribute_SetSamplingInterval(attr, SENSOR_SAMPLE_PERIOD);
+        ASSERT_EQ(ret, SENSOR_SUCCESS);
+        ret = OH_SensorSubscriptionAttribute_SetReportingInterval(attr, SENSOR_SAMPLE_PERIOD);
+        ASSERT_EQ(ret, SENSOR_SUCCESS);
+
+        ret = OH_Sensor_Subscribe(id, attr, g_user);
+        ASSERT_EQ(ret, SENSOR_SUCCESS);
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(SLEEP_TIME_MS));
+        ret = OH_Sensor_Unsubscribe(id, g_user);
+        ASSERT_EQ(ret, SENSOR_SUCCESS);
+        if (id != nullptr) {
+            OH_Sensor_DestroySubscriptionId(id);
+        }
+        if (attr != nullptr) {
+            OH_Sensor_DestroySubscriptionAttribute(attr);
+        }
+        if (g_user != nullptr) {
+            OH_Sensor_DestroySubscriber(g_user);
+            g_user = nullptr;
+        }
+    }
+}
+
+HWTEST_F(SensorAgentTest, OH_SensorSubscriber_EnablePolling_001, TestSize.Level1)
+{
+    SEN_HILOGI("OH_SensorSubscriber_EnablePolling_001 in");
+    int32_t fd = -1;
+    int32_t ret = OH_SensorSubscriber_EnablePolling(nullptr, POLL_QUEUE_CAPACITY, &fd);
+    ASSERT_EQ(ret, SENSOR_PARAMETER_ERROR);
+    g_user = OH_Sensor_CreateSubscriber();
+    ret = OH_SensorSubscriber_EnablePolling(g_user, 0, &fd);
+    ASSERT_EQ(ret, SENSOR_PARAMETER_ERROR);
+    ret = OH_SensorSubscriber_EnablePolling(g_user, POLL_QUEUE_CAPACITY, nullptr);
+    ASSERT_EQ(ret, SENSOR_PARAMETER_ERROR);
+    Sensor_PolledEvent events[POLL_QUEUE_CAPACITY];
+    uint32_t count = 0;
+    ret = OH_SensorSubscriber_ReadEvents(g_user, events, POLL_QUEUE_CAPACITY, &count);
+    ASSERT_EQ(ret, SENSOR_SERVICE_EXCEPTION);
+    ret = OH_SensorSubscriber_EnablePolling(g_user, POLL_QUEUE_CAPACITY, &fd);
+    ASSERT_EQ(ret, SENSOR_SUCCESS);
+    ASSERT_GE(fd, 0);
+    ret = OH_SensorSubscriber_ReadEvents(g_user, nullptr, POLL_QUEUE_CAPACITY, &count);
+    ASSERT_EQ(ret, SENSOR_PARAMETER_ERROR);
+    ret = OH_SensorSubscriber_ReadEvents(g_user, events, POLL_QUEUE_CAPACITY, &count);
+    ASSERT_EQ(ret, SENSOR_SUCCESS);
+    ASSERT_EQ(count, 0U);
+    ret = OH_SensorSubscriber_DisablePolling(g_user);
+    ASSERT_EQ(ret, SENSOR_SUCCESS);
+    ret = OH_SensorSubscriber_DisablePolling(g_user);
+    ASSERT_EQ(ret, SENSOR_SERVICE_EXCEPTION);
+    if (g_user != nullptr) {
+        OH_Sensor_DestroySubscriber(g_user);
+        g_user = nullptr;
+    }
+}
+
+HWTEST_F(SensorAgentTest, OH_SensorSubscriber_EnablePolling_002, TestSize.Level1)
+{
+    SEN_HILOGI("OH_SensorSubscriber_EnablePolling_002 in");
+    if (g_existAmbientLight) {
+        g_user = OH_Sensor_CreateSubscriber();
+        int32_t ret = OH_SensorSubscriber_SetCallback(g_user, SensorDataCallbackImpl);
+        ASSERT_EQ(ret, SENSOR_SUCCESS);
+        int32_t fd = -1;
+        ret = OH_SensorSubscriber_EnablePolling(g_user, POLL_QUEUE_CAPACITY, &fd);
+        ASSERT_EQ(ret, SENSOR_SUCCESS);
+
+        Sensor_SubscriptionId *id = OH_Sensor_CreateSubscriptionId();
+        ret = OH_SensorSubscriptionId_SetType(id, SENSOR_ID);
+        ASSERT_EQ(ret, SENSOR_SUCCESS);
+
+        Sensor_SubscriptionAttribute *attr = OH_Sensor_CreateSubscriptionAttribute();
+        ret = OH_SensorSubscriptionAttribute_SetSamplingInterval(attr, SENSOR_SAMPLE_PERIOD);
+        ASSERT_EQ(ret, SENSOR_SUCCESS);
+
+        ret = OH_Sensor_Subscribe(id, attr, g_user);
+        ASSERT_EQ(ret, SENSOR_SUCCESS);
+
+        struct pollfd pfd = { .fd = fd, .events = POLLIN, .revents = 0 };
+        ASSERT_EQ(poll(&pfd, 1, SLEEP_TIME_MS * 3), 1);
+        Sensor_PolledEvent events[POLL_QUEUE_CAPACITY];
+        uint32_t count = 0;
+        ret = OH_SensorSubscriber_ReadEvents(g_user, events, POLL_QUEUE_CAPACITY, &count);
+        ASSERT_EQ(ret, SENSOR_SUCCESS);
+        ASSERT_GT(count, 0U);
+        for (uint32_t i = 0; i < count; ++i) {
+            ASSERT_EQ(events[i].sensorType, SENSOR_ID);
+            ASSERT_GT(events[i].dataLength, 0U);
+            ASSERT_LE(events[i].dataLength, sizeof(events[i].data));
+            if (i > 0) {
+                ASSERT_GE(events[i].timestamp, events[i - 1].timestamp);
+            }
+        }
+
+        ret = OH_Sensor_Unsubscribe(id, g_user);
+        ASSERT_EQ(ret, SENSOR_SUCCESS);
+        // Leaving the last sensor releases the queue
+        ret = OH_SensorSubscriber_ReadEvents(g_user, events, POLL_QUEUE_CAPACITY, &count);
+        ASSERT_EQ(ret, SENSOR_SERVICE_EXCEPTION);
+        if (id != nullptr) {
+            OH_Sensor_DestroySubscriptionId(id);
+        }
+        if (attr != nullptr) {
+            OH_Sensor_DestroySubscriptionAttribute(attr);
+        }
+        if (g_user != nullptr) {
+            OH_Sensor_DestroySubscriber(g_user);
+            g_user = nullptr;
+        }
+    }
+}
 } // namespace Sensors
 } // namespace OHOS
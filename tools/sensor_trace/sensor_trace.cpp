@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+#include <map>
+
+#include "report_data_callback.h"
+#include "sensor.h"
+#include "sensor_errors.h"
+#include "sensor_trace_file.h"
+
+#undef LOG_TAG
+#define LOG_TAG "SensorTrace"
+
+using namespace OHOS;
+using namespace OHOS::Sensors;
+
+namespace {
+constexpr int32_t MIN_ARGC = 3;
+constexpr double NS_PER_SECOND = 1000000000.0;
+
+void PrintUsage(const char *name)
+{
+    printf("Usage: %s <command> <trace>\n", name);
+    printf("  info   Print the trace header and the event count and rate of each sensor\n");
+    printf("  bench  Decode the trace and feed it through ReportDataCallback as fast as possible\n");
+    printf("Recording and replay are driven by the sensor service on eng builds:\n");
+    printf("  param set sensors.trace.record.path <trace>   record events entering the service\n");
+    printf("  param set sensors.trace.replay.path <trace>   replay the trace instead of the sensor hdi\n");
+    printf("  param set sensors.trace.replay.speed <n>      replay at n times the recorded pace, 0 for max\n");
+    printf("  param set sensors.trace.replay.loop true      restart from the beginning at the end of the trace\n");
+}
+
+struct SensorTraceSummary {
+    uint64_t count = 0;
+    int64_t firstTimestamp = 0;
+    int64_t lastTimestamp = 0;
+};
+
+int32_t PrintInfo(SensorTraceReader &reader)
+{
+    const SensorTraceHeader *header = reader.GetHeader();
+    printf("version:%u records:%" PRIu64 " payload:%" PRIu64 " bytes duration:%.3f s\n", header->version,
+        header->recordCount, header->payloadSize,
+        static_cast<double>(header->lastTimestamp - header->firstTimestamp) / NS_PER_SECOND);
+    std::map<SensorDescription, SensorTraceSummary> summaries;
+    SensorData data = {};
+    while (reader.Next(data)) {
+        auto &summary = summaries[{data.deviceId, data.sensorTypeId, data.sensorId, data.location}];
+        if (summary.count == 0) {
+            summary.firstTimestamp = data.timestamp;
+        }
+        summary.lastTimestamp = data.timestamp;
+        ++summary.count;
+    }
+    for (const auto &[sensorDesc, summary] : summaries) {
+        double duration = static_cast<double>(summary.lastTimestamp - summary.firstTimestamp) / NS_PER_SECOND;
+        double rate = (duration > 0) ? static_cast<double>(summary.count - 1) / duration : 0;
+        printf("deviceId:%d sensorType:%d sensorId:%d location:%d events:%" PRIu64 " rate:%.1f Hz\n",
+            sensorDesc.deviceId, sensorDesc.sensorType, sensorDesc.sensorId, sensorDesc.location, summary.count,
+            rate);
+    }
+    return 0;
+}
+
+int32_t RunBench(SensorTraceReader &reader)
+{
+    sptr<ReportDataCallback> reportDataCallback = new (std::nothrow) ReportDataCallback();
+    if (reportDataCallback == nullptr) {
+        printf("Create ReportDataCallback failed\n");
+        return -1;
+    }
+    SensorData data = {};
+    uint64_t count = 0;
+    auto start = std::chrono::steady_clock::now();
+    while (reader.Next(data)) {
+        reportDataCallback->ReportEventCallback(&data, reportDataCallback);
+        ++count;
+    }
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+    double seconds = static_cast<double>(elapsed.count()) / NS_PER_SECOND;
+    printf("events:%" PRIu64 " elapsed:%.3f s throughput:%.0f events/s cost:%.1f ns/event\n", count, seconds,
+        (seconds > 0) ? static_cast<double>(count) / seconds : 0,
+        (count > 0) ? static_cast<double>(elapsed.count()) / static_cast<double>(count) : 0);
+    return 0;
+}
+} // namespace
+
+int32_t main(int32_t argc, char *argv[])
+{
+    if (argc < MIN_ARGC) {
+        PrintUsage(argv[0]);
+        return -1;
+    }
+    SensorTraceReader reader;
+    if (reader.Open(argv[2]) != ERR_OK) {
+        printf("Open trace %s failed\n", argv[2]);
+        return -1;
+    }
+    if (strcmp(argv[1], "info") == 0) {
+        return PrintInfo(reader);
+    }
+    if (strcmp(argv[1], "bench") == 0) {
+        return RunBench(reader);
+    }
+    PrintUsage(argv[0]);
+    return -1;
+}
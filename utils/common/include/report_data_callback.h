@@ -16,6 +16,7 @@
 #ifndef REPORT_DATA_CALLBACK_H
 #define REPORT_DATA_CALLBACK_H
 
+#include <memory>
 #include <vector>
 
 #include "refbase.h"
@@ -23,6 +24,7 @@
 
 namespace OHOS {
 namespace Sensors {
+class SensorTraceWriter;
 
 constexpr int32_t CIRCULAR_BUF_LEN = 1024;
 constexpr int32_t SENSOR_DATA_LENGTH = 64;
@@ -40,7 +42,12 @@ public:
     ~ReportDataCallback();
     int32_t ReportEventCallback(SensorData *sensorData, sptr<ReportDataCallback> cb);
     CircularEventBuf &GetEventData();
+    void SetTraceWriter(std::shared_ptr<SensorTraceWriter> traceWriter);
     CircularEventBuf eventsBuf_;
+
+private:
+    // Present in every build variant, the layout must not depend on defines that are not exported to users
+    std::shared_ptr<SensorTraceWriter> traceWriter_ = nullptr;
 };
 
 using ReportDataCb = int32_t (ReportDataCallback::*)(SensorData *sensorData, sptr<ReportDataCallback> cb);
@@ -68,6 +68,7 @@ struct SensorPlugData {
     int32_t status = -1;            /**< Device on or out status */
     int32_t reserved = -1;          /**< Reserved */
     int64_t timestamp = -1;         /**< Time when sensor plug data was reported */
+    uint32_t generation = 0;        /**< Sensor list generation once this plug event has been applied */
 };
 } // namespace Sensors
 } // namespace OHOS
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef SENSOR_DESCRIPTOR_H
+#define SENSOR_DESCRIPTOR_H
+
+#include <cstdint>
+#include <vector>
+
+#include "sensor.h"
+#include "sensor_agent_type.h"
+
+namespace OHOS {
+namespace Sensors {
+/*
+ * Packed, fixed-layout description of one sensor. The strings live in the string table that follows the
+ * descriptors of a blob, each distinct string is stored there once and referenced by its byte offset.
+ */
+struct SensorDescriptor {
+    int32_t deviceId;
+    int32_t sensorTypeId;
+    int32_t sensorId;
+    int32_t location;
+    uint32_t sensorNameOffset;
+    uint32_t vendorNameOffset;
+    uint32_t firmwareVersionOffset;
+    uint32_t hardwareVersionOffset;
+    float maxRange;
+    float resolution;
+    float power;
+    uint32_t flags;
+    int32_t fifoMaxEventCount;
+    int32_t isMockSensor;
+    int64_t minSamplePeriodNs;
+    int64_t maxSamplePeriodNs;
+};
+
+/* Upper bound of the string table bytes one sensor adds, every string with its terminating zero */
+constexpr size_t SENSOR_DESCRIPTOR_STRINGS_MAX = NAME_MAX_LEN * 2 + VERSION_MAX_LEN * 2;
+
+/*
+ * A sensor list as one contiguous buffer: count descriptors followed by the string table. Bindings read the
+ * descriptors in place and fill their own records, without going through Sensor and its std::string members.
+ */
+class SensorDescriptorBlob {
+public:
+    SensorDescriptorBlob() = default;
+    ~SensorDescriptorBlob() = default;
+    int32_t Pack(const std::vector<Sensor> &sensorList);
+    int32_t Assign(const uint8_t *data, size_t size, uint32_t count);
+    void Clear();
+    const uint8_t *GetData() const;
+    size_t GetSize() const;
+    uint32_t GetCount() const;
+    const SensorDescriptor &GetDescriptor(uint32_t index) const;
+    const char *GetString(uint32_t offset) const;
+    int32_t ToSensorInfo(uint32_t index, SensorInfo &sensorInfo) const;
+    void ToSensor(uint32_t index, Sensor &sensor) const;
+
+private:
+    std::vector<uint8_t> data_;
+    uint32_t count_ { 0 };
+};
+} // namespace Sensors
+} // namespace OHOS
+#endif // SENSOR_DESCRIPTOR_H
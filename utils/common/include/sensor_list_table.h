@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef SENSOR_LIST_TABLE_H
+#define SENSOR_LIST_TABLE_H
+
+#include <atomic>
+#include <vector>
+
+#include "nocopyable.h"
+
+#include "sensor.h"
+#include "sensor_descriptor.h"
+
+namespace OHOS {
+namespace Sensors {
+constexpr uint32_t SENSOR_LIST_TABLE_MAGIC = 0x534C5442;
+constexpr uint32_t SENSOR_LIST_TABLE_INVALID_VERSION = 0;
+constexpr uint32_t SENSOR_LIST_TABLE_VERSION_STEP = 2;
+
+/*
+ * Layout of the shared sensor list table. The service is the only writer; clients map the region read-only.
+ * The sequence counter works as a seqlock: it is odd while the service rewrites the entries and even otherwise,
+ * and every completed rewrite leaves a new even value which clients use as the sensor list version.
+ * The header is followed by a SensorDescriptorBlob: count descriptors, then stringTableSize bytes of strings.
+ */
+struct SensorListTableHeader {
+    uint32_t magic;
+    uint32_t descriptorSize;
+    uint32_t capacity;
+    uint32_t count;
+    std::atomic<uint32_t> sequence;
+    uint32_t stringTableSize;
+};
+
+class SensorListTable {
+public:
+    SensorListTable() = default;
+    ~SensorListTable();
+    int32_t Create(uint32_t capacity);
+    int32_t Attach(int32_t fd);
+    void Close();
+    bool IsValid() const;
+    int32_t GetFd() const;
+    uint32_t GetVersion() const;
+    int32_t Publish(const std::vector<Sensor> &sensorList);
+    int32_t Read(std::vector<Sensor> &sensorList, uint32_t &version) const;
+    int32_t ReadByDevice(int32_t deviceId, std::vector<Sensor> &sensorList, uint32_t &version) const;
+    int32_t ReadBlob(SensorDescriptorBlob &blob, uint32_t &version) const;
+
+private:
+    DISALLOW_COPY_AND_MOVE(SensorListTable);
+    uint8_t *GetBlobData() const;
+    size_t GetBlobCapacity() const;
+    int32_t fd_ { -1 };
+    size_t size_ { 0 };
+    bool isWritable_ { false };
+    SensorListTableHeader *header_ { nullptr };
+};
+} // namespace Sensors
+} // namespace OHOS
+#endif // SENSOR_LIST_TABLE_H
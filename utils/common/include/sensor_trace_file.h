@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef SENSOR_TRACE_FILE_H
+#define SENSOR_TRACE_FILE_H
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "nocopyable.h"
+
+#include "sensor_data_event.h"
+
+namespace OHOS {
+namespace Sensors {
+constexpr uint32_t SENSOR_TRACE_MAGIC = 0x53545243;
+constexpr uint32_t SENSOR_TRACE_VERSION = 1;
+
+/*
+ * A sensor trace is this header followed by variable length records. Each record starts with a flag byte telling
+ * whether the sensor description and the version/option/mode fields repeat those of the previous record, then
+ * carries the zigzag varint timestamp delta, the fields that changed, the varint data length and the raw data.
+ */
+struct SensorTraceHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint64_t recordCount;
+    int64_t firstTimestamp;
+    int64_t lastTimestamp;
+    uint64_t payloadSize;
+};
+
+/*
+ * Records are encoded by the caller and written by a thread of the writer, so Append never blocks on the file. Once
+ * too much data waits for the file, or after a write failed, records are dropped whole and counted.
+ */
+class SensorTraceWriter {
+public:
+    SensorTraceWriter() = default;
+    ~SensorTraceWriter();
+    int32_t Open(const std::string &path);
+    int32_t Append(const SensorData &data);
+    int32_t Close();
+    bool IsOpen();
+
+private:
+    DISALLOW_COPY_AND_MOVE(SensorTraceWriter);
+    void QueueBufferLocked();
+    void WriteThread();
+    int32_t WriteChunk(const std::vector<uint8_t> &chunk);
+    int32_t WriteHeader();
+    std::mutex writerMutex_;
+    std::condition_variable writerCondition_;
+    std::thread writeThread_;
+    int32_t fd_ { -1 };
+    bool isStop_ { false };
+    bool isWriteFailed_ { false };
+    std::vector<uint8_t> buffer_;
+    std::deque<std::vector<uint8_t>> chunks_;
+    size_t pendingSize_ { 0 };
+    uint64_t droppedCount_ { 0 };
+    SensorTraceHeader header_ {};
+    SensorData lastData_ {};
+};
+
+class SensorTraceReader {
+public:
+    SensorTraceReader() = default;
+    ~SensorTraceReader();
+    int32_t Open(const std::string &path);
+    void Close();
+    const SensorTraceHeader *GetHeader() const;
+    bool Next(SensorData &data);
+    void Rewind();
+
+private:
+    DISALLOW_COPY_AND_MOVE(SensorTraceReader);
+    const uint8_t *base_ { nullptr };
+    size_t size_ { 0 };
+    size_t offset_ { 0 };
+    SensorData lastData_ {};
+};
+} // namespace Sensors
+} // namespace OHOS
+#endif // SENSOR_TRACE_FILE_H
@@ -15,6 +15,9 @@
 
 #include "report_data_callback.h"
 #include "sensor_errors.h"
+#ifdef BUILD_VARIANT_ENG
+#include "sensor_trace_file.h"
+#endif // BUILD_VARIANT_ENG
 
 #undef LOG_TAG
 #define LOG_TAG "ReportDataCallback"
@@ -50,6 +53,12 @@ int32_t ReportDataCallback::ReportEventCallback(SensorData *sensorData, sptr<Rep
         SEN_HILOGE("Callback or circularBuf or event cannot be null");
         return ERROR;
     }
+#ifdef BUILD_VARIANT_ENG
+    auto traceWriter = std::atomic_load(&cb->traceWriter_);
+    if (traceWriter != nullptr) {
+        traceWriter->Append(*sensorData);
+    }
+#endif // BUILD_VARIANT_ENG
     int32_t leftSize = CIRCULAR_BUF_LEN - cb->eventsBuf_.eventNum;
     int32_t toEndLen = CIRCULAR_BUF_LEN - cb->eventsBuf_.writePosition;
     if (leftSize < 0 || toEndLen < 0) {
@@ -80,5 +89,10 @@ CircularEventBuf &ReportDataCallback::GetEventData()
 {
     return eventsBuf_;
 }
+
+void ReportDataCallback::SetTraceWriter(std::shared_ptr<SensorTraceWriter> traceWriter)
+{
+    std::atomic_store(&traceWriter_, traceWriter);
+}
 } // namespace Sensors
 } // namespace OHOS
@@ -0,0 +1,222 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "sensor_descriptor.h"
+
+#include <cstring>
+#include <string>
+#include <unordered_map>
+
+#include "securec.h"
+
+#include "sensor_errors.h"
+
+#undef LOG_TAG
+#define LOG_TAG "SensorDescriptor"
+
+namespace OHOS {
+namespace Sensors {
+using namespace OHOS::HiviewDFX;
+namespace {
+static_assert(sizeof(SensorDescriptor) == 72, "Sensor descriptor layout is shared between processes");
+static_assert(alignof(SensorDescriptor) == alignof(int64_t), "Sensor descriptor must keep its alignment");
+
+class StringTable {
+public:
+    explicit StringTable(std::vector<uint8_t> &strings) : strings_(strings) {}
+    bool Intern(const std::string &str, size_t maxLen, uint32_t &offset)
+    {
+        if (str.size() >= maxLen) {
+            SEN_HILOGE("String is too long, size:%{public}zu, maxLen:%{public}zu", str.size(), maxLen);
+            return false;
+        }
+        auto it = offsets_.find(str);
+        if (it != offsets_.end()) {
+            offset = it->second;
+            return true;
+        }
+        offset = static_cast<uint32_t>(strings_.size());
+        strings_.insert(strings_.end(), str.begin(), str.end());
+        strings_.push_back('\0');
+        offsets_.emplace(str, offset);
+        return true;
+    }
+
+private:
+    std::vector<uint8_t> &strings_;
+    std::unordered_map<std::string, uint32_t> offsets_;
+};
+} // namespace
+
+int32_t SensorDescriptorBlob::Pack(const std::vector<Sensor> &sensorList)
+{
+    std::vector<SensorDescriptor> descriptors(sensorList.size());
+    std::vector<uint8_t> strings;
+    StringTable stringTable(strings);
+    for (size_t i = 0; i < sensorList.size(); ++i) {
+        const Sensor &sensor = sensorList[i];
+        SensorDescriptor &descriptor = descriptors[i];
+        if (!stringTable.Intern(sensor.GetSensorName(), NAME_MAX_LEN, descriptor.sensorNameOffset) ||
+            !stringTable.Intern(sensor.GetVendorName(), NAME_MAX_LEN, descriptor.vendorNameOffset) ||
+            !stringTable.Intern(sensor.GetFirmwareVersion(), VERSION_MAX_LEN, descriptor.firmwareVersionOffset) ||
+            !stringTable.Intern(sensor.GetHardwareVersion(), VERSION_MAX_LEN, descriptor.hardwareVersionOffset)) {
+            SEN_HILOGE("Intern string failed, sensorTypeId:%{public}d", sensor.GetSensorTypeId());
+            return ERROR;
+        }
+        descriptor.deviceId = sensor.GetDeviceId();
+        descriptor.sensorTypeId = sensor.GetSensorTypeId();
+        descriptor.sensorId = sensor.GetSensorId();
+        descriptor.location = sensor.GetLocation();
+        descriptor.maxRange = sensor.GetMaxRange();
+        descriptor.resolution = sensor.GetResolution();
+        descriptor.power = sensor.GetPower();
+        descriptor.flags = sensor.GetFlags();
+        descriptor.fifoMaxEventCount = sensor.GetFifoMaxEventCount();
+        descriptor.isMockSensor = sensor.GetIsMockSensor() ? 1 : 0;
+        descriptor.minSamplePeriodNs = sensor.GetMinSamplePeriodNs();
+        descriptor.maxSamplePeriodNs = sensor.GetMaxSamplePeriodNs();
+    }
+    size_t descriptorSize = sizeof(SensorDescriptor) * descriptors.size();
+    data_.resize(descriptorSize + strings.size());
+    if ((descriptorSize > 0) && (memcpy_s(data_.data(), data_.size(), descriptors.data(), descriptorSize) != EOK)) {
+        SEN_HILOGE("memcpy_s descriptors failed");
+        Clear();
+        return ERROR;
+    }
+    if (!strings.empty() && (memcpy_s(data_.data() + descriptorSize, data_.size() - descriptorSize,
+        strings.data(), strings.size()) != EOK)) {
+        SEN_HILOGE("memcpy_s strings failed");
+        Clear();
+        return ERROR;
+    }
+    count_ = static_cast<uint32_t>(descriptors.size());
+    return ERR_OK;
+}
+
+int32_t SensorDescriptorBlob::Assign(const uint8_t *data, size_t size, uint32_t count)
+{
+    size_t descriptorSize = sizeof(SensorDescriptor) * static_cast<size_t>(count);
+    if ((count > 0) && ((data == nullptr) || (size < descriptorSize))) {
+        SEN_HILOGE("Blob is too small, size:%{public}zu, count:%{public}u", size, count);
+        return ERROR;
+    }
+    size_t stringTableSize = size - descriptorSize;
+    // Every string ends before the end of the table, so reading from any valid offset stays inside the blob
+    if ((stringTableSize > 0) && (data[size - 1] != '\0')) {
+        SEN_HILOGE("String table is not terminated");
+        return ERROR;
+    }
+    const SensorDescriptor *descriptors = reinterpret_cast<const SensorDescriptor *>(data);
+    for (uint32_t i = 0; i < count; ++i) {
+        const SensorDescriptor &descriptor = descriptors[i];
+        if ((descriptor.sensorNameOffset >= stringTableSize) || (descriptor.vendorNameOffset >= stringTableSize) ||
+            (descriptor.firmwareVersionOffset >= stringTableSize) ||
+            (descriptor.hardwareVersionOffset >= stringTableSize)) {
+            SEN_HILOGE("String offset out of range, index:%{public}u", i);
+            return ERROR;
+        }
+    }
+    data_.assign(data, data + size);
+    count_ = count;
+    return ERR_OK;
+}
+
+void SensorDescriptorBlob::Clear()
+{
+    data_.clear();
+    count_ = 0;
+}
+
+const uint8_t *SensorDescriptorBlob::GetData() const
+{
+    return data_.data();
+}
+
+size_t SensorDescriptorBlob::GetSize() const
+{
+    return data_.size();
+}
+
+uint32_t SensorDescriptorBlob::GetCount() const
+{
+    return count_;
+}
+
+const SensorDescriptor &SensorDescriptorBlob::GetDescriptor(uint32_t index) const
+{
+    return reinterpret_cast<const SensorDescriptor *>(data_.data())[index];
+}
+
+const char *SensorDescriptorBlob::GetString(uint32_t offset) const
+{
+    return reinterpret_cast<const char *>(data_.data() + sizeof(SensorDescriptor) * count_ + offset);
+}
+
+int32_t SensorDescriptorBlob::ToSensorInfo(uint32_t index, SensorInfo &sensorInfo) const
+{
+    if (index >= count_) {
+        SEN_HILOGE("Invalid index:%{public}u, count:%{public}u", index, count_);
+        return ERROR;
+    }
+    const SensorDescriptor &descriptor = GetDescriptor(index);
+    if ((strcpy_s(sensorInfo.sensorName, NAME_MAX_LEN, GetString(descriptor.sensorNameOffset)) != EOK) ||
+        (strcpy_s(sensorInfo.vendorName, NAME_MAX_LEN, GetString(descriptor.vendorNameOffset)) != EOK) ||
+        (strcpy_s(sensorInfo.firmwareVersion, VERSION_MAX_LEN,
+            GetString(descriptor.firmwareVersionOffset)) != EOK) ||
+        (strcpy_s(sensorInfo.hardwareVersion, VERSION_MAX_LEN,
+            GetString(descriptor.hardwareVersionOffset)) != EOK)) {
+        SEN_HILOGE("strcpy_s failed, sensorTypeId:%{public}d", descriptor.sensorTypeId);
+        return ERROR;
+    }
+    sensorInfo.deviceId = descriptor.deviceId;
+    sensorInfo.sensorId = descriptor.sensorTypeId;
+    sensorInfo.sensorTypeId = descriptor.sensorTypeId;
+    sensorInfo.sensorIndex = descriptor.sensorId;
+    sensorInfo.location = descriptor.location;
+    sensorInfo.maxRange = descriptor.maxRange;
+    sensorInfo.precision = descriptor.resolution;
+    sensorInfo.power = descriptor.power;
+    sensorInfo.minSamplePeriod = descriptor.minSamplePeriodNs;
+    sensorInfo.maxSamplePeriod = descriptor.maxSamplePeriodNs;
+    sensorInfo.isMockSensor = (descriptor.isMockSensor != 0);
+    return ERR_OK;
+}
+
+void SensorDescriptorBlob::ToSensor(uint32_t index, Sensor &sensor) const
+{
+    if (index >= count_) {
+        SEN_HILOGE("Invalid index:%{public}u, count:%{public}u", index, count_);
+        return;
+    }
+    const SensorDescriptor &descriptor = GetDescriptor(index);
+    sensor.SetDeviceId(descriptor.deviceId);
+    sensor.SetSensorTypeId(descriptor.sensorTypeId);
+    sensor.SetSensorId(descriptor.sensorId);
+    sensor.SetLocation(descriptor.location);
+    sensor.SetSensorName(GetString(descriptor.sensorNameOffset));
+    sensor.SetVendorName(GetString(descriptor.vendorNameOffset));
+    sensor.SetFirmwareVersion(GetString(descriptor.firmwareVersionOffset));
+    sensor.SetHardwareVersion(GetString(descriptor.hardwareVersionOffset));
+    sensor.SetMaxRange(descriptor.maxRange);
+    sensor.SetResolution(descriptor.resolution);
+    sensor.SetPower(descriptor.power);
+    sensor.SetFlags(descriptor.flags);
+    sensor.SetFifoMaxEventCount(descriptor.fifoMaxEventCount);
+    sensor.SetIsMockSensor(descriptor.isMockSensor != 0);
+    sensor.SetMinSamplePeriodNs(descriptor.minSamplePeriodNs);
+    sensor.SetMaxSamplePeriodNs(descriptor.maxSamplePeriodNs);
+}
+} // namespace Sensors
+} // namespace OHOS
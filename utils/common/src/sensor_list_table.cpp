@@ -0,0 +1,303 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "sensor_list_table.h"
+
+#include <algorithm>
+#include <sys/mman.h>
+#include <thread>
+#include <unistd.h>
+
+#include "ashmem.h"
+#include "securec.h"
+
+#include "sensor_errors.h"
+
+#undef LOG_TAG
+#define LOG_TAG "SensorListTable"
+
+namespace OHOS {
+namespace Sensors {
+using namespace OHOS::HiviewDFX;
+namespace {
+const char *SENSOR_LIST_TABLE_NAME = "sensor_list_table";
+constexpr int32_t MAX_READ_RETRY_TIMES = 16;
+static_assert(std::atomic<uint32_t>::is_always_lock_free, "Sequence must be lock free in shared memory");
+static_assert(sizeof(SensorListTableHeader) % alignof(SensorDescriptor) == 0, "Descriptors must stay aligned");
+
+size_t GetTableSize(uint32_t capacity)
+{
+    return sizeof(SensorListTableHeader) +
+        (sizeof(SensorDescriptor) + SENSOR_DESCRIPTOR_STRINGS_MAX) * static_cast<size_t>(capacity);
+}
+} // namespace
+
+SensorListTable::~SensorListTable()
+{
+    Close();
+}
+
+int32_t SensorListTable::Create(uint32_t capacity)
+{
+    CALL_LOG_ENTER;
+    if (IsValid()) {
+        SEN_HILOGD("Sensor list table already created");
+        return ERR_OK;
+    }
+    if (capacity == 0) {
+        SEN_HILOGE("Invalid capacity");
+        return ERROR;
+    }
+    size_t size = GetTableSize(capacity);
+    int32_t fd = AshmemCreate(SENSOR_LIST_TABLE_NAME, size);
+    if (fd < 0) {
+        SEN_HILOGE("AshmemCreate failed, errno:%{public}d", errno);
+        return ERROR;
+    }
+    fdsan_exchange_owner_tag(fd, 0, TAG);
+    if (AshmemSetProt(fd, PROT_READ | PROT_WRITE) < 0) {
+        SEN_HILOGE("AshmemSetProt failed, errno:%{public}d", errno);
+        fdsan_close_with_tag(fd, TAG);
+        return ERROR;
+    }
+    void *addr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (addr == MAP_FAILED) {
+        SEN_HILOGE("mmap failed, errno:%{public}d", errno);
+        fdsan_close_with_tag(fd, TAG);
+        return ERROR;
+    }
+    // Mappings created after this point, in particular those of the clients, can only be read-only
+    if (AshmemSetProt(fd, PROT_READ) < 0) {
+        SEN_HILOGE("AshmemSetProt read only failed, errno:%{public}d", errno);
+        munmap(addr, size);
+        fdsan_close_with_tag(fd, TAG);
+        return ERROR;
+    }
+    header_ = new (addr) SensorListTableHeader();
+    header_->magic = SENSOR_LIST_TABLE_MAGIC;
+    header_->descriptorSize = sizeof(SensorDescriptor);
+    header_->capacity = capacity;
+    header_->count = 0;
+    header_->stringTableSize = 0;
+    header_->sequence.store(SENSOR_LIST_TABLE_INVALID_VERSION, std::memory_order_release);
+    fd_ = fd;
+    size_ = size;
+    isWritable_ = true;
+    return ERR_OK;
+}
+
+int32_t SensorListTable::Attach(int32_t fd)
+{
+    CALL_LOG_ENTER;
+    Close();
+    if (fd < 0) {
+        SEN_HILOGE("Invalid fd");
+        return ERROR;
+    }
+    fdsan_exchange_owner_tag(fd, 0, TAG);
+    int32_t size = AshmemGetSize(fd);
+    if (size < static_cast<int32_t>(sizeof(SensorListTableHeader))) {
+        SEN_HILOGE("Invalid table size:%{public}d", size);
+        fdsan_close_with_tag(fd, TAG);
+        return ERROR;
+    }
+    void *addr = mmap(nullptr, static_cast<size_t>(size), PROT_READ, MAP_SHARED, fd, 0);
+    if (addr == MAP_FAILED) {
+        SEN_HILOGE("mmap failed, errno:%{public}d", errno);
+        fdsan_close_with_tag(fd, TAG);
+        return ERROR;
+    }
+    auto header = static_cast<SensorListTableHeader *>(addr);
+    if ((header->magic != SENSOR_LIST_TABLE_MAGIC) || (header->descriptorSize != sizeof(SensorDescriptor)) ||
+        (GetTableSize(header->capacity) > static_cast<size_t>(size))) {
+        SEN_HILOGE("Sensor list table layout mismatch");
+        munmap(addr, static_cast<size_t>(size));
+        fdsan_close_with_tag(fd, TAG);
+        return ERROR;
+    }
+    header_ = header;
+    fd_ = fd;
+    size_ = static_cast<size_t>(size);
+    isWritable_ = false;
+    return ERR_OK;
+}
+
+void SensorListTable::Close()
+{
+    if (header_ != nullptr) {
+        munmap(static_cast<void *>(header_), size_);
+        header_ = nullptr;
+    }
+    if (fd_ >= 0) {
+        fdsan_close_with_tag(fd_, TAG);
+        fd_ = -1;
+    }
+    size_ = 0;
+    isWritable_ = false;
+}
+
+bool SensorListTable::IsValid() const
+{
+    return header_ != nullptr;
+}
+
+int32_t SensorListTable::GetFd() const
+{
+    return fd_;
+}
+
+uint32_t SensorListTable::GetVersion() const
+{
+    if (header_ == nullptr) {
+        return SENSOR_LIST_TABLE_INVALID_VERSION;
+    }
+    return header_->sequence.load(std::memory_order_acquire);
+}
+
+uint8_t *SensorListTable::GetBlobData() const
+{
+    return reinterpret_cast<uint8_t *>(header_) + sizeof(SensorListTableHeader);
+}
+
+size_t SensorListTable::GetBlobCapacity() const
+{
+    return size_ - sizeof(SensorListTableHeader);
+}
+
+int32_t SensorListTable::Publish(const std::vector<Sensor> &sensorList)
+{
+    CALL_LOG_ENTER;
+    CHKPR(header_, ERROR);
+    if (!isWritable_) {
+        SEN_HILOGE("Sensor list table is read only");
+        return ERROR;
+    }
+    size_t count = std::min(sensorList.size(), static_cast<size_t>(header_->capacity));
+    if (count < sensorList.size()) {
+        SEN_HILOGW("Sensor list is truncated, size:%{public}zu, capacity:%{public}u", sensorList.size(),
+            header_->capacity);
+    }
+    SensorDescriptorBlob blob;
+    if (blob.Pack(std::vector<Sensor>(sensorList.begin(), sensorList.begin() + count)) != ERR_OK) {
+        SEN_HILOGE("Pack sensor list failed");
+        return ERROR;
+    }
+    uint8_t *target = GetBlobData();
+    size_t blobSize = blob.GetSize();
+    size_t stringTableSize = blobSize - sizeof(SensorDescriptor) * count;
+    uint32_t sequence = header_->sequence.load(std::memory_order_relaxed);
+    if ((sequence != SENSOR_LIST_TABLE_INVALID_VERSION) && (header_->count == count) &&
+        (header_->stringTableSize == stringTableSize) &&
+        (blobSize == 0 || memcmp(target, blob.GetData(), blobSize) == 0)) {
+        SEN_HILOGD("Sensor list is not changed, version:%{public}u", sequence);
+        return ERR_OK;
+    }
+    uint32_t version = sequence + SENSOR_LIST_TABLE_VERSION_STEP;
+    if (version == SENSOR_LIST_TABLE_INVALID_VERSION) {
+        version = SENSOR_LIST_TABLE_VERSION_STEP;
+    }
+    header_->sequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    if (blobSize > 0 && memcpy_s(target, GetBlobCapacity(), blob.GetData(), blobSize) != EOK) {
+        SEN_HILOGE("memcpy_s failed");
+        header_->count = 0;
+        header_->stringTableSize = 0;
+        header_->sequence.store(version, std::memory_order_release);
+        return ERROR;
+    }
+    header_->count = static_cast<uint32_t>(count);
+    header_->stringTableSize = static_cast<uint32_t>(stringTableSize);
+    header_->sequence.store(version, std::memory_order_release);
+    SEN_HILOGI("Sensor list published, count:%{public}zu, size:%{public}zu, version:%{public}u", count, blobSize,
+        version);
+    return ERR_OK;
+}
+
+int32_t SensorListTable::ReadBlob(SensorDescriptorBlob &blob, uint32_t &version) const
+{
+    CHKPR(header_, ERROR);
+    std::vector<uint8_t> data;
+    for (int32_t i = 0; i < MAX_READ_RETRY_TIMES; ++i) {
+        uint32_t begin = header_->sequence.load(std::memory_order_acquire);
+        if (begin == SENSOR_LIST_TABLE_INVALID_VERSION) {
+            SEN_HILOGW("Sensor list table has not been published");
+            return ERROR;
+        }
+        if ((begin & 1) != 0) {
+            std::this_thread::yield();
+            continue;
+        }
+        uint32_t count = header_->count;
+        size_t blobSize = sizeof(SensorDescriptor) * static_cast<size_t>(count) + header_->stringTableSize;
+        if ((count > header_->capacity) || (blobSize > GetBlobCapacity())) {
+            std::this_thread::yield();
+            continue;
+        }
+        data.resize(blobSize);
+        if (blobSize > 0 && memcpy_s(data.data(), blobSize, GetBlobData(), blobSize) != EOK) {
+            SEN_HILOGE("memcpy_s failed");
+            return ERROR;
+        }
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (header_->sequence.load(std::memory_order_relaxed) != begin) {
+            continue;
+        }
+        if (blob.Assign(data.data(), data.size(), count) != ERR_OK) {
+            SEN_HILOGE("Sensor list blob is invalid");
+            return ERROR;
+        }
+        version = begin;
+        return ERR_OK;
+    }
+    SEN_HILOGE("Sensor list table is being updated, retry later");
+    return ERROR;
+}
+
+int32_t SensorListTable::Read(std::vector<Sensor> &sensorList, uint32_t &version) const
+{
+    CALL_LOG_ENTER;
+    SensorDescriptorBlob blob;
+    int32_t ret = ReadBlob(blob, version);
+    if (ret != ERR_OK) {
+        return ret;
+    }
+    sensorList.clear();
+    sensorList.resize(blob.GetCount());
+    for (uint32_t i = 0; i < blob.GetCount(); ++i) {
+        blob.ToSensor(i, sensorList[i]);
+    }
+    return ERR_OK;
+}
+
+int32_t SensorListTable::ReadByDevice(int32_t deviceId, std::vector<Sensor> &sensorList, uint32_t &version) const
+{
+    CALL_LOG_ENTER;
+    SensorDescriptorBlob blob;
+    int32_t ret = ReadBlob(blob, version);
+    if (ret != ERR_OK) {
+        return ret;
+    }
+    sensorList.clear();
+    for (uint32_t i = 0; i < blob.GetCount(); ++i) {
+        if (blob.GetDescriptor(i).deviceId == deviceId) {
+            Sensor sensor;
+            blob.ToSensor(i, sensor);
+            sensorList.push_back(sensor);
+        }
+    }
+    return ERR_OK;
+}
+} // namespace Sensors
+} // namespace OHOS
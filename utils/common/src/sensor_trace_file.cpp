@@ -0,0 +1,390 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "sensor_trace_file.h"
+
+#include <cinttypes>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/prctl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "securec.h"
+
+#include "sensor_errors.h"
+
+#undef LOG_TAG
+#define LOG_TAG "SensorTraceFile"
+
+namespace OHOS {
+namespace Sensors {
+using namespace OHOS::HiviewDFX;
+namespace {
+const std::string SENSOR_TRACE_THREAD_NAME = "OS_SenTraceWr";
+constexpr size_t FLUSH_THRESHOLD = 64 * 1024;
+constexpr size_t MAX_PENDING_SIZE = FLUSH_THRESHOLD * 16;
+constexpr size_t MAX_RECORD_SIZE = sizeof(SensorData) * 2;
+constexpr mode_t TRACE_FILE_MODE = 0640;
+constexpr uint8_t SAME_DESCRIPTION = 0x01;
+constexpr uint8_t SAME_ATTRIBUTE = 0x02;
+constexpr uint32_t VARINT_SHIFT = 7;
+constexpr uint8_t VARINT_MASK = 0x7F;
+constexpr uint8_t VARINT_MORE = 0x80;
+constexpr uint32_t MAX_VARINT_BYTES = 10;
+constexpr uint32_t SIGN_SHIFT = 63;
+
+uint64_t ZigZagEncode(int64_t value)
+{
+    return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> SIGN_SHIFT);
+}
+
+int64_t ZigZagDecode(uint64_t value)
+{
+    return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+}
+
+void PutVarint(std::vector<uint8_t> &buffer, uint64_t value)
+{
+    while (value >= VARINT_MORE) {
+        buffer.push_back(static_cast<uint8_t>(value & VARINT_MASK) | VARINT_MORE);
+        value >>= VARINT_SHIFT;
+    }
+    buffer.push_back(static_cast<uint8_t>(value));
+}
+
+void PutSigned(std::vector<uint8_t> &buffer, int64_t value)
+{
+    PutVarint(buffer, ZigZagEncode(value));
+}
+
+bool GetVarint(const uint8_t *base, size_t size, size_t &offset, uint64_t &value)
+{
+    value = 0;
+    for (uint32_t i = 0; (i < MAX_VARINT_BYTES) && (offset < size); ++i) {
+        uint8_t byte = base[offset++];
+        value |= static_cast<uint64_t>(byte & VARINT_MASK) << (i * VARINT_SHIFT);
+        if ((byte & VARINT_MORE) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool GetSigned(const uint8_t *base, size_t size, size_t &offset, int32_t &value)
+{
+    uint64_t encoded = 0;
+    if (!GetVarint(base, size, offset, encoded)) {
+        return false;
+    }
+    value = static_cast<int32_t>(ZigZagDecode(encoded));
+    return true;
+}
+
+bool IsSameDescription(const SensorData &left, const SensorData &right)
+{
+    return (left.sensorTypeId == right.sensorTypeId) && (left.sensorId == right.sensorId) &&
+        (left.deviceId == right.deviceId) && (left.location == right.location);
+}
+
+bool IsSameAttribute(const SensorData &left, const SensorData &right)
+{
+    return (left.version == right.version) && (left.option == right.option) && (left.mode == right.mode);
+}
+} // namespace
+
+SensorTraceWriter::~SensorTraceWriter()
+{
+    Close();
+}
+
+int32_t SensorTraceWriter::Open(const std::string &path)
+{
+    CALL_LOG_ENTER;
+    std::lock_guard<std::mutex> writerLock(writerMutex_);
+    if (fd_ >= 0) {
+        SEN_HILOGE("Trace writer is already open");
+        return ERROR;
+    }
+    int32_t fd = open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, TRACE_FILE_MODE);
+    if (fd < 0) {
+        SEN_HILOGE("Open trace file failed, errno:%{public}d", errno);
+        return ERROR;
+    }
+    fd_ = fd;
+    header_ = {};
+    header_.magic = SENSOR_TRACE_MAGIC;
+    header_.version = SENSOR_TRACE_VERSION;
+    lastData_ = {};
+    buffer_.clear();
+    buffer_.reserve(FLUSH_THRESHOLD + MAX_RECORD_SIZE);
+    chunks_.clear();
+    pendingSize_ = 0;
+    droppedCount_ = 0;
+    isStop_ = false;
+    isWriteFailed_ = false;
+    if (WriteHeader() != ERR_OK) {
+        close(fd_);
+        fd_ = -1;
+        return ERROR;
+    }
+    writeThread_ = std::thread(&SensorTraceWriter::WriteThread, this);
+    return ERR_OK;
+}
+
+int32_t SensorTraceWriter::Append(const SensorData &data)
+{
+    std::lock_guard<std::mutex> writerLock(writerMutex_);
+    if ((fd_ < 0) || isStop_) {
+        return ERROR;
+    }
+    if (data.dataLen > SENSOR_MAX_LENGTH) {
+        SEN_HILOGE("Invalid dataLen:%{public}u", data.dataLen);
+        return ERROR;
+    }
+    // Dropping before encoding keeps the deltas of the stream valid, the next record refers to the last one written
+    if (isWriteFailed_ || (pendingSize_ + buffer_.size() + MAX_RECORD_SIZE > MAX_PENDING_SIZE)) {
+        ++droppedCount_;
+        return ERROR;
+    }
+    uint8_t flags = 0;
+    if (header_.recordCount != 0) {
+        flags |= IsSameDescription(data, lastData_) ? SAME_DESCRIPTION : 0;
+        flags |= IsSameAttribute(data, lastData_) ? SAME_ATTRIBUTE : 0;
+    } else {
+        header_.firstTimestamp = data.timestamp;
+    }
+    buffer_.push_back(flags);
+    PutSigned(buffer_, data.timestamp - header_.lastTimestamp);
+    if ((flags & SAME_DESCRIPTION) == 0) {
+        PutSigned(buffer_, data.sensorTypeId);
+        PutSigned(buffer_, data.sensorId);
+        PutSigned(buffer_, data.deviceId);
+        PutSigned(buffer_, data.location);
+    }
+    if ((flags & SAME_ATTRIBUTE) == 0) {
+        PutSigned(buffer_, data.version);
+        PutSigned(buffer_, data.option);
+        PutSigned(buffer_, data.mode);
+    }
+    PutVarint(buffer_, data.dataLen);
+    buffer_.insert(buffer_.end(), data.data, data.data + data.dataLen);
+    header_.lastTimestamp = data.timestamp;
+    ++header_.recordCount;
+    lastData_ = data;
+    if (buffer_.size() >= FLUSH_THRESHOLD) {
+        QueueBufferLocked();
+    }
+    return ERR_OK;
+}
+
+int32_t SensorTraceWriter::Close()
+{
+    std::thread writeThread;
+    {
+        std::lock_guard<std::mutex> writerLock(writerMutex_);
+        if ((fd_ < 0) || isStop_) {
+            return ERR_OK;
+        }
+        if (!buffer_.empty()) {
+            QueueBufferLocked();
+        }
+        isStop_ = true;
+        writeThread = std::move(writeThread_);
+    }
+    writerCondition_.notify_one();
+    if (writeThread.joinable()) {
+        writeThread.join();
+    }
+    std::lock_guard<std::mutex> writerLock(writerMutex_);
+    int32_t ret = isWriteFailed_ ? ERROR : WriteHeader();
+    close(fd_);
+    fd_ = -1;
+    SEN_HILOGI("Trace closed, recordCount:%{public}" PRIu64 ", payloadSize:%{public}" PRIu64
+        ", droppedCount:%{public}" PRIu64, header_.recordCount, header_.payloadSize, droppedCount_);
+    return ret;
+}
+
+bool SensorTraceWriter::IsOpen()
+{
+    std::lock_guard<std::mutex> writerLock(writerMutex_);
+    return fd_ >= 0;
+}
+
+void SensorTraceWriter::QueueBufferLocked()
+{
+    pendingSize_ += buffer_.size();
+    chunks_.push_back(std::move(buffer_));
+    buffer_ = std::vector<uint8_t>();
+    buffer_.reserve(FLUSH_THRESHOLD + MAX_RECORD_SIZE);
+    writerCondition_.notify_one();
+}
+
+void SensorTraceWriter::WriteThread()
+{
+    prctl(PR_SET_NAME, SENSOR_TRACE_THREAD_NAME.c_str());
+    std::unique_lock<std::mutex> writerLock(writerMutex_);
+    while (true) {
+        writerCondition_.wait(writerLock, [this] { return isStop_ || !chunks_.empty(); });
+        if (chunks_.empty()) {
+            break;
+        }
+        std::vector<uint8_t> chunk = std::move(chunks_.front());
+        chunks_.pop_front();
+        writerLock.unlock();
+        int32_t ret = WriteChunk(chunk);
+        writerLock.lock();
+        pendingSize_ -= chunk.size();
+        if (ret == ERR_OK) {
+            header_.payloadSize += chunk.size();
+            continue;
+        }
+        isWriteFailed_ = true;
+        pendingSize_ = 0;
+        chunks_.clear();
+    }
+}
+
+int32_t SensorTraceWriter::WriteChunk(const std::vector<uint8_t> &chunk)
+{
+    size_t written = 0;
+    while (written < chunk.size()) {
+        ssize_t ret = write(fd_, chunk.data() + written, chunk.size() - written);
+        if (ret < 0 && errno == EINTR) {
+            continue;
+        }
+        if (ret <= 0) {
+            SEN_HILOGE("Write trace file failed, errno:%{public}d", errno);
+            return ERROR;
+        }
+        written += static_cast<size_t>(ret);
+    }
+    return ERR_OK;
+}
+
+int32_t SensorTraceWriter::WriteHeader()
+{
+    if (pwrite(fd_, &header_, sizeof(header_), 0) != static_cast<ssize_t>(sizeof(header_))) {
+        SEN_HILOGE("Write trace header failed, errno:%{public}d", errno);
+        return ERROR;
+    }
+    if (lseek(fd_, 0, SEEK_END) < 0) {
+        SEN_HILOGE("Seek trace file failed, errno:%{public}d", errno);
+        return ERROR;
+    }
+    return ERR_OK;
+}
+
+SensorTraceReader::~SensorTraceReader()
+{
+    Close();
+}
+
+int32_t SensorTraceReader::Open(const std::string &path)
+{
+    CALL_LOG_ENTER;
+    Close();
+    int32_t fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        SEN_HILOGE("Open trace file failed, errno:%{public}d", errno);
+        return ERROR;
+    }
+    struct stat fileStat = {};
+    if ((fstat(fd, &fileStat) != 0) || (fileStat.st_size < static_cast<off_t>(sizeof(SensorTraceHeader)))) {
+        SEN_HILOGE("Invalid trace file size");
+        close(fd);
+        return ERROR;
+    }
+    size_t size = static_cast<size_t>(fileStat.st_size);
+    void *addr = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (addr == MAP_FAILED) {
+        SEN_HILOGE("mmap failed, errno:%{public}d", errno);
+        return ERROR;
+    }
+    auto header = static_cast<const SensorTraceHeader *>(addr);
+    if ((header->magic != SENSOR_TRACE_MAGIC) || (header->version != SENSOR_TRACE_VERSION)) {
+        SEN_HILOGE("Trace file layout mismatch");
+        munmap(addr, size);
+        return ERROR;
+    }
+    base_ = static_cast<const uint8_t *>(addr);
+    size_ = size;
+    Rewind();
+    return ERR_OK;
+}
+
+void SensorTraceReader::Close()
+{
+    if (base_ != nullptr) {
+        munmap(const_cast<uint8_t *>(base_), size_);
+        base_ = nullptr;
+    }
+    size_ = 0;
+    offset_ = 0;
+}
+
+const SensorTraceHeader *SensorTraceReader::GetHeader() const
+{
+    return reinterpret_cast<const SensorTraceHeader *>(base_);
+}
+
+void SensorTraceReader::Rewind()
+{
+    offset_ = sizeof(SensorTraceHeader);
+    lastData_ = {};
+}
+
+bool SensorTraceReader::Next(SensorData &data)
+{
+    // The header may be stale if the writer was not closed, so records are read up to the end of the file
+    if ((base_ == nullptr) || (offset_ >= size_)) {
+        return false;
+    }
+    size_t offset = offset_;
+    uint8_t flags = base_[offset++];
+    data = lastData_;
+    uint64_t encoded = 0;
+    uint64_t dataLen = 0;
+    bool isValid = GetVarint(base_, size_, offset, encoded);
+    data.timestamp = lastData_.timestamp + ZigZagDecode(encoded);
+    if ((flags & SAME_DESCRIPTION) == 0) {
+        isValid = isValid && GetSigned(base_, size_, offset, data.sensorTypeId) &&
+            GetSigned(base_, size_, offset, data.sensorId) && GetSigned(base_, size_, offset, data.deviceId) &&
+            GetSigned(base_, size_, offset, data.location);
+    }
+    if ((flags & SAME_ATTRIBUTE) == 0) {
+        isValid = isValid && GetSigned(base_, size_, offset, data.version) &&
+            GetSigned(base_, size_, offset, data.option) && GetSigned(base_, size_, offset, data.mode);
+    }
+    isValid = isValid && GetVarint(base_, size_, offset, dataLen) && (dataLen <= SENSOR_MAX_LENGTH) &&
+        (dataLen <= size_ - offset);
+    if (!isValid) {
+        SEN_HILOGW("Trace record is truncated, offset:%{public}zu", offset_);
+        offset_ = size_;
+        return false;
+    }
+    data.dataLen = static_cast<uint32_t>(dataLen);
+    if ((dataLen != 0) && (memcpy_s(data.data, sizeof(data.data), base_ + offset, dataLen) != EOK)) {
+        SEN_HILOGE("memcpy_s failed");
+        offset_ = size_;
+        return false;
+    }
+    offset_ = offset + dataLen;
+    lastData_ = data;
+    return true;
+}
+} // namespace Sensors
+} // namespace OHOS
@@ -76,6 +76,12 @@ public:
      */
     int32_t Process(const std::vector<double> &values, int32_t &frameCount, std::vector<float> &frameMagsArr);
 
+    /**
+     * @brief The single-precision samples are processed frame by frame, see the double overload.
+     * @since 26.0.0
+     */
+    int32_t Process(const std::vector<float> &values, int32_t &frameCount, std::vector<float> &frameMagsArr);
+
     /**
      * @brief Process the sampled data one by one
      * @param value A sampling value.
@@ -190,11 +196,22 @@ public:
 
 private:
     std::vector<float> &ConvertDB();
+    bool IsFramingValid() const;
+    void RunFrame(const float *first, int32_t firstCount, const float *second, FFTModes mode);
+    template<typename T>
+    int32_t ProcessSamples(const std::vector<T> &values, int32_t &frameCount, std::vector<float> &frameMagsArr);
+    template<typename T>
+    void WriteHistory(const std::vector<T> &values);
 
 private:
     FFTInputPara para_;
     FFTOutputResult fftResult_;
+    /** fftResult_.buffer is a ring of the last windowSize samples, pos_ is where the next sample is written. */
     int32_t pos_ { 0 };
+    /** The number of samples written since the last frame. */
+    int32_t hopCount_ { 0 };
+    /** The history of the ring followed by the input of Process, so every frame is a contiguous view. */
+    std::vector<float> signal_;
     Fft fft_;
     bool isFrameFull_ { false };
     int32_t bins_ { 0 };
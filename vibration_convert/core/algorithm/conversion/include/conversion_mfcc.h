@@ -16,6 +16,7 @@
 #ifndef CONVERSION_MFCC_H
 #define CONVERSION_MFCC_H
 
+#include <cstdint>
 #include <vector>
 
 namespace OHOS {
@@ -64,6 +65,18 @@ public:
      */
     std::vector<double> Mfcc(const std::vector<float> &powerSpectrum);
 
+    /**
+     * @brief Calculate MFCC of all frames of a clip in one call.
+     *
+     * @param frameSpectra The power spectra of frameCount frames stored one after another, as returned by
+     *  ConversionFFT::Process. Each frame holds frameSpectra.size() / frameCount bins, at least numBins.
+     * @param frameCount The number of frames.
+     * @param frameMfccs Return numCoeffs coefficients per frame, stored one frame after another.
+     *
+     * @return Returns <b>0</b> if the operation is successful; returns a negative value otherwise.
+     */
+    int32_t MfccFrames(const std::vector<float> &frameSpectra, int32_t frameCount, std::vector<double> &frameMfccs);
+
     /**
      * @brief Get the Mel Filter Bank
      *  1. Call the setup function at first.
@@ -88,11 +101,23 @@ public:
     int32_t FiltersMel(int32_t nFft, MfccInputPara para, size_t &frmCount, std::vector<double> &melBasis);
 
 private:
-    int32_t HandleDiscreteCosineTransform();
-    int32_t HandleMelFilterAndLogSquare(const std::vector<float> &powerSpectrum);
+    /**
+     * @brief The non-zero part of a triangular Mel filter, its weights are stored contiguously in melWeights_.
+     */
+    struct MelFilter {
+        /** The first bin with a non-zero weight. */
+        uint32_t start { 0 };
+        /** One past the last bin with a non-zero weight. */
+        uint32_t end { 0 };
+        /** The index of the weight of bin start in melWeights_. */
+        size_t offset { 0 };
+    };
+
+    void HandleDiscreteCosineTransform(double *coeffs);
+    void HandleMelFilterAndLogSquare(const float *powerSpectrum);
     int32_t CalcMelFilterBank(double sampleRate);
     int32_t CreateDCTCoeffs();
-    int32_t SetMelFilters(uint32_t idx, double binFreq, double prevFreq, double thisFreq, double nextFreq);
+    int32_t CalcMelWeight(double binFreq, double prevFreq, double thisFreq, double nextFreq, double &weight);
 
 private:
     std::vector<double> melBands_;
@@ -101,8 +126,10 @@ private:
     double minFreq_ { 0.0 };
     double maxFreq_ { 0.0 };
     uint32_t sampleRate_ { 0 };
-    std::vector<double> melFilters_;
+    std::vector<MelFilter> melFilters_;
+    std::vector<double> melWeights_;
     uint32_t numBins_ { 0 };
+    /** The DCT-II basis scaled by 1 / numCoeffs_, row i holds the numFilters_ weights of coefficient i. */
     std::vector<double> dctMatrix_;
     std::vector<double> coeffs_;
 };
@@ -16,52 +16,37 @@
 #ifndef FFT_H
 #define FFT_H
 
+#include <memory>
+
 #include "utils.h"
 
 namespace OHOS {
 namespace Sensors {
 /**
- * @brief The parameters and calculation results used in FFT.
- *   Used to encapsulate 6 parameters in the AlgFFT function.
+ * @brief Precomputed tables of a real FFT of one size. Plans are built once per size and shared by all Fft
+ *   instances, see GetFftPlan.
  */
-struct FftParaAndResult {
-    /** Number of samples */
-    int32_t numSamples { 0 };
-    /** The real part of the input */
-    std::vector<float> realIn;
-    /** The imaginary part of the input */
-    std::vector<float> imagIn;
-    /** The real part of the output */
-    std::vector<float> realOut;
-    /** The imaginary part of the output */
-    std::vector<float> imagOut;
-
-    FftParaAndResult() = default;
-    explicit FftParaAndResult(int32_t size)
-    {
-        numSamples = size;
-        realIn.resize(size, 0.0F);
-        imagIn.resize(size, 0.0F);
-        realOut.resize(size, 0.0F);
-        imagOut.resize(size, 0.0F);
-    }
-};
+struct FftPlan;
 
 class Fft {
 public:
     Fft() = default;
-    ~Fft();
+    ~Fft() = default;
 
     void Init(int32_t fftSize);
 
-    std::vector<float> GetReal() const;
-    std::vector<float> GetImg() const;
+    const std::vector<float> &GetReal() const;
+    const std::vector<float> &GetImg() const;
 
     /* Calculate the power spectrum */
     void CalcFFT(const std::vector<float> &data, const std::vector<float> &window);
     void ConvertPolar(std::vector<float> &magnitude, std::vector<float> &phase);
     void CalculatePowerSpectrum(const std::vector<float> &data, const std::vector<float> &window,
         std::vector<float> &magnitude, std::vector<float> &phase);
+    /* The frame is read from first[0, firstCount) followed by second, as it is stored in a circular buffer */
+    void CalcFFT(const float *first, int32_t firstCount, const float *second, const std::vector<float> &window);
+    void CalculatePowerSpectrum(const float *first, int32_t firstCount, const float *second,
+        const std::vector<float> &window, std::vector<float> &magnitude, std::vector<float> &phase);
     /** the inverse */
     void ConvertCart(const std::vector<float> &magnitude, const std::vector<float> &phase);
     void CalcIFFT(const std::vector<float> &window, std::vector<float> &finalOut);
@@ -74,52 +59,48 @@ public:
 
 private:
     int32_t WindowFunc(int32_t whichFunction, int32_t numSamples, float *out);
-    uint32_t FastReverseBits(uint32_t pos, uint32_t numBits);
 
     /**
-     * @brief Power Spectrum
+     * @brief Real Fast Fourier Transform
      *
-     * 1. This function computes the same as AlgRealFFT, above, but adds the squares of the real and imaginary part
-     *  of each coefficient, extracting the power and throwing away the phase.
-     * 2. For speed, it does not call AlgRealFFT, but duplicates some of its code.
+     * 1. The windowed input is packed into a complex sequence of half the size, transformed in place and split
+     *   into the spectrum of the real input, which is stored in realOut_ and imagOut_.
+     * 2. Only the first half + 1 bins are computed, the others are filled from the conjugate symmetry.
      *
-     * @param numSamples Number of samples.
-     * @param in The part of the input.
-     * @param out The part of the output
+     * @param first The first part of the real input.
+     * @param firstCount The number of samples in first, at most fftSize_.
+     * @param second The rest of the real input, fftSize_ - firstCount samples, unused when first holds the frame.
+     * @param window The window applied to the input, at least fftSize_ samples.
      *
      * @return Returns <b>0</b> if the operation is successful; returns a negative value otherwise.
      */
-    int32_t AlgPowerSpectrum(int32_t numSamples, const std::vector<float> &in, std::vector<float> &out);
+    int32_t AlgRealFFT(const float *first, int32_t firstCount, const float *second, const std::vector<float> &window);
 
     /**
-     * @brief Real Fast Fourier Transform
+     * @brief Inverse of a one-sided spectrum
      *
-     * 1. This function was based on the code in Numerical Recipes in C.
-     * 2.In Num. Rec., the inner loop is based on a single 1-based array of interleaved real and imaginary numbers.
-     *   Because we have two separate zero-based arrays, our indices are quite different.
-     * 3. Here is the correspondence between Num. Rec.
+     * Computes the real part of the normalized inverse transform of a spectrum whose bins from half_ upwards are
+     * zero, which is half of the inverse of its conjugate symmetric extension.
+     *
+     * @param window The window applied to the output, at least fftSize_ samples.
+     * @param finalOut The windowed output, resized to fftSize_ samples.
      *
      * @return Returns <b>0</b> if the operation is successful; returns a negative value otherwise.
      */
-    int32_t AlgRealFFT(FftParaAndResult &paraRes);
-    int32_t AlgFFT(bool inverseTransform, FftParaAndResult &paraRes);
-    void Normalize(FftParaAndResult &paraRes);
-    int32_t PreprocessData(uint32_t numSamples, FftParaAndResult &paraRes);
-    int32_t AlgInitFFT();
+    int32_t AlgInverseFFT(const std::vector<float> &window, std::vector<float> &finalOut);
 
 private:
     /** fftSize */
     int32_t fftSize_ { 0 };
     /** halfFFTSize */
     int32_t half_ { 0 };
-
-    FftParaAndResult fftParaRes_;
-    /**
-     * 'para_' needs to be created every time the sfft occurs, so it is created once during initialization.
-     * It's half the size of fftParaRes_, only used in one function.
-     */
-    FftParaAndResult para_;
-    uint32_t** fftBitTable_ { nullptr };
+    std::shared_ptr<const FftPlan> plan_ { nullptr };
+    /** The spectrum of the last transform, or the input of the inverse transform. */
+    std::vector<float> realOut_;
+    std::vector<float> imagOut_;
+    /** Work buffers of the half size complex transform, allocated once in Init. */
+    std::vector<float> workReal_;
+    std::vector<float> workImag_;
 };
 } // namespace Sensors
 } // namespace OHOS
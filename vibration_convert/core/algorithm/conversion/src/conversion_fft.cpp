@@ -15,6 +15,8 @@
 
 #include "conversion_fft.h"
 
+#include <algorithm>
+
 #include "sensor_log.h"
 #include "sensors_errors.h"
 #include "utils.h"
@@ -41,14 +43,16 @@ int32_t ConversionFFT::Init(const FFTInputPara &fftPara)
     para_ = fftPara;
     fft_.Init(para_.fftSize);
     para_.windowSize = (fftPara.windowSize > para_.fftSize) ? fftPara.windowSize : para_.fftSize;
-    pos_ = para_.windowSize - para_.hopSize;
+    // the ring starts with windowSize - hopSize zeros of history, so the first frame is due after one hop
+    pos_ = (para_.windowSize - para_.hopSize) % para_.windowSize;
     if (pos_ < 0) {
         pos_ = 0;
     }
+    hopCount_ = 0;
     isFrameFull_ = false;
     isFftCalcFinish_ = false;
     bins_ = para_.fftSize / 2;
-    fftResult_.buffer.resize(para_.fftSize, 0.0F);
+    fftResult_.buffer.assign(para_.fftSize, 0.0F);
     fftResult_.window.resize(para_.fftSize, 0.0F);
     fftResult_.magnitudes.resize(bins_, 0.0F);
     fftResult_.magnitudesDB.resize(bins_, 0.0F);
@@ -57,71 +61,110 @@ int32_t ConversionFFT::Init(const FFTInputPara &fftPara)
     return Sensors::SUCCESS;
 }
 
-bool ConversionFFT::ProcessSingle(float value, FFTModes mode)
+bool ConversionFFT::IsFramingValid() const
+{
+    // A frame holds windowSize samples of the ring, which only has room for fftSize of them
+    return (para_.windowSize == static_cast<int32_t>(fftResult_.buffer.size())) && (para_.hopSize > 0) &&
+        (para_.hopSize <= para_.windowSize);
+}
+
+void ConversionFFT::RunFrame(const float *first, int32_t firstCount, const float *second, FFTModes mode)
 {
-    int32_t bufferSize = static_cast<int32_t>(fftResult_.buffer.size());
-    // add value to buffer at current pos
-    if (pos_ < bufferSize) {
-        fftResult_.buffer[pos_++] = value;
+    if (mode == ConversionFFT::WITH_POLAR_CONVERSION) {
+        fft_.CalculatePowerSpectrum(first, firstCount, second, fftResult_.window, fftResult_.magnitudes,
+            fftResult_.phases);
+    } else {
+        fft_.CalcFFT(first, firstCount, second, fftResult_.window);
     }
-    // if buffer full, run fft
-    isFrameFull_ = (pos_ == para_.windowSize);
-    if (!isFrameFull_) {
+    isFftCalcFinish_ = true;
+}
+
+bool ConversionFFT::ProcessSingle(float value, FFTModes mode)
+{
+    isFrameFull_ = false;
+    if (!IsFramingValid()) {
         return isFrameFull_;
     }
-    if (mode == ConversionFFT::WITH_POLAR_CONVERSION) {
-        fft_.CalculatePowerSpectrum(fftResult_.buffer, fftResult_.window, fftResult_.magnitudes, fftResult_.phases);
-    } else {
-        fft_.CalcFFT(fftResult_.buffer, fftResult_.window);
+    fftResult_.buffer[pos_] = value;
+    if (++pos_ == para_.windowSize) {
+        pos_ = 0;
     }
-    // reset pos to start of hop
-    pos_ = para_.windowSize - para_.hopSize;
-    if ((pos_ + para_.hopSize) >= bufferSize) {
-            pos_ = bufferSize - para_.hopSize;
-            SEN_HILOGW("modify pos data, pos:%{public}d", pos_);
-        }
-    /** shift buffer back by one hop size. */
-    for (int32_t i = 0; i < pos_; i++) {
-        fftResult_.buffer[i] = fftResult_.buffer[i + para_.hopSize];
+    // if a hop has been collected, run fft on the last windowSize samples, oldest first from pos_
+    if (++hopCount_ < para_.hopSize) {
+        return isFrameFull_;
     }
-    isFftCalcFinish_ = true;
+    hopCount_ = 0;
+    isFrameFull_ = true;
+    const float *ring = fftResult_.buffer.data();
+    RunFrame(ring + pos_, para_.windowSize - pos_, ring, mode);
     return isFrameFull_;
 }
 
+template<typename T>
+void ConversionFFT::WriteHistory(const std::vector<T> &values)
+{
+    // Only the last windowSize values can survive in the ring
+    size_t valuesSize = values.size();
+    size_t count = std::min(valuesSize, static_cast<size_t>(para_.windowSize));
+    size_t windowSize = static_cast<size_t>(para_.windowSize);
+    size_t ringPos = (static_cast<size_t>(pos_) + valuesSize - count) % windowSize;
+    for (size_t i = valuesSize - count; i < valuesSize; ++i) {
+        fftResult_.buffer[ringPos] = static_cast<float>(values[i]);
+        ringPos = (ringPos + 1 == windowSize) ? 0 : (ringPos + 1);
+    }
+    pos_ = static_cast<int32_t>(ringPos);
+}
+
 int32_t ConversionFFT::Process(const std::vector<double> &values, int32_t &frameCount,
     std::vector<float> &frameMagsArr)
 {
-    FFTModes mode = ConversionFFT::WITH_POLAR_CONVERSION;
-    pos_ = para_.windowSize - para_.hopSize;
+    return ProcessSamples(values, frameCount, frameMagsArr);
+}
+
+int32_t ConversionFFT::Process(const std::vector<float> &values, int32_t &frameCount,
+    std::vector<float> &frameMagsArr)
+{
+    return ProcessSamples(values, frameCount, frameMagsArr);
+}
+
+template<typename T>
+int32_t ConversionFFT::ProcessSamples(const std::vector<T> &values, int32_t &frameCount,
+    std::vector<float> &frameMagsArr)
+{
     frameCount = 0;
-    bool isFrameFull = false;
+    if (!IsFramingValid()) {
+        SEN_HILOGE("Invalid framing, windowSize:%{public}d, hopSize:%{public}d", para_.windowSize, para_.hopSize);
+        return Sensors::PARAMETER_ERROR;
+    }
+    // Framing restarts at the last frame boundary, samples of an unfinished hop are dropped
+    int32_t windowSize = para_.windowSize;
+    int32_t hopSize = para_.hopSize;
+    pos_ = (pos_ - hopCount_ + windowSize) % windowSize;
+    hopCount_ = 0;
+    int32_t overlap = windowSize - hopSize;
     size_t valuesSize = values.size();
-    for (size_t j = 0; j < valuesSize; ++j) {
-        // add value to buffer at current pos
-        if (pos_ < static_cast<int32_t>(fftResult_.buffer.size())) {
-            fftResult_.buffer[pos_++] = static_cast<float>(values[j]);
-        }
-        // if buffer full, run fft
-        isFrameFull = (pos_ == para_.windowSize);
-        if (!isFrameFull) {
-            continue;
-        }
-        if (mode == ConversionFFT::WITH_POLAR_CONVERSION) {
-            fft_.CalculatePowerSpectrum(fftResult_.buffer, fftResult_.window,
-                fftResult_.magnitudes, fftResult_.phases);
-        } else {
-            fft_.CalcFFT(fftResult_.buffer, fftResult_.window);
-        }
-        // reset pos to start of hop
-        pos_ = para_.windowSize - para_.hopSize;
-        /** shift buffer back by one hop size. */
-        for (int32_t i = 0; i < pos_; ++i) {
-            fftResult_.buffer[i] = fftResult_.buffer[i + para_.hopSize];
-        }
-        isFftCalcFinish_ = true;
+    size_t frames = valuesSize / static_cast<size_t>(hopSize);
+    if (frames == 0) {
+        WriteHistory(values);
+        hopCount_ = static_cast<int32_t>(valuesSize);
+        return Sensors::SUCCESS;
+    }
+    // Frame n is signal_[n * hopSize, n * hopSize + windowSize), read in place without shifting any samples
+    signal_.resize(static_cast<size_t>(overlap) + valuesSize);
+    for (int32_t i = 0; i < overlap; ++i) {
+        signal_[i] = fftResult_.buffer[(pos_ + hopSize + i) % windowSize];
+    }
+    std::transform(values.begin(), values.end(), signal_.begin() + overlap,
+        [](T value) { return static_cast<float>(value); });
+    frameMagsArr.reserve(frameMagsArr.size() + frames * static_cast<size_t>(bins_));
+    for (size_t n = 0; n < frames; ++n) {
+        RunFrame(signal_.data() + n * static_cast<size_t>(hopSize), windowSize, nullptr,
+            ConversionFFT::WITH_POLAR_CONVERSION);
         frameMagsArr.insert(frameMagsArr.end(), fftResult_.magnitudes.begin(), fftResult_.magnitudes.end());
-        ++frameCount;
     }
+    WriteHistory(values);
+    hopCount_ = static_cast<int32_t>(valuesSize - frames * static_cast<size_t>(hopSize));
+    frameCount = static_cast<int32_t>(frames);
     return Sensors::SUCCESS;
 }
 
@@ -30,25 +30,19 @@ constexpr double BANDS_MIN_THRESHOLD { 0.000001 };
 constexpr uint32_t MEL_FILTERS_OR_COEFFS_MAX { 4096 * 4096 };
 } // namespace
 
-int32_t ConversionMfcc::HandleMelFilterAndLogSquare(const std::vector<float> &powerSpectrum)
+void ConversionMfcc::HandleMelFilterAndLogSquare(const float *powerSpectrum)
 {
-    size_t powerSpectrumSize = powerSpectrum.size();
-    if ((powerSpectrumSize == 0) || (powerSpectrumSize >= numBins_)) {
-        SEN_HILOGE("Invalid parameter");
-        return Sensors::PARAMETER_ERROR;
-    }
+    // only the bins under each triangle are visited, the cost is the number of non-zero weights
     for (uint32_t i = 0; i < numFilters_; ++i) {
-        melBands_[i] = 0;
-        for (uint32_t bin = 0; bin < numBins_; ++bin) {
-            uint32_t idx = i + (bin * numFilters_);
-            melBands_[i] += (melFilters_[idx] * powerSpectrum[bin]);
+        const MelFilter &filter = melFilters_[i];
+        const double *weights = melWeights_.data() + filter.offset;
+        double band = 0.0;
+        for (uint32_t bin = filter.start; bin < filter.end; ++bin) {
+            band += (weights[bin - filter.start] * powerSpectrum[bin]);
         }
-    }
-    for (uint32_t i = 0; i < numFilters_; ++i) {
         // log the square
-        melBands_[i] = (melBands_[i] > BANDS_MIN_THRESHOLD) ? log(melBands_[i] * melBands_[i]) : 0;
+        melBands_[i] = (band > BANDS_MIN_THRESHOLD) ? log(band * band) : 0;
     }
-    return Sensors::SUCCESS;
 }
 
 int32_t ConversionMfcc::Init(uint32_t numBins, uint32_t numCoeffs, const MfccInputPara &para)
@@ -67,9 +61,7 @@ int32_t ConversionMfcc::Init(uint32_t numBins, uint32_t numCoeffs, const MfccInp
     melBands_.resize(numFilters_, 0.0);
     coeffs_.resize(numCoeffs, 0.0);
     // create new matrix
-    dctMatrix_.resize(numCoeffs * numFilters_, 0.0);
-    // now generate the coefficients for the mag spectrum
-    melFilters_.resize(numFilters_ * numBins_, 0.0);
+    dctMatrix_.assign(numCoeffs * numFilters_, 0.0);
     if (CalcMelFilterBank(sampleRate_) != Sensors::SUCCESS) {
         SEN_HILOGE("CalcMelFilterBank failed");
         return Sensors::ERROR;
@@ -83,36 +75,49 @@ int32_t ConversionMfcc::Init(uint32_t numBins, uint32_t numCoeffs, const MfccInp
 
 std::vector<double> ConversionMfcc::Mfcc(const std::vector<float> &powerSpectrum)
 {
-    int32_t ret = HandleMelFilterAndLogSquare(powerSpectrum);
-    if (ret != Sensors::SUCCESS) {
-        SEN_HILOGE("HandleMelFilterAndLogSquare failed");
-        return {};
-    }
-    if (HandleDiscreteCosineTransform() != Sensors::SUCCESS) {
-        SEN_HILOGE("HandleDiscreteCosineTransform failed");
+    if ((numFilters_ == 0) || (numCoeffs_ == 0) || (powerSpectrum.size() < numBins_)) {
+        SEN_HILOGE("Invalid parameter, powerSpectrumSize:%{public}zu, numBins_:%{public}u",
+            powerSpectrum.size(), numBins_);
         return {};
     }
+    HandleMelFilterAndLogSquare(powerSpectrum.data());
+    HandleDiscreteCosineTransform(coeffs_.data());
     return coeffs_;
 }
 
-int32_t ConversionMfcc::HandleDiscreteCosineTransform()
+int32_t ConversionMfcc::MfccFrames(const std::vector<float> &frameSpectra, int32_t frameCount,
+    std::vector<double> &frameMfccs)
 {
-    if (numCoeffs_ == 0) {
-        SEN_HILOGE("numCoeffs_ should not be 0");
-        return Sensors::ERROR;
+    if ((numFilters_ == 0) || (numCoeffs_ == 0) || (frameCount <= 0) ||
+        (frameSpectra.size() < static_cast<size_t>(frameCount) * numBins_)) {
+        SEN_HILOGE("Invalid parameter, frameSpectraSize:%{public}zu, frameCount:%{public}d",
+            frameSpectra.size(), frameCount);
+        return Sensors::PARAMETER_ERROR;
     }
+    size_t frames = static_cast<size_t>(frameCount);
+    size_t frameSize = frameSpectra.size() / frames;
+    frameMfccs.resize(frames * numCoeffs_);
+    for (size_t n = 0; n < frames; ++n) {
+        HandleMelFilterAndLogSquare(frameSpectra.data() + n * frameSize);
+        HandleDiscreteCosineTransform(frameMfccs.data() + n * numCoeffs_);
+    }
+    return Sensors::SUCCESS;
+}
+
+void ConversionMfcc::HandleDiscreteCosineTransform(double *coeffs)
+{
     for (uint32_t i = 0; i < numCoeffs_; i++) {
-        coeffs_[i] = 0;
+        const double *basis = dctMatrix_.data() + static_cast<size_t>(i) * numFilters_;
+        double coeff = 0.0;
         for (uint32_t j = 0; j < numFilters_; j++) {
-            uint32_t idx = i + (j * numCoeffs_);
-            coeffs_[i] += (dctMatrix_[idx] * melBands_[j]);
+            coeff += (basis[j] * melBands_[j]);
         }
-        coeffs_[i] /= numCoeffs_;
+        coeffs[i] = coeff;
     }
-    return Sensors::SUCCESS;
 }
 
-int32_t ConversionMfcc::SetMelFilters(uint32_t idx, double binFreq, double prevFreq, double thisFreq, double nextFreq)
+int32_t ConversionMfcc::CalcMelWeight(double binFreq, double prevFreq, double thisFreq, double nextFreq,
+    double &weight)
 {
     if (nextFreq == 0) {
         SEN_HILOGE("Invalid parameter");
@@ -122,21 +127,23 @@ int32_t ConversionMfcc::SetMelFilters(uint32_t idx, double binFreq, double prevF
         SEN_HILOGE("The divisor cannot be 0");
         return Sensors::ERROR;
     }
-    melFilters_[idx] = 0;
+    weight = 0;
     double height = 2.0 / (nextFreq - prevFreq);
     if (IsLessOrEqual(binFreq, thisFreq)) {
         if (IsEqual(thisFreq, prevFreq)) {
             SEN_HILOGE("The divisor cannot be 0");
             return Sensors::ERROR;
         }
-        melFilters_[idx] = (binFreq - prevFreq) * (height / (thisFreq - prevFreq));
+        weight = (binFreq - prevFreq) * (height / (thisFreq - prevFreq));
     } else {
         if (IsEqual(nextFreq, thisFreq)) {
             SEN_HILOGE("The divisor cannot be 0");
             return Sensors::ERROR;
         }
-        melFilters_[idx] = height + ((binFreq - thisFreq) * (-height / (nextFreq - thisFreq)));
+        weight = height + ((binFreq - thisFreq) * (-height / (nextFreq - thisFreq)));
     }
+    // the filter is a triangle, bins outside of [prevFreq, nextFreq] have no weight
+    weight = IsGreatNotEqual(weight, 0.0) ? weight : 0.0;
     return Sensors::SUCCESS;
 }
 
@@ -164,25 +171,40 @@ int32_t ConversionMfcc::CalcMelFilterBank(double sampleRate)
     for (uint32_t bin = 0; bin < numBins_; ++bin) {
         binFs[bin] = stepHz * bin;
     }
+    melFilters_.assign(numFilters_, MelFilter());
+    melWeights_.clear();
+    std::vector<double> weights(numBins_);
     for (uint32_t i = 0; i < numFilters_; ++i) {
         for (uint32_t j = 0; j < numBins_; ++j) {
-            uint32_t idx = i + (j * numFilters_);
-            if (SetMelFilters(idx, binFs[j], filterHzPos[i], filterHzPos[i + 1],
-                filterHzPos[i + 2]) != Sensors::SUCCESS) {
-                SEN_HILOGE("SetMelFilters failed");
+            if (CalcMelWeight(binFs[j], filterHzPos[i], filterHzPos[i + 1], filterHzPos[i + 2],
+                weights[j]) != Sensors::SUCCESS) {
+                SEN_HILOGE("CalcMelWeight failed");
                 return Sensors::ERROR;
             }
         }
+        // keep only the non-zero range of the triangle
+        uint32_t start = 0;
+        while ((start < numBins_) && IsEqual(weights[start], 0.0)) {
+            ++start;
+        }
+        uint32_t end = numBins_;
+        while ((end > start) && IsEqual(weights[end - 1], 0.0)) {
+            --end;
+        }
+        melFilters_[i] = { start, end, melWeights_.size() };
+        melWeights_.insert(melWeights_.end(), weights.begin() + start, weights.begin() + end);
     }
     return Sensors::SUCCESS;
 }
 
 std::vector<double> ConversionMfcc::GetMelFilterBank() const
 {
-    std::vector<double> melFilters;
-    uint32_t num = numFilters_ * numBins_;
-    for (uint32_t i = 0; i < num; i++) {
-        melFilters.emplace_back(melFilters_[i]);
+    std::vector<double> melFilters(static_cast<size_t>(numFilters_) * numBins_, 0.0);
+    for (uint32_t i = 0; i < numFilters_; ++i) {
+        const MelFilter &filter = melFilters_[i];
+        for (uint32_t bin = filter.start; bin < filter.end; ++bin) {
+            melFilters[i + (bin * numFilters_)] = melWeights_[filter.offset + (bin - filter.start)];
+        }
     }
     return melFilters;
 }
@@ -194,12 +216,13 @@ int32_t ConversionMfcc::CreateDCTCoeffs()
         return Sensors::ERROR;
     }
     double k = M_PI / numFilters_;
-    double w1 = 1.0 / (sqrt(numFilters_));
-    double w2 = sqrt(2.0 / numFilters_);
-    // generate dct matrix
+    // the output scale 1 / numCoeffs_ is folded into the basis
+    double w1 = 1.0 / (sqrt(numFilters_)) / numCoeffs_;
+    double w2 = sqrt(2.0 / numFilters_) / numCoeffs_;
+    // generate dct matrix, one contiguous row per coefficient
     for (uint32_t i = 0; i < numCoeffs_; i++) {
         for (uint32_t j = 0; j < numFilters_; j++) {
-            uint32_t idx = i + (j * numCoeffs_);
+            size_t idx = (static_cast<size_t>(i) * numFilters_) + j;
             if (i == 0) {
                 dctMatrix_[idx] = w1 * cos(k * (i + 1) * (j + F_HALF));
             } else {
@@ -0,0 +1,442 @@
+/*
+ * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "fft.h"
+
+#include <algorithm>
+#include <map>
+#include <mutex>
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define FFT_USE_NEON
+#elif defined(__SSE__) || defined(__x86_64__)
+#include <xmmintrin.h>
+#define FFT_USE_SSE
+#endif
+
+#include "sensor_log.h"
+#include "sensors_errors.h"
+
+#undef LOG_TAG
+#define LOG_TAG "Fft"
+
+namespace OHOS {
+namespace Sensors {
+namespace {
+constexpr int32_t MIN_FFT_SIZE { 2 };
+constexpr int32_t MAX_FFT_SIZE { 65536 };
+constexpr double TWO_PI { 2.0 * M_PI };
+constexpr float HALF { 0.5F };
+constexpr float DB_COEF { 20.0F };
+constexpr float HAMMING_ALPHA { 0.54F };
+constexpr float HAMMING_BETA { 0.46F };
+constexpr float HANNING_COEF { 0.5F };
+} // namespace
+
+/**
+ * For an fftSize of 2M, the real input is transformed as M complex values x[2j] + i * x[2j + 1].
+ * The M - 1 twiddles of the radix-2 stages are stored stage after stage, the stage of half length h starting at
+ * index h - 1, so that the butterflies of a stage read them contiguously.
+ */
+struct FftPlan {
+    uint32_t complexSize { 0 };
+    std::vector<uint32_t> bitReverse;
+    std::vector<float> twiddleReal;
+    std::vector<float> twiddleImag;
+    /** exp(-2 * pi * i * k / fftSize) for k in [0, M], used to split the packed result. */
+    std::vector<float> splitReal;
+    std::vector<float> splitImag;
+};
+
+namespace {
+std::shared_ptr<const FftPlan> CreateFftPlan(uint32_t fftSize)
+{
+    auto plan = std::make_shared<FftPlan>();
+    uint32_t complexSize = fftSize / 2;
+    plan->complexSize = complexSize;
+    plan->bitReverse.resize(complexSize, 0);
+    if (complexSize > 1) {
+        uint32_t numBits = ObtainNumberOfBits(complexSize);
+        for (uint32_t i = 0; i < complexSize; ++i) {
+            plan->bitReverse[i] = ReverseBits(i, numBits);
+        }
+    }
+    plan->twiddleReal.resize(complexSize, 0.0F);
+    plan->twiddleImag.resize(complexSize, 0.0F);
+    for (uint32_t half = 1; half < complexSize; half <<= 1) {
+        for (uint32_t j = 0; j < half; ++j) {
+            double angle = M_PI * j / half;
+            plan->twiddleReal[half - 1 + j] = static_cast<float>(cos(angle));
+            plan->twiddleImag[half - 1 + j] = static_cast<float>(-sin(angle));
+        }
+    }
+    plan->splitReal.resize(complexSize + 1, 0.0F);
+    plan->splitImag.resize(complexSize + 1, 0.0F);
+    for (uint32_t k = 0; k <= complexSize; ++k) {
+        double angle = TWO_PI * k / fftSize;
+        plan->splitReal[k] = static_cast<float>(cos(angle));
+        plan->splitImag[k] = static_cast<float>(-sin(angle));
+    }
+    return plan;
+}
+
+std::shared_ptr<const FftPlan> GetFftPlan(uint32_t fftSize)
+{
+    static std::mutex planMutex;
+    static std::map<uint32_t, std::shared_ptr<const FftPlan>> plans;
+    std::lock_guard<std::mutex> planLock(planMutex);
+    auto it = plans.find(fftSize);
+    if (it != plans.end()) {
+        return it->second;
+    }
+    auto plan = CreateFftPlan(fftSize);
+    plans.emplace(fftSize, plan);
+    return plan;
+}
+
+/**
+ * One radix-2 stage: for every block of 2 * half values, b is multiplied by the twiddle, then a, b = a + b, a - b.
+ */
+void ButterflyStage(float *re, float *im, const float *wr, const float *wi, uint32_t half, uint32_t size)
+{
+    for (uint32_t k = 0; k < size; k += (half << 1)) {
+        float *ar = re + k;
+        float *ai = im + k;
+        float *br = ar + half;
+        float *bi = ai + half;
+        uint32_t j = 0;
+#if defined(FFT_USE_NEON)
+        for (; j + 4 <= half; j += 4) {
+            float32x4_t xr = vld1q_f32(br + j);
+            float32x4_t xi = vld1q_f32(bi + j);
+            float32x4_t cr = vld1q_f32(wr + j);
+            float32x4_t ci = vld1q_f32(wi + j);
+            float32x4_t tr = vmlsq_f32(vmulq_f32(xr, cr), xi, ci);
+            float32x4_t ti = vmlaq_f32(vmulq_f32(xr, ci), xi, cr);
+            float32x4_t ur = vld1q_f32(ar + j);
+            float32x4_t ui = vld1q_f32(ai + j);
+            vst1q_f32(ar + j, vaddq_f32(ur, tr));
+            vst1q_f32(ai + j, vaddq_f32(ui, ti));
+            vst1q_f32(br + j, vsubq_f32(ur, tr));
+            vst1q_f32(bi + j, vsubq_f32(ui, ti));
+        }
+#elif defined(FFT_USE_SSE)
+        for (; j + 4 <= half; j += 4) {
+            __m128 xr = _mm_loadu_ps(br + j);
+            __m128 xi = _mm_loadu_ps(bi + j);
+            __m128 cr = _mm_loadu_ps(wr + j);
+            __m128 ci = _mm_loadu_ps(wi + j);
+            __m128 tr = _mm_sub_ps(_mm_mul_ps(xr, cr), _mm_mul_ps(xi, ci));
+            __m128 ti = _mm_add_ps(_mm_mul_ps(xr, ci), _mm_mul_ps(xi, cr));
+            __m128 ur = _mm_loadu_ps(ar + j);
+            __m128 ui = _mm_loadu_ps(ai + j);
+            _mm_storeu_ps(ar + j, _mm_add_ps(ur, tr));
+            _mm_storeu_ps(ai + j, _mm_add_ps(ui, ti));
+            _mm_storeu_ps(br + j, _mm_sub_ps(ur, tr));
+            _mm_storeu_ps(bi + j, _mm_sub_ps(ui, ti));
+        }
+#endif
+        for (; j < half; ++j) {
+            float tr = br[j] * wr[j] - bi[j] * wi[j];
+            float ti = br[j] * wi[j] + bi[j] * wr[j];
+            br[j] = ar[j] - tr;
+            bi[j] = ai[j] - ti;
+            ar[j] += tr;
+            ai[j] += ti;
+        }
+    }
+}
+
+/**
+ * Forward complex FFT of values stored in bit-reversed order, in place. The inverse transform (unnormalized)
+ * is obtained by swapping the real and imaginary arrays.
+ */
+void ComplexFFT(const FftPlan &plan, float *re, float *im)
+{
+    uint32_t size = plan.complexSize;
+    // The first stage has the twiddle 1, so it needs no multiplications
+    for (uint32_t k = 0; k + 1 < size; k += 2) {
+        float tr = re[k + 1];
+        float ti = im[k + 1];
+        re[k + 1] = re[k] - tr;
+        im[k + 1] = im[k] - ti;
+        re[k] += tr;
+        im[k] += ti;
+    }
+    for (uint32_t half = 2; half < size; half <<= 1) {
+        ButterflyStage(re, im, plan.twiddleReal.data() + half - 1, plan.twiddleImag.data() + half - 1, half, size);
+    }
+}
+} // namespace
+
+void Fft::Init(int32_t fftSize)
+{
+    if ((fftSize < MIN_FFT_SIZE) || (fftSize > MAX_FFT_SIZE) || !IsPowerOfTwo(static_cast<uint32_t>(fftSize))) {
+        SEN_HILOGE("Invalid fftSize:%{public}d", fftSize);
+        return;
+    }
+    fftSize_ = fftSize;
+    half_ = fftSize / 2;
+    plan_ = GetFftPlan(static_cast<uint32_t>(fftSize));
+    realOut_.assign(fftSize_, 0.0F);
+    imagOut_.assign(fftSize_, 0.0F);
+    workReal_.assign(half_, 0.0F);
+    workImag_.assign(half_, 0.0F);
+}
+
+const std::vector<float> &Fft::GetReal() const
+{
+    return realOut_;
+}
+
+const std::vector<float> &Fft::GetImg() const
+{
+    return imagOut_;
+}
+
+int32_t Fft::AlgRealFFT(const float *first, int32_t firstCount, const float *second, const std::vector<float> &window)
+{
+    CHKPR(plan_, Sensors::ERROR);
+    CHKPR(first, Sensors::PARAMETER_ERROR);
+    if ((firstCount <= 0) || (firstCount > fftSize_) || ((firstCount < fftSize_) && (second == nullptr)) ||
+        (window.size() < static_cast<size_t>(fftSize_))) {
+        SEN_HILOGE("Invalid parameter, firstCount:%{public}d, windowSize:%{public}zu", firstCount, window.size());
+        return Sensors::PARAMETER_ERROR;
+    }
+    const FftPlan &plan = *plan_;
+    uint32_t size = plan.complexSize;
+    // The window is applied while the two parts are packed, so the frame is never copied out of the caller's buffer
+    uint32_t count = static_cast<uint32_t>(firstCount);
+    uint32_t split = count / 2;
+    for (uint32_t j = 0; j < split; ++j) {
+        uint32_t pos = plan.bitReverse[j];
+        workReal_[pos] = first[2 * j] * window[2 * j];
+        workImag_[pos] = first[2 * j + 1] * window[2 * j + 1];
+    }
+    if ((count % 2) != 0) {
+        uint32_t pos = plan.bitReverse[split];
+        workReal_[pos] = first[count - 1] * window[count - 1];
+        workImag_[pos] = second[0] * window[count];
+        ++split;
+    }
+    for (uint32_t j = split; j < size; ++j) {
+        uint32_t pos = plan.bitReverse[j];
+        workReal_[pos] = second[2 * j - count] * window[2 * j];
+        workImag_[pos] = second[2 * j + 1 - count] * window[2 * j + 1];
+    }
+    ComplexFFT(plan, workReal_.data(), workImag_.data());
+    // X[k] = (Z[k] + conj(Z[M - k])) / 2 - i * W^k * (Z[k] - conj(Z[M - k])) / 2
+    realOut_[0] = workReal_[0] + workImag_[0];
+    imagOut_[0] = 0.0F;
+    realOut_[size] = workReal_[0] - workImag_[0];
+    imagOut_[size] = 0.0F;
+    for (uint32_t k = 1; k < size; ++k) {
+        float zr = workReal_[k];
+        float zi = workImag_[k];
+        float cr = workReal_[size - k];
+        float ci = -workImag_[size - k];
+        float evenReal = HALF * (zr + cr);
+        float evenImag = HALF * (zi + ci);
+        float oddReal = HALF * (zi - ci);
+        float oddImag = -HALF * (zr - cr);
+        realOut_[k] = evenReal + plan.splitReal[k] * oddReal - plan.splitImag[k] * oddImag;
+        imagOut_[k] = evenImag + plan.splitReal[k] * oddImag + plan.splitImag[k] * oddReal;
+        realOut_[fftSize_ - k] = realOut_[k];
+        imagOut_[fftSize_ - k] = -imagOut_[k];
+    }
+    return Sensors::SUCCESS;
+}
+
+int32_t Fft::AlgInverseFFT(const std::vector<float> &window, std::vector<float> &finalOut)
+{
+    CHKPR(plan_, Sensors::ERROR);
+    if (window.size() < static_cast<size_t>(fftSize_)) {
+        SEN_HILOGE("Invalid parameter, windowSize:%{public}zu", window.size());
+        return Sensors::PARAMETER_ERROR;
+    }
+    const FftPlan &plan = *plan_;
+    uint32_t size = plan.complexSize;
+    // Y is the conjugate symmetric extension of the bins below half_, with Y[0] = 2 * Re(X[0]) and Y[M] = 0
+    for (uint32_t k = 0; k < size; ++k) {
+        float yr = (k == 0) ? (2.0F * realOut_[0]) : realOut_[k];
+        float yi = (k == 0) ? 0.0F : imagOut_[k];
+        float cr = (k == 0) ? 0.0F : realOut_[size - k];
+        float ci = (k == 0) ? 0.0F : -imagOut_[size - k];
+        float evenReal = HALF * (yr + cr);
+        float evenImag = HALF * (yi + ci);
+        float diffReal = HALF * (yr - cr);
+        float diffImag = HALF * (yi - ci);
+        // The odd part is multiplied by conj(W^k), then Z[k] = even + i * odd
+        float oddReal = diffReal * plan.splitReal[k] + diffImag * plan.splitImag[k];
+        float oddImag = diffImag * plan.splitReal[k] - diffReal * plan.splitImag[k];
+        uint32_t pos = plan.bitReverse[k];
+        workReal_[pos] = evenReal - oddImag;
+        workImag_[pos] = evenImag + oddReal;
+    }
+    ComplexFFT(plan, workImag_.data(), workReal_.data());
+    finalOut.resize(fftSize_);
+    // The work buffers hold M times the inverse of Y, the output is half of the normalized inverse
+    float scale = HALF / static_cast<float>(size);
+    for (uint32_t j = 0; j < size; ++j) {
+        finalOut[2 * j] = workReal_[j] * scale * window[2 * j];
+        finalOut[2 * j + 1] = workImag_[j] * scale * window[2 * j + 1];
+    }
+    return Sensors::SUCCESS;
+}
+
+void Fft::CalcFFT(const std::vector<float> &data, const std::vector<float> &window)
+{
+    if (data.size() < static_cast<size_t>(fftSize_)) {
+        SEN_HILOGE("Invalid parameter, dataSize:%{public}zu", data.size());
+        return;
+    }
+    CalcFFT(data.data(), fftSize_, nullptr, window);
+}
+
+void Fft::CalcFFT(const float *first, int32_t firstCount, const float *second, const std::vector<float> &window)
+{
+    if (AlgRealFFT(first, firstCount, second, window) != Sensors::SUCCESS) {
+        SEN_HILOGE("AlgRealFFT failed");
+    }
+}
+
+void Fft::ConvertPolar(std::vector<float> &magnitude, std::vector<float> &phase)
+{
+    magnitude.resize(half_);
+    phase.resize(half_);
+    for (int32_t i = 0; i < half_; ++i) {
+        magnitude[i] = sqrt(realOut_[i] * realOut_[i] + imagOut_[i] * imagOut_[i]);
+        phase[i] = atan2(imagOut_[i], realOut_[i]);
+    }
+}
+
+void Fft::CalculatePowerSpectrum(const std::vector<float> &data, const std::vector<float> &window,
+    std::vector<float> &magnitude, std::vector<float> &phase)
+{
+    if (data.size() < static_cast<size_t>(fftSize_)) {
+        SEN_HILOGE("Invalid parameter, dataSize:%{public}zu", data.size());
+        return;
+    }
+    CalculatePowerSpectrum(data.data(), fftSize_, nullptr, window, magnitude, phase);
+}
+
+void Fft::CalculatePowerSpectrum(const float *first, int32_t firstCount, const float *second,
+    const std::vector<float> &window, std::vector<float> &magnitude, std::vector<float> &phase)
+{
+    if (AlgRealFFT(first, firstCount, second, window) != Sensors::SUCCESS) {
+        SEN_HILOGE("AlgRealFFT failed");
+        return;
+    }
+    ConvertPolar(magnitude, phase);
+}
+
+void Fft::ConvertCart(const std::vector<float> &magnitude, const std::vector<float> &phase)
+{
+    if ((magnitude.size() < static_cast<size_t>(half_)) || (phase.size() < static_cast<size_t>(half_))) {
+        SEN_HILOGE("Invalid parameter, magnitudeSize:%{public}zu, phaseSize:%{public}zu",
+            magnitude.size(), phase.size());
+        return;
+    }
+    for (int32_t i = 0; i < half_; ++i) {
+        realOut_[i] = magnitude[i] * cos(phase[i]);
+        imagOut_[i] = magnitude[i] * sin(phase[i]);
+    }
+    std::fill(realOut_.begin() + half_, realOut_.end(), 0.0F);
+    std::fill(imagOut_.begin() + half_, imagOut_.end(), 0.0F);
+}
+
+void Fft::CalcIFFT(const std::vector<float> &window, std::vector<float> &finalOut)
+{
+    if (AlgInverseFFT(window, finalOut) != Sensors::SUCCESS) {
+        SEN_HILOGE("AlgInverseFFT failed");
+    }
+}
+
+void Fft::InverseFFTComplex(const std::vector<float> &window, const std::vector<float> &real,
+    const std::vector<float> &imaginary, std::vector<float> &finalOut)
+{
+    if ((real.size() < static_cast<size_t>(half_)) || (imaginary.size() < static_cast<size_t>(half_))) {
+        SEN_HILOGE("Invalid parameter, realSize:%{public}zu, imaginarySize:%{public}zu",
+            real.size(), imaginary.size());
+        return;
+    }
+    std::copy(real.begin(), real.begin() + half_, realOut_.begin());
+    std::copy(imaginary.begin(), imaginary.begin() + half_, imagOut_.begin());
+    std::fill(realOut_.begin() + half_, realOut_.end(), 0.0F);
+    std::fill(imagOut_.begin() + half_, imagOut_.end(), 0.0F);
+    CalcIFFT(window, finalOut);
+}
+
+void Fft::InversePowerSpectrum(const std::vector<float> &window, const std::vector<float> &magnitude,
+    const std::vector<float> &phase, std::vector<float> &finalOut)
+{
+    ConvertCart(magnitude, phase);
+    CalcIFFT(window, finalOut);
+}
+
+void Fft::ConvertDB(const std::vector<float> &in, std::vector<float> &out)
+{
+    out.resize(in.size());
+    for (size_t i = 0; i < in.size(); ++i) {
+        out[i] = DB_COEF * log10(std::max(in[i], static_cast<float>(EPS_MIN)));
+    }
+}
+
+int32_t Fft::GenWindow(int32_t whichFunction, int32_t numSamples, std::vector<float> &window)
+{
+    if ((numSamples < MIN_FFT_SIZE) || (numSamples > MAX_FFT_SIZE)) {
+        SEN_HILOGE("Invalid numSamples:%{public}d", numSamples);
+        return Sensors::PARAMETER_ERROR;
+    }
+    if (window.size() < static_cast<size_t>(numSamples)) {
+        window.resize(numSamples);
+    }
+    return WindowFunc(whichFunction, numSamples, window.data());
+}
+
+int32_t Fft::WindowFunc(int32_t whichFunction, int32_t numSamples, float *out)
+{
+    CHKPR(out, Sensors::PARAMETER_ERROR);
+    switch (whichFunction) {
+        case WND_TYPE_BARTLETT: {
+            int32_t half = numSamples / 2;
+            for (int32_t i = 0; i < numSamples; ++i) {
+                out[i] = (i < half) ? (static_cast<float>(i) / half) :
+                    (1.0F - static_cast<float>(i - half) / half);
+            }
+            break;
+        }
+        case WND_TYPE_HAMMING: {
+            for (int32_t i = 0; i < numSamples; ++i) {
+                out[i] = HAMMING_ALPHA - HAMMING_BETA * cos(TWO_PI * i / (numSamples - 1));
+            }
+            break;
+        }
+        case WND_TYPE_HANNING: {
+            for (int32_t i = 0; i < numSamples; ++i) {
+                out[i] = HANNING_COEF - HANNING_COEF * cos(TWO_PI * i / (numSamples - 1));
+            }
+            break;
+        }
+        default: {
+            SEN_HILOGE("Unknown window function:%{public}d", whichFunction);
+            return Sensors::PARAMETER_ERROR;
+        }
+    }
+    return Sensors::SUCCESS;
+}
+} // namespace Sensors
+} // namespace OHOS
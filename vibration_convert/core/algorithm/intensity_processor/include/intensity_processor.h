@@ -22,6 +22,8 @@
 #include <numeric>
 #include <vector>
 
+#include "utils.h"
+
 namespace OHOS {
 namespace Sensors {
 /**
@@ -39,7 +41,7 @@ public:
      *
      * @return Return RMS value for each frame
      */
-    std::vector<double> GetRMS(const std::vector<double> &data, int32_t hopLength, bool centerFlag);
+    std::vector<double> GetRMS(const std::vector<AudioSample> &data, int32_t hopLength, bool centerFlag);
 
     /**
      * @brief Sum of sampling squares within the window
@@ -50,7 +52,7 @@ public:
      *
      * @return Return energy value for each frame
      */
-    std::vector<double> EnergyEnvelop(const std::vector<double> &data, int32_t nFft, int32_t hopLength);
+    std::vector<double> EnergyEnvelop(const std::vector<AudioSample> &data, int32_t nFft, int32_t hopLength);
 
     /**
      * @brief RMS numerical normalization.
@@ -73,7 +75,7 @@ public:
      *
      * @return Volume value for each frame
      */
-    std::vector<double> VolumeInLinary(const std::vector<double> &data, int32_t hopLength);
+    std::vector<double> VolumeInLinary(const std::vector<AudioSample> &data, int32_t hopLength);
 
     /**
      * @brief Calculate the DB volume value within each window.
@@ -84,7 +86,21 @@ public:
      *
      * @return DB value for each frame
      */
-    std::vector<double> VolumeInDB(const std::vector<double> &data, int32_t hopLength);
+    std::vector<double> VolumeInDB(const std::vector<AudioSample> &data, int32_t hopLength);
+
+    /**
+     * @brief Peak envelope of the magnitudes, for detecting long events.
+     *  Magnitudes below 'gateRatio' times the largest magnitude are set to 0, then each sample takes the largest
+     *  gated magnitude of the 'windowLen' samples starting at it. The last 'windowLen - 1' samples keep their gated
+     *  magnitude. The cost is O(n) for any window length.
+     *
+     * @param data Audio time series.
+     * @param windowLen Length of the window in samples.
+     * @param gateRatio Ratio of the largest magnitude below which magnitudes are set to 0.
+     *
+     * @return Return the envelope value for each sample.
+     */
+    std::vector<AudioSample> PeakEnvelope(const std::vector<AudioSample> &data, size_t windowLen, double gateRatio);
 };
 } // namespace Sensors
 } // namespace OHOS
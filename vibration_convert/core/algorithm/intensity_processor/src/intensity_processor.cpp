@@ -15,6 +15,8 @@
 
 #include "intensity_processor.h"
 
+#include <deque>
+
 #include "audio_utils.h"
 #include "sensor_log.h"
 #include "sensors_errors.h"
@@ -28,7 +30,7 @@ namespace {
 constexpr double VOLUME_DB_COEF { 10.0 };
 } // namespace
 
-std::vector<double> IntensityProcessor::GetRMS(const std::vector<double> &data, int32_t hopLength, bool centerFlag)
+std::vector<double> IntensityProcessor::GetRMS(const std::vector<AudioSample> &data, int32_t hopLength, bool centerFlag)
 {
     CALL_LOG_ENTER;
     std::vector<double> rmseEnvelop;
@@ -36,43 +38,36 @@ std::vector<double> IntensityProcessor::GetRMS(const std::vector<double> &data,
         SEN_HILOGE("data is empty or hopLength is less than 1");
         return rmseEnvelop;
     }
-    std::vector<double> paddingData;
-    if (centerFlag) {
-        AudioUtils audioUtil;
-        paddingData = audioUtil.PadData(data, hopLength);
-    } else {
-        paddingData = data;
-    }
-    size_t paddingDataSize = paddingData.size();
-    size_t frmN = paddingDataSize / static_cast<size_t>(hopLength);
+    // The padding of 'hopLength / 2' zeros on either side is not materialized, it adds nothing to the sums
+    size_t dataSize = data.size();
+    size_t hop = static_cast<size_t>(hopLength);
+    size_t padding = centerFlag ? (hop / 2) : 0;
+    size_t frmN = (dataSize + (2 * padding)) / hop;
+    rmseEnvelop.reserve(frmN);
     for (size_t i = 0; i < frmN; ++i) {
+        size_t frameBegin = i * hop;
+        size_t frameEnd = frameBegin + hop;
+        size_t begin = (frameBegin > padding) ? (frameBegin - padding) : 0;
+        size_t end = (frameEnd > padding) ? std::min(frameEnd - padding, dataSize) : 0;
         double accum = 0.0;
-        int32_t index = i * hopLength;
-        for (int32_t j = 0; j < hopLength; ++j, ++index) {
-            accum += pow(paddingData[index], 2);
+        for (size_t j = begin; j < end; ++j) {
+            double sample = data[j];
+            accum += sample * sample;
         }
         rmseEnvelop.push_back(sqrt(accum / hopLength));
     }
     return rmseEnvelop;
 }
 
-std::vector<double> IntensityProcessor::EnergyEnvelop(const std::vector<double> &data, int32_t nFft, int32_t hopLength)
+std::vector<double> IntensityProcessor::EnergyEnvelop(const std::vector<AudioSample> &data, int32_t nFft,
+    int32_t hopLength)
 {
-    std::vector<double> dataAbsPower;
-    size_t dataSize = data.size();
-    for (size_t i = 0; i < dataSize; ++i) {
-        dataAbsPower.push_back(data[i] * data[i]);
-    }
-    std::vector<double> oneFrmData;
-    std::vector<double> blockAmplitudeSum;
-    auto it = dataAbsPower.begin();
-    for (size_t i = 0; (i + nFft) < dataSize;) {
-        oneFrmData.assign(it + i, it + i + nFft);
-        double accum = accumulate(begin(oneFrmData), end(oneFrmData), 0);
-        blockAmplitudeSum.emplace_back(accum);
-        i += hopLength;
+    if ((nFft < 1) || (hopLength < 1)) {
+        SEN_HILOGE("nFft or hopLength is less than 1");
+        return {};
     }
-    return blockAmplitudeSum;
+    return WindowedSum(data, static_cast<size_t>(nFft), static_cast<size_t>(hopLength),
+        [](double sample) { return sample * sample; });
 }
 
 int32_t IntensityProcessor::RmseNormalize(const std::vector<double> &rmseEnvelope, double lowerDelta,
@@ -98,27 +93,18 @@ int32_t IntensityProcessor::RmseNormalize(const std::vector<double> &rmseEnvelop
     return Sensors::SUCCESS;
 }
 
-std::vector<double> IntensityProcessor::VolumeInLinary(const std::vector<double> &data, int32_t hopLength)
+std::vector<double> IntensityProcessor::VolumeInLinary(const std::vector<AudioSample> &data, int32_t hopLength)
 {
     CALL_LOG_ENTER;
-    std::vector<double> dataAbsPower;
-    size_t dataSize = data.size();
-    for (size_t i = 0; i < dataSize; ++i) {
-        dataAbsPower.push_back(abs(data[i]));
-    }
-    std::vector<double> oneFrmData;
-    std::vector<double> blockAmplitudeSum;
-    auto it = dataAbsPower.begin();
-    for (size_t i = 0; (i + hopLength) < dataSize;) {
-        oneFrmData.assign(it + i, it + i + hopLength);
-        double accum = accumulate(oneFrmData.begin(), oneFrmData.end(), 0);
-        blockAmplitudeSum.push_back(accum);
-        i += hopLength;
+    if (hopLength < 1) {
+        SEN_HILOGE("hopLength is less than 1");
+        return {};
     }
-    return blockAmplitudeSum;
+    return WindowedSum(data, static_cast<size_t>(hopLength), static_cast<size_t>(hopLength),
+        [](double sample) { return std::fabs(sample); });
 }
 
-std::vector<double> IntensityProcessor::VolumeInDB(const std::vector<double> &data, int32_t hopLength)
+std::vector<double> IntensityProcessor::VolumeInDB(const std::vector<AudioSample> &data, int32_t hopLength)
 {
     CALL_LOG_ENTER;
     std::vector<double> blockSum = EnergyEnvelop(data, hopLength, hopLength);
@@ -131,5 +117,44 @@ std::vector<double> IntensityProcessor::VolumeInDB(const std::vector<double> &da
     }
     return db;
 }
+
+std::vector<AudioSample> IntensityProcessor::PeakEnvelope(const std::vector<AudioSample> &data, size_t windowLen,
+    double gateRatio)
+{
+    CALL_LOG_ENTER;
+    if (data.empty() || (windowLen == 0)) {
+        SEN_HILOGE("data is empty or windowLen is 0");
+        return {};
+    }
+    std::vector<AudioSample> envelopes(data.size());
+    std::transform(data.begin(), data.end(), envelopes.begin(),
+        [](AudioSample sample) { return std::fabs(sample); });
+    double threshold = gateRatio * (*std::max_element(envelopes.begin(), envelopes.end()));
+    for (auto &elem : envelopes) {
+        if (elem < threshold) {
+            elem = 0;
+        }
+    }
+    if (envelopes.size() < windowLen) {
+        return envelopes;
+    }
+    // Indices of decreasing values in the current window, the front holds the maximum. envelopes[i] is overwritten
+    // once the window starting at i is complete, by then i has left the candidates unless it is the maximum itself.
+    std::deque<size_t> candidates;
+    size_t dataSize = envelopes.size();
+    for (size_t k = 0; k < dataSize; ++k) {
+        if (!candidates.empty() && ((candidates.front() + windowLen) <= k)) {
+            candidates.pop_front();
+        }
+        while (!candidates.empty() && (envelopes[candidates.back()] <= envelopes[k])) {
+            candidates.pop_back();
+        }
+        candidates.push_back(k);
+        if ((k + 1) >= windowLen) {
+            envelopes[k + 1 - windowLen] = envelopes[candidates.front()];
+        }
+    }
+    return envelopes;
+}
 } // namespace Sensors
 } // namespace OHOS
\ No newline at end of file
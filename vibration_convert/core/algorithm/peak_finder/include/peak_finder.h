@@ -18,6 +18,8 @@
 
 #include <vector>
 
+#include "utils.h"
+
 namespace OHOS {
 namespace Sensors {
 /**
@@ -46,6 +48,20 @@ struct ValleyPoint {
     std::vector<double> values;
 };
 
+/**
+ * @brief The remaining peaks of a MountainPosition linked in order, so that a secondary peak is removed in O(1).
+ */
+struct PeakChain {
+    /** Index of the first remaining peak */
+    int32_t head { 0 };
+    /** Index of the previous remaining peak, -1 at the head */
+    std::vector<int32_t> prev;
+    /** Index of the next remaining peak, -1 at the tail */
+    std::vector<int32_t> next;
+    /** Lowest value between a peak and its previous peak within the range being filtered */
+    std::vector<double> leftValley;
+};
+
 /**
  * @brief Peak information.
  */
@@ -123,7 +139,8 @@ public:
      *
      * @return Returns <b>0</b> if the operation is successful; returns a negative value otherwise.
      */
-    int32_t ObtainTransientByAmplitude(const std::vector<double> &data, IsolatedEnvelopeInfo &isolatedEnvelopeInfo);
+    int32_t ObtainTransientByAmplitude(const std::vector<AudioSample> &data,
+        IsolatedEnvelopeInfo &isolatedEnvelopeInfo);
 
     /**
      * @brief Get the Voice Segment Flag
@@ -134,16 +151,18 @@ public:
     std::vector<bool> GetVoiceSegmentFlag() const;
 
 private:
-    bool GetDeleteFlagOfPeak(const std::vector<double> &envelope, int32_t peakIndex, int32_t valleyIndex,
-        const std::vector<double> &valleysValue, const MountainPosition &mountainPosition);
+    bool GetDeleteFlagOfPeak(const std::vector<double> &envelope, int32_t peakIndex, double rightValley,
+        const MountainPosition &mountainPosition, const PeakChain &peakChain);
     std::vector<double> ExtractValues(const std::vector<double> &envelope, const std::vector<int32_t> &idxs);
-    std::vector<bool> GetVoiceFlag(const std::vector<double> &data,
+    std::vector<bool> GetVoiceFlag(const std::vector<AudioSample> &data,
         const std::vector<int32_t> &peaks, double lowerAmp);
-    void GetEachIndependentEnvelope(const std::vector<double> &data, const std::vector<int32_t> &peaks,
+    template<typename T>
+    void GetEachIndependentEnvelope(const std::vector<T> &data, const std::vector<int32_t> &peaks,
         double lowerAmp, MountainPosition &mountainPosition);
-    bool FindPeakBoundary(const std::vector<double> &data, int32_t peakPlace, double threshold,
+    template<typename T>
+    bool FindPeakBoundary(const std::vector<T> &data, int32_t peakPlace, double threshold,
         BothSidesOfPeak &bothSides);
-    std::vector<int32_t> PeakFilterMinRange(const std::vector<double> &data,
+    std::vector<int32_t> PeakFilterMinRange(const std::vector<AudioSample> &data,
         std::vector<int32_t> &peaks, int32_t minSampleCount);
     std::vector<int32_t> FilterLowPeak(const std::vector<double> &envelope,
         const std::vector<int32_t> &peaks, double removeRatio);
@@ -151,15 +170,15 @@ private:
         const std::vector<int32_t> &envelopeLast);
     std::vector<int32_t> FilterSecondaryPeak(const std::vector<double> &envelope,
         const std::vector<int32_t> &peaks, double lowerAmp);
-    int32_t DeletePeaks(const std::vector<double> &envelope, int32_t startPos, int32_t endPos,
-        MountainPosition &mountainPosition, int32_t &index);
-    int32_t DetectValley(const std::vector<double> &envelope, int32_t startPos, int32_t endPos,
+    int32_t DeletePeaks(const std::vector<double> &envelope, const MountainPosition &mountainPosition,
+        PeakChain &peakChain, int32_t &startIndex, int32_t &endIndex);
+    int32_t DetectValley(const std::vector<AudioSample> &envelope, int32_t startPos, int32_t endPos,
         const MountainPosition &mountainPosition, ValleyPoint &valleyPoint);
 
     double GetLowestPeakValue(const std::vector<double> &envelope, const std::vector<int32_t> &peaks);
-    int32_t GetPeakEnvelope(const std::vector<double> &data, int32_t samplingRate, int32_t hopLength,
+    int32_t GetPeakEnvelope(const std::vector<AudioSample> &data, int32_t samplingRate, int32_t hopLength,
         PeaksInfo &peakDetection);
-    int32_t EstimateDownwardTrend(const std::vector<double> &data, const std::vector<int32_t> &peaksPoint,
+    int32_t EstimateDownwardTrend(const std::vector<AudioSample> &data, const std::vector<int32_t> &peaksPoint,
         const std::vector<int32_t> &lastPeaksPoint, std::vector<DownwardTrendInfo> &downwardTrends);
 
     /**
@@ -178,13 +197,14 @@ private:
      */
     void SplitLongShortEnvelope(int32_t dataSize, const std::vector<int32_t> &firstPos,
         const std::vector<int32_t> &lastPos, EnvelopeSegmentInfo &envelopeList);
-    int32_t GetIsolatedEnvelope(const std::vector<double> &data, const std::vector<int32_t> &peaks,
+    int32_t GetIsolatedEnvelope(const std::vector<AudioSample> &data, const std::vector<int32_t> &peaks,
         double lowerAmp, IsolatedEnvelopeInfo &isolatedEnvelopeInfo);
     // Descending energy
     // 1.Energy occupation ratio(area occupation ratio)
     // 2.Lowering energy difference
     // Returns < b>0 < / b > if the operation is successful; returns a negative value otherwise.
-    int32_t EstimateDesentEnergy(const std::vector<double> &data, double &dropHeight, double &dutyCycle);
+    int32_t EstimateDesentEnergy(const std::vector<AudioSample> &data, int32_t startPos, int32_t endPos,
+        double &dropHeight, double &dutyCycle);
 
 private:
     std::vector<bool> voiceSegmentFlag_;
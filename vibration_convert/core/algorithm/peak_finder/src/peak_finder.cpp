@@ -17,6 +17,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <deque>
 #include <iterator>
 
 #include "sensor_log.h"
@@ -46,6 +47,39 @@ constexpr int32_t HUNDRED_POINT_DESCENT_HEIGHT { 100 };
 constexpr double DROP_HIGHT { 1.0 };
 constexpr int32_t AMPLITUDE_ENVELOPE_HOP_LENGTH { 256 };
 constexpr double DROP_HIGHT_THRESHOLD { 0.3 }; // 30%
+constexpr int32_t INVALID_INDEX { -1 };
+
+// Replace each of the first 'count' points with the maximum of the 'windowLen' points starting there,
+// using a monotonic deque instead of rescanning every window.
+void SlidingMaxInPlace(std::vector<AudioSample> &envelope, size_t windowLen, size_t count)
+{
+    if ((count == 0) || (windowLen == 0) || ((count + windowLen - 1) > envelope.size())) {
+        return;
+    }
+    std::deque<size_t> maxIndexes;
+    size_t end = count + windowLen - 1;
+    for (size_t i = 0; i < end; ++i) {
+        while (!maxIndexes.empty() && (envelope[maxIndexes.back()] <= envelope[i])) {
+            maxIndexes.pop_back();
+        }
+        maxIndexes.push_back(i);
+        if (i + 1 < windowLen) {
+            continue;
+        }
+        size_t begin = i + 1 - windowLen;
+        // The window beginning at 'begin' was fully read before the point is overwritten.
+        if (maxIndexes.front() < begin) {
+            maxIndexes.pop_front();
+        }
+        envelope[begin] = envelope[maxIndexes.front()];
+    }
+}
+
+double ObtainValleyValue(const std::vector<double> &envelope, int32_t startIndex, int32_t endIndex)
+{
+    auto iter = std::min_element((envelope.begin() + startIndex), (envelope.begin() + endIndex));
+    return envelope[iter - envelope.begin()];
+}
 } // namespace
 
 std::vector<double> PeakFinder::ExtractValues(const std::vector<double> &envelope, const std::vector<int32_t> &idxs)
@@ -63,7 +97,7 @@ std::vector<double> PeakFinder::ExtractValues(const std::vector<double> &envelop
 }
 
 // In order to reduce the impact of voiceless and noise on the frequency of voiced sounds, the threshold is increased.
-std::vector<bool> PeakFinder::GetVoiceFlag(const std::vector<double> &data, const std::vector<int32_t> &peaks,
+std::vector<bool> PeakFinder::GetVoiceFlag(const std::vector<AudioSample> &data, const std::vector<int32_t> &peaks,
     double lowerAmp)
 {
     if (data.empty()) {
@@ -81,9 +115,9 @@ std::vector<bool> PeakFinder::GetVoiceFlag(const std::vector<double> &data, cons
     if (peakAmp.size() > 2) {
         lowerAmp = peakAmp[static_cast<int32_t>(peakAmp.size() * INTERSITY_NUMBER_BOUNDARY_POINT)];
     }
-    std::vector<double> triangularEnvelope(data.size(), 0.0);
+    std::vector<AudioSample> triangularEnvelope(data.size(), 0.0);
     for (size_t i = 0; i < data.size(); i++) {
-        triangularEnvelope[i] = fabs(data[i]);
+        triangularEnvelope[i] = std::fabs(data[i]);
     }
     double threshold = lowerAmp;
     for (size_t i = 0; i < triangularEnvelope.size(); i++) {
@@ -92,12 +126,8 @@ std::vector<bool> PeakFinder::GetVoiceFlag(const std::vector<double> &data, cons
         }
     }
     size_t envelopeLength = triangularEnvelope.size();
-    auto it = triangularEnvelope.begin();
-    for (size_t i = 0; i < envelopeLength; i++) {
-        if ((i + MAX_N) >= envelopeLength) {
-            break;
-        }
-        triangularEnvelope[i] = *max_element(it + i, it + i + MAX_N);
+    if (envelopeLength > MAX_N) {
+        SlidingMaxInPlace(triangularEnvelope, MAX_N, envelopeLength - MAX_N);
     }
     MountainPosition mountainPosition;
     // Obtain the independent envelope of each peak point
@@ -121,13 +151,20 @@ std::vector<bool> PeakFinder::SplitVoiceSlienceRange(int32_t dataSize, const std
     }
     std::vector<bool> vioceFlag(dataSize, false);
     std::vector<bool> segmentFlag(ceil(static_cast<double>(dataSize) / hopLength_), false);
+    // Peaks sharing an envelope repeat its range, so count range edges and mark each point once.
+    std::vector<int32_t> rangeEdges(dataSize + 1, 0);
     for (size_t i = 0; i < envelopeStart.size(); ++i) {
-        for (int32_t boundary = envelopeStart[i]; boundary <= envelopeLast[i]; ++boundary) {
-            if (boundary > vioceFlag.size()) {
-                break;
-            }
-            vioceFlag[boundary] = true;
+        int32_t last = std::min(envelopeLast[i], dataSize - 1);
+        if ((envelopeStart[i] < 0) || (envelopeStart[i] > last)) {
+            continue;
         }
+        ++rangeEdges[envelopeStart[i]];
+        --rangeEdges[last + 1];
+    }
+    int32_t coverCount = 0;
+    for (int32_t i = 0; i < dataSize; ++i) {
+        coverCount += rangeEdges[i];
+        vioceFlag[i] = (coverCount > 0);
     }
     for (int32_t i = 0; i < dataSize;) {
         if (vioceFlag[i]) {
@@ -142,7 +179,8 @@ std::vector<bool> PeakFinder::SplitVoiceSlienceRange(int32_t dataSize, const std
 }
 
 // Obtain the independent envelope of each peak point.
-void PeakFinder::GetEachIndependentEnvelope(const std::vector<double> &data, const std::vector<int32_t> &peaks,
+template<typename T>
+void PeakFinder::GetEachIndependentEnvelope(const std::vector<T> &data, const std::vector<int32_t> &peaks,
     double lowerAmp, MountainPosition &mountainPosition)
 {
     int32_t lastLeftPos = -1;
@@ -171,7 +209,8 @@ void PeakFinder::GetEachIndependentEnvelope(const std::vector<double> &data, con
 }
 
 // Find boundary point from peak to both sides.
-bool PeakFinder::FindPeakBoundary(const std::vector<double> &data, int32_t peakPlace, double threshold,
+template<typename T>
+bool PeakFinder::FindPeakBoundary(const std::vector<T> &data, int32_t peakPlace, double threshold,
     BothSidesOfPeak &bothSides)
 {
     if (data.empty() || (peakPlace > data.size())) {
@@ -211,28 +250,29 @@ bool PeakFinder::FindPeakBoundary(const std::vector<double> &data, int32_t peakP
 }
 
 // Based on the time difference between peak points, retain a larger value and filter the peak points.
-std::vector<int32_t> PeakFinder::PeakFilterMinRange(const std::vector<double> &data, std::vector<int32_t> &peaks,
+// A single pass keeps the last retained peak as the candidate compared against the next one.
+std::vector<int32_t> PeakFinder::PeakFilterMinRange(const std::vector<AudioSample> &data, std::vector<int32_t> &peaks,
     int32_t minSampleCount)
 {
     if (peaks.empty() || peaks.size() <= 1) {
         return peaks;
     }
-    for (size_t i = 0; i < (peaks.size() - 1); i++) {
-        if (fabs(peaks[i] - peaks[i + 1]) < minSampleCount) {
-            if (peaks[i + 1] > data.size()) {
+    size_t retainCount = 0;
+    for (size_t i = 1; i < peaks.size(); i++) {
+        if (fabs(peaks[retainCount] - peaks[i]) < minSampleCount) {
+            if (peaks[i] > data.size()) {
                 SEN_HILOGW("peaks value greater than data size");
+                peaks.erase(peaks.begin() + retainCount + 1, peaks.begin() + i);
                 return peaks;
             }
-            if (data[peaks[i]] >= data[peaks[i + 1]]) {
-                auto it = (peaks.begin() + i + 1);
-                peaks.erase(it);
-            } else {
-                auto it = (peaks.begin() + i);
-                peaks.erase(it);
+            if (data[peaks[retainCount]] < data[peaks[i]]) {
+                peaks[retainCount] = peaks[i];
             }
-            --i;
+            continue;
         }
+        peaks[++retainCount] = peaks[i];
     }
+    peaks.resize(retainCount + 1);
     return peaks;
 }
 
@@ -251,11 +291,13 @@ std::vector<int32_t> PeakFinder::FilterLowPeak(const std::vector<double> &envelo
         peakValue.push_back(envelope[peakPoint[i]]);
     }
     double threshold = *max_element(peakValue.begin(), peakValue.end()) * removeRatio;
-    for (int32_t i = (peaksSize - 1); i >= 0; i--) {
-        if (peakValue[i] < threshold) {
-            peakPoint.erase(peakPoint.begin() + i);
+    size_t retainCount = 0;
+    for (size_t i = 0; i < peaksSize; i++) {
+        if (peakValue[i] >= threshold) {
+            peakPoint[retainCount++] = peakPoint[i];
         }
     }
+    peakPoint.resize(retainCount);
     return peakPoint;
 }
 
@@ -271,18 +313,27 @@ std::vector<int32_t> PeakFinder::FilterSecondaryPeak(const std::vector<double> &
         SEN_HILOGE("firstPos is empty");
         return {};
     }
+    int32_t peakCount = static_cast<int32_t>(wholeEnvelop.peakPos.size());
+    PeakChain peakChain;
+    peakChain.prev.resize(peakCount);
+    peakChain.next.resize(peakCount);
+    peakChain.leftValley.resize(peakCount);
+    for (int32_t k = 0; k < peakCount; ++k) {
+        peakChain.prev[k] = k - 1;
+        peakChain.next[k] = (k + 1 < peakCount) ? (k + 1) : INVALID_INDEX;
+    }
     int32_t lastFirstPos = wholeEnvelop.firstPos[0];
     int32_t lastEndPos = wholeEnvelop.lastPos[0];
-    size_t frontIndex = 0;
+    int32_t frontIndex = 0;
     int32_t n = 0;
     int32_t times = 0;
-    size_t i = 1;
-    while (i < wholeEnvelop.peakPos.size()) {
+    int32_t i = peakChain.next[0];
+    while (i != INVALID_INDEX) {
         ++times;
         if ((wholeEnvelop.firstPos[i] == lastFirstPos) && (wholeEnvelop.lastPos[i] == lastEndPos)) {
             ++n;
-            if (i != (wholeEnvelop.peakPos.size() - 1)) {
-                ++i;
+            if (peakChain.next[i] != INVALID_INDEX) {
+                i = peakChain.next[i];
                 continue;
             }
         }
@@ -290,17 +341,23 @@ std::vector<int32_t> PeakFinder::FilterSecondaryPeak(const std::vector<double> &
             lastFirstPos = wholeEnvelop.firstPos[i];
             lastEndPos = wholeEnvelop.lastPos[i];
             frontIndex = i;
-            ++i;
+            i = peakChain.next[i];
             continue;
         }
-        if (frontIndex == (wholeEnvelop.peakPos.size() - 1)) {
+        if (peakChain.next[frontIndex] == INVALID_INDEX) {
             break;
         }
-        int32_t toIndex = frontIndex + n;
+        int32_t toIndex = frontIndex;
+        for (int32_t k = 0; (k < n) && (toIndex != INVALID_INDEX); ++k) {
+            toIndex = peakChain.next[toIndex];
+        }
+        if (toIndex == INVALID_INDEX) {
+            SEN_HILOGE("The parameter is invalid or out of bounds");
+            return {};
+        }
         // The peak points are enveloped together, and the drop of the secondary peak is less than 30 %.
         // Delete this peak point
-        int32_t index = 0;
-        if (DeletePeaks(envelope, frontIndex, toIndex, wholeEnvelop, index) != Sensors::SUCCESS) {
+        if (DeletePeaks(envelope, wholeEnvelop, peakChain, frontIndex, toIndex) != Sensors::SUCCESS) {
             SEN_HILOGE("DeletePeaks failed");
             return {};
         }
@@ -308,69 +365,103 @@ std::vector<int32_t> PeakFinder::FilterSecondaryPeak(const std::vector<double> &
             SEN_HILOGW("times should not be greater than LOOP_TIMES_MAX, times:%{public}d", times);
             break;
         }
-        frontIndex = index;
-        i = index;
+        frontIndex = toIndex;
+        i = toIndex;
         n = 0;
     }
-    return wholeEnvelop.peakPos;
+    std::vector<int32_t> peakPos;
+    for (int32_t k = peakChain.head; k != INVALID_INDEX; k = peakChain.next[k]) {
+        peakPos.push_back(wholeEnvelop.peakPos[k]);
+    }
+    return peakPos;
 }
 
 // The peak points are enveloped together, and the drop of the secondary peak is less than 30 %. Delete this peak point
-int32_t PeakFinder::DeletePeaks(const std::vector<double> &envelope, int32_t startPos, int32_t endPos,
-    MountainPosition &mountainPosition, int32_t &endIndex)
+// Peaks are deleted one at a time from the left, as before, but only the valleys around a deleted peak are merged
+// and the search resumes at its left neighbour, the only earlier peak whose flag can change.
+int32_t PeakFinder::DeletePeaks(const std::vector<double> &envelope, const MountainPosition &mountainPosition,
+    PeakChain &peakChain, int32_t &startIndex, int32_t &endIndex)
 {
-    bool delFlag = true;
-    while (delFlag) {
-        ValleyPoint valleyPoint;
-        // The valley in both peaks detection.
-        if (DetectValley(envelope, startPos, endPos, mountainPosition, valleyPoint) != Sensors::SUCCESS) {
-            SEN_HILOGE("DetectValley failed");
-            return Sensors::ERROR;
-        }
-        std::vector<double> valleysValue = valleyPoint.values;
+    if ((startIndex < 0) || (endIndex < 0) || (endIndex >= static_cast<int32_t>(mountainPosition.peakPos.size()))) {
+        SEN_HILOGE("startIndex or endIndex is wrong");
+        return Sensors::ERROR;
+    }
+    std::vector<double> &leftValley = peakChain.leftValley;
+    int32_t prevIndex = peakChain.prev[startIndex];
+    if (prevIndex == INVALID_INDEX) {
+        leftValley[startIndex] = envelope[mountainPosition.firstPos[startIndex]];
+    } else {
+        leftValley[startIndex] = ObtainValleyValue(envelope, mountainPosition.peakPos[prevIndex],
+            mountainPosition.peakPos[startIndex]);
+    }
+    for (int32_t k = startIndex; k != endIndex; k = peakChain.next[k]) {
+        int32_t nextIndex = peakChain.next[k];
+        leftValley[nextIndex] = ObtainValleyValue(envelope, mountainPosition.peakPos[k],
+            mountainPosition.peakPos[nextIndex]);
+    }
+    double lastValley = envelope[mountainPosition.lastPos[endIndex]];
+    int32_t peakIndex = startIndex;
+    while (startIndex != endIndex) {
         // Filter out secondary peak points
-        delFlag = false;
-        int32_t valleyIndex = 0;
-        for (int32_t peakIndex = startPos; peakIndex < (endPos + 1); peakIndex++) {
-            delFlag = GetDeleteFlagOfPeak(envelope, peakIndex, valleyIndex, valleysValue, mountainPosition);
-            if (delFlag && (peakIndex < static_cast<int32_t>(mountainPosition.firstPos.size()))) {
-                mountainPosition.firstPos.erase(mountainPosition.firstPos.begin() + peakIndex);
-                mountainPosition.peakPos.erase(mountainPosition.peakPos.begin() + peakIndex);
-                mountainPosition.lastPos.erase(mountainPosition.lastPos.begin() + peakIndex);
-                --endPos;
+        bool delFlag = false;
+        for (; ; peakIndex = peakChain.next[peakIndex]) {
+            double rightValley = (peakIndex == endIndex) ? lastValley : leftValley[peakChain.next[peakIndex]];
+            delFlag = GetDeleteFlagOfPeak(envelope, peakIndex, rightValley, mountainPosition, peakChain);
+            if (delFlag || (peakIndex == endIndex)) {
                 break;
             }
-            ++valleyIndex;
         }
-        if (endPos <= startPos) {
+        if (!delFlag) {
             break;
         }
+        bool isStart = (peakIndex == startIndex);
+        prevIndex = peakChain.prev[peakIndex];
+        int32_t nextIndex = peakChain.next[peakIndex];
+        if (peakIndex == endIndex) {
+            lastValley = envelope[mountainPosition.lastPos[prevIndex]];
+            endIndex = prevIndex;
+        } else if (prevIndex == INVALID_INDEX) {
+            leftValley[nextIndex] = envelope[mountainPosition.firstPos[nextIndex]];
+        } else {
+            leftValley[nextIndex] = std::min(leftValley[peakIndex], leftValley[nextIndex]);
+        }
+        if (isStart) {
+            startIndex = nextIndex;
+        }
+        if (prevIndex == INVALID_INDEX) {
+            peakChain.head = nextIndex;
+        } else {
+            peakChain.next[prevIndex] = nextIndex;
+        }
+        if (nextIndex != INVALID_INDEX) {
+            peakChain.prev[nextIndex] = prevIndex;
+        }
+        peakIndex = isStart ? startIndex : prevIndex;
     }
-    endIndex = endPos;
     return Sensors::SUCCESS;
 }
 
-bool PeakFinder::GetDeleteFlagOfPeak(const std::vector<double> &envelope, int32_t peakIndex, int32_t valleyIndex,
-    const std::vector<double> &valleysValue, const MountainPosition &mountainPosition)
+bool PeakFinder::GetDeleteFlagOfPeak(const std::vector<double> &envelope, int32_t peakIndex, double rightValley,
+    const MountainPosition &mountainPosition, const PeakChain &peakChain)
 {
-    if (valleyIndex >= valleysValue.size() || peakIndex >= mountainPosition.peakPos.size()) {
+    if (peakIndex >= mountainPosition.peakPos.size()) {
         SEN_HILOGW("invalid parameter");
         return false;
     }
     double peakValue = envelope[mountainPosition.peakPos[peakIndex]];
+    double leftValley = peakChain.leftValley[peakIndex];
     double hightThreshold = DROP_HIGHT_THRESHOLD * peakValue;
     bool delFlag = false;
-    if (((peakValue - valleysValue[valleyIndex]) < hightThreshold) &&
-        ((peakValue - valleysValue[valleyIndex + 1]) < hightThreshold)) {
+    if (((peakValue - leftValley) < hightThreshold) && ((peakValue - rightValley) < hightThreshold)) {
         delFlag = true;
-    } else if (((peakValue - valleysValue[valleyIndex]) > hightThreshold) &&
-        ((peakValue - valleysValue[valleyIndex + 1]) < hightThreshold)) {
-        if (peakValue < envelope[mountainPosition.peakPos[peakIndex+1]]) {
+    } else if (((peakValue - leftValley) > hightThreshold) && ((peakValue - rightValley) < hightThreshold)) {
+        int32_t nextIndex = peakChain.next[peakIndex];
+        if ((nextIndex != INVALID_INDEX) && (peakValue < envelope[mountainPosition.peakPos[nextIndex]])) {
             delFlag = true;
         }
-    } else if (((peakValue - valleysValue[valleyIndex]) < hightThreshold) &&
-        ((peakValue - valleysValue[valleyIndex + 1]) > hightThreshold)) {
-        if (peakValue < envelope[mountainPosition.peakPos[peakIndex-1]]) {
+    } else if (((peakValue - leftValley) < hightThreshold) && ((peakValue - rightValley) > hightThreshold)) {
+        int32_t prevIndex = peakChain.prev[peakIndex];
+        if ((prevIndex != INVALID_INDEX) && (peakValue < envelope[mountainPosition.peakPos[prevIndex]])) {
             delFlag = true;
         }
     }
@@ -378,7 +469,7 @@ bool PeakFinder::GetDeleteFlagOfPeak(const std::vector<double> &envelope, int32_
 }
 
 // The valley in both peaks detection.
-int32_t PeakFinder::DetectValley(const std::vector<double> &envelope, int32_t startPos, int32_t endPos,
+int32_t PeakFinder::DetectValley(const std::vector<AudioSample> &envelope, int32_t startPos, int32_t endPos,
     const MountainPosition &mountainPosition, ValleyPoint &valleyPoint)
 {
     if (mountainPosition.peakPos.empty()) {
@@ -450,7 +541,7 @@ std::vector<int32_t> PeakFinder::DetectPeak(const std::vector<double> &envelope,
     }
     // At begining, no rising edge, directly at the maximum point
     std::vector<int32_t> peaks;
-    if ((gradientEnvelope[0] < 0) && (gradientEnvelope[1] < 0)) {
+    if ((gradientEnvelope.size() > 1) && (gradientEnvelope[0] < 0) && (gradientEnvelope[1] < 0)) {
         peaks.push_back(0);
     }
     if (peakThreshold < EPS_MIN) {
@@ -461,6 +552,10 @@ std::vector<int32_t> PeakFinder::DetectPeak(const std::vector<double> &envelope,
         }
         return peaks;
     }
+    // A monotonic envelope has no rising edge followed by a falling one
+    if (gradient.empty()) {
+        return peaks;
+    }
     double thresholdGradient = *max_element(gradient.begin(), gradient.end()) / 2;
     if (gradient.size() > GRADIENT_SIZE_MIN) {
         gradient.erase(max_element(gradient.begin(), gradient.end()));
@@ -503,7 +598,7 @@ double PeakFinder::GetLowestPeakValue(const std::vector<double> &envelope, const
 }
 
 // Determine the peak position and parameters of short events through amplitude values.
-int32_t PeakFinder::GetPeakEnvelope(const std::vector<double> &data, int32_t samplingRate, int32_t hopLength,
+int32_t PeakFinder::GetPeakEnvelope(const std::vector<AudioSample> &data, int32_t samplingRate, int32_t hopLength,
     PeaksInfo &peakDetection)
 {
     CALL_LOG_ENTER;
@@ -511,9 +606,9 @@ int32_t PeakFinder::GetPeakEnvelope(const std::vector<double> &data, int32_t sam
         SEN_HILOGE("Invalid parameter");
         return Sensors::PARAMETER_ERROR;
     }
-    std::vector<double> absData;
+    std::vector<AudioSample> absData(data.size());
     for (size_t i = 0; i < data.size(); i++) {
-        absData.push_back(fabs(data[i]));
+        absData[i] = std::fabs(data[i]);
     }
     size_t maxN = static_cast<size_t>(hopLength);
     std::vector<double> peakEnvelope;
@@ -531,6 +626,10 @@ int32_t PeakFinder::GetPeakEnvelope(const std::vector<double> &data, int32_t sam
 
     // Filter low peak
     peakAllIdx = FilterLowPeak(peakEnvelope, peakAllIdx, REMOVE_RATIO);
+    if (peakAllIdx.empty()) {
+        SEN_HILOGE("peakAllIdx is empty");
+        return Sensors::ERROR;
+    }
     std::vector<double> extractValues = ExtractValues(peakEnvelope, peakAllIdx);
     double lowerAmp = *std::min_element(extractValues.begin(), extractValues.end()) * PEAK_LOWDELTA_RATIO_LOW;
 
@@ -561,7 +660,7 @@ int32_t PeakFinder::GetPeakEnvelope(const std::vector<double> &data, int32_t sam
 
 // Estimating the downward trend of isolated short events.
 // A descent height of less than 0.03 at 100 points indicates a slow descent.
-int32_t PeakFinder::EstimateDownwardTrend(const std::vector<double> &data, const std::vector<int32_t> &peaksPoint,
+int32_t PeakFinder::EstimateDownwardTrend(const std::vector<AudioSample> &data, const std::vector<int32_t> &peaksPoint,
     const std::vector<int32_t> &lastPeaksPoint, std::vector<DownwardTrendInfo> &downwardTrends)
 {
     if (peaksPoint.empty() || lastPeaksPoint.size() < peaksPoint.size()) {
@@ -569,18 +668,10 @@ int32_t PeakFinder::EstimateDownwardTrend(const std::vector<double> &data, const
         return Sensors::ERROR;
     }
     bool isRapidlyDecay = false;
-    std::vector<double> partEnvelope;
     for (size_t i = 0; i < peaksPoint.size(); i++) {
-        for (int32_t j = peaksPoint[i]; j < lastPeaksPoint[i]; j++) {
-            if (data[j] > data.size()) {
-                SEN_HILOGE("parameter is error");
-                break;
-            }
-            partEnvelope.push_back(data[j]);
-        }
         double dropHeight = 0.0;
         double ducyCycle = 0.0;
-        if (EstimateDesentEnergy(partEnvelope, dropHeight, ducyCycle) != Sensors::SUCCESS) {
+        if (EstimateDesentEnergy(data, peaksPoint[i], lastPeaksPoint[i], dropHeight, ducyCycle) != Sensors::SUCCESS) {
             SEN_HILOGD("EstimateDesentEnergy failed");
             continue;
         }
@@ -656,22 +747,19 @@ void PeakFinder::SplitLongShortEnvelope(int32_t dataSize, const std::vector<int3
 // Calculate the starting and ending envelopes of isolated pure short events, searching from peak to both sides
 // Do not merge common envelope peaks
 // Missing trackback function similar to note when co enveloping
-int32_t PeakFinder::GetIsolatedEnvelope(const std::vector<double> &data, const std::vector<int32_t> &peaks,
+int32_t PeakFinder::GetIsolatedEnvelope(const std::vector<AudioSample> &data, const std::vector<int32_t> &peaks,
     double lowerAmp, IsolatedEnvelopeInfo &isolatedEnvelopeInfo)
 {
-    std::vector<double> triangularEnvelope(data.size(), 0.0);
+    std::vector<AudioSample> triangularEnvelope(data.size(), 0.0);
     for (size_t i = 0; i < data.size(); i++) {
-        triangularEnvelope[i] = fabs(data[i]);
+        triangularEnvelope[i] = std::fabs(data[i]);
         if (triangularEnvelope[i] < lowerAmp) {
             triangularEnvelope[i] = 0;
         }
     }
     size_t envelopeSize = triangularEnvelope.size();
-    size_t j = 0;
-    while ((j + MAX_N) <= envelopeSize) {
-        double maxValue = *std::max_element(triangularEnvelope.begin() + j, triangularEnvelope.begin() + j + MAX_N);
-        triangularEnvelope[j] = maxValue;
-        ++j;
+    if (envelopeSize >= MAX_N) {
+        SlidingMaxInPlace(triangularEnvelope, MAX_N, envelopeSize - MAX_N + 1);
     }
     int32_t leastCount = 2 * hopLength_;
     MountainPosition mountainPosition;
@@ -712,7 +800,7 @@ int32_t PeakFinder::GetIsolatedEnvelope(const std::vector<double> &data, const s
 }
 
 // Find all isolated short events through the original amplitude
-int32_t PeakFinder::ObtainTransientByAmplitude(const std::vector<double> &data,
+int32_t PeakFinder::ObtainTransientByAmplitude(const std::vector<AudioSample> &data,
     IsolatedEnvelopeInfo &isolatedEnvelopeInfo)
 {
     if (data.empty()) {
@@ -746,13 +834,19 @@ int32_t PeakFinder::ObtainTransientByAmplitude(const std::vector<double> &data,
     return ret;
 }
 
-int32_t PeakFinder::EstimateDesentEnergy(const std::vector<double> &data, double &dropHeight, double &dutyCycle)
+int32_t PeakFinder::EstimateDesentEnergy(const std::vector<AudioSample> &data, int32_t startPos, int32_t endPos,
+    double &dropHeight, double &dutyCycle)
 {
-    if (data.empty()) {
+    if ((startPos < 0) || (startPos >= endPos) || (static_cast<size_t>(endPos) > data.size())) {
         SEN_HILOGE("data is empty");
         return Sensors::ERROR;
     }
-    std::vector<double> blockSum = ObtainAmplitudeEnvelop(data, DESCENT_WNDLEN, DESCENT_WNDLEN);
+    // Estimating within 1024 sampling points (0.046ms).
+    int32_t miniFrmN = ENERGY_HOP_LEN / DESCENT_WNDLEN;
+    // Only the first miniFrmN + 1 blocks decide the result, so the rest of the descent is not summed.
+    int32_t partEnd = std::min(endPos, static_cast<int32_t>(startPos + (miniFrmN + 1) * DESCENT_WNDLEN + 1));
+    std::vector<AudioSample> partEnvelope(data.begin() + startPos, data.begin() + partEnd);
+    std::vector<double> blockSum = ObtainAmplitudeEnvelop(partEnvelope, DESCENT_WNDLEN, DESCENT_WNDLEN);
     if (blockSum.empty()) {
         SEN_HILOGE("blockSum is empty");
         return Sensors::ERROR;
@@ -765,7 +859,7 @@ int32_t PeakFinder::EstimateDesentEnergy(const std::vector<double> &data, double
         }
         ++n;
     }
-    size_t dataSize = data.size();
+    size_t dataSize = static_cast<size_t>(endPos - startPos);
     dropHeight = 0;
     if (n == 1) {
         dropHeight = blockSum[0] / dataSize;
@@ -773,10 +867,8 @@ int32_t PeakFinder::EstimateDesentEnergy(const std::vector<double> &data, double
         dropHeight = (blockSum[0] - blockSum[1]) / DESCENT_WNDLEN;
     }
 
-    // Estimating within 1024 sampling points (0.046ms).
-    int32_t miniFrmN = ENERGY_HOP_LEN / DESCENT_WNDLEN;
-    if (n > miniFrmN) {
-        n = miniFrmN;
+    if (n > static_cast<size_t>(miniFrmN)) {
+        n = static_cast<size_t>(miniFrmN);
     }
     double totalEnergy = 0.0;
     for (size_t i = 0; i < n; i++) {
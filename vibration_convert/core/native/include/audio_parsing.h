@@ -18,12 +18,14 @@
 
 #include <fstream>
 #include <mutex>
+#include <string>
 #include <vector>
 
 #include <fcntl.h>
 #include <unistd.h>
 
 #include "singleton.h"
+#include "utils.h"
 #include "vibration_convert_type.h"
 
 namespace OHOS {
@@ -36,14 +38,22 @@ public:
     int32_t GetAudioData(int32_t samplingInterval, AudioData &audioData) const;
     int32_t ConvertAudioToHaptic(const AudioSetting &audioSetting, std::vector<HapticEvent> &hapticEvents);
     int32_t ParseAudioFile();
+    /** Cache the conversions of the whole process in cacheDir, an empty cacheDir disables the cache */
+    static int32_t SetCacheConfig(const std::string &cacheDir, int64_t maxCacheSize);
 
 private:
     int32_t RawFileDescriptorCheck();
+    int32_t ParseWaveHeader(const uint8_t *file, size_t fileSize, size_t &dataOffset);
+    int32_t ParseFormatChunk(const uint8_t *format, size_t formatSize);
+    int32_t DecodeAudioData(const uint8_t *mapBase, size_t dataOffset, size_t pageSize);
     void PrintAttributeChunk();
 
 private:
     RawFileDescriptor rawFd_;
-    AudioData audioData_;
+    /** Decoded samples with the channels averaged, one per frame */
+    std::vector<AudioSample> audioSamples_;
+    double minSample_ { 0.0 };
+    double maxSample_ { 0.0 };
     AttributeChunk attributeChunk_;
 };
 } // namespace Sensors
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HAPTIC_EVENT_CACHE_H
+#define HAPTIC_EVENT_CACHE_H
+
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "singleton.h"
+#include "utils.h"
+#include "vibration_convert_type.h"
+
+namespace OHOS {
+namespace Sensors {
+constexpr uint32_t HAPTIC_CACHE_MAGIC = 0x48435645;
+constexpr uint32_t HAPTIC_CACHE_VERSION = 1;
+constexpr int64_t HAPTIC_CACHE_SIZE_DEFAULT = 4 * 1024 * 1024;
+
+/**
+ * @brief Identifies a conversion: the audio samples it consumed, the settings it used and the version of the
+ *  conversion algorithm that produced the events.
+ */
+struct HapticCacheKey {
+    /** Hash of the audio samples, see {@link HapticEventCache::HashSamples}. */
+    uint64_t contentHash { 0 };
+    /** Number of audio samples. */
+    uint64_t sampleCount { 0 };
+    AudioSetting audioSetting;
+    /** Must change whenever the conversion produces different events for the same input. */
+    uint32_t algorithmVersion { 0 };
+};
+
+/*
+ * A cache entry is this header followed by the payload: the varint event count, then for each event the tag byte
+ * and the zigzag varint start time delta, duration, intensity and frequency. The checksum covers the payload, the
+ * rest of the header must match the key being looked up.
+ */
+struct HapticCacheHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t algorithmVersion;
+    uint32_t sampleSize;
+    uint64_t contentHash;
+    uint64_t sampleCount;
+    AudioSetting audioSetting;
+    uint32_t payloadSize;
+    uint64_t checksum;
+};
+
+/**
+ * @brief On-disk cache of converted haptic events, shared by the whole process and disabled until configured.
+ *  Entries are files of the cache directory, the least recently used ones are removed once the directory grows
+ *  beyond its size limit. Entries that are corrupt or written by another version are removed on lookup.
+ */
+class HapticEventCache : public Singleton<HapticEventCache> {
+public:
+    HapticEventCache() = default;
+    ~HapticEventCache() = default;
+
+    /**
+     * @brief Enable or disable the cache.
+     *
+     * @param cacheDir: an existing directory owned by the caller, empty disables the cache.
+     * @param maxCacheSize: the total size in bytes the entries may take.
+     *
+     * @return Returns <b>0</b> if the operation is successful; returns a negative value otherwise.
+     * @since 26.0.0
+     */
+    int32_t SetCacheConfig(const std::string &cacheDir, int64_t maxCacheSize);
+    bool IsEnabled();
+
+    /**
+     * @brief Hash the audio samples for {@link HapticCacheKey}.
+     * @since 26.0.0
+     */
+    static uint64_t HashSamples(const std::vector<AudioSample> &samples);
+
+    /**
+     * @brief Look up the events converted for the key.
+     *
+     * @return Returns <b>0</b> on a hit; returns a negative value on a miss, the caller converts the audio then.
+     * @since 26.0.0
+     */
+    int32_t Load(const HapticCacheKey &key, std::vector<HapticEvent> &hapticEvents);
+
+    /**
+     * @brief Store the events converted for the key, evicting the least recently used entries when full.
+     *
+     * @return Returns <b>0</b> if the operation is successful; returns a negative value otherwise.
+     * @since 26.0.0
+     */
+    int32_t Store(const HapticCacheKey &key, const std::vector<HapticEvent> &hapticEvents);
+
+private:
+    DISALLOW_COPY_AND_MOVE(HapticEventCache);
+    std::string GetEntryPath(const HapticCacheKey &key) const;
+    void EvictEntries();
+
+private:
+    std::mutex cacheMutex_;
+    std::string cacheDir_;
+    int64_t maxCacheSize_ { 0 };
+};
+} // namespace Sensors
+} // namespace OHOS
+#endif // HAPTIC_EVENT_CACHE_H
@@ -101,6 +101,9 @@ struct ConvertSystemParameters {
     bool slopCmbFlag { false };
     /** When calculating intensity, align the center and add half frames of 0 at the beginning and end respectively. */
     bool centerPaddingFlag { true };
+    /** The number of threads extracting the independent audio features, 1 extracts them on the calling thread
+     *  and 0 starts one per core, at most 4. */
+    int32_t workerCount { 0 };
 };
 
 class VibrationConvertCore : public Singleton<VibrationConvertCore> {
@@ -117,36 +120,51 @@ public:
      *
      * @return Returns <b>0</b> if the operation is successful; returns a negative value otherwise.
      */
-    int32_t ConvertAudioToHaptic(const AudioSetting &audioSetting, const std::vector<double> &audioDatas,
+    int32_t ConvertAudioToHaptic(const AudioSetting &audioSetting, const std::vector<AudioSample> &audioDatas,
         std::vector<HapticEvent> &hapticEvents);
 
+    /**
+     * @brief Set the number of threads that extract audio features in ConvertAudioToHaptic. The haptic events are
+     *  the same for any number of threads. Clips shorter than a few seconds are always converted serially.
+     *
+     * @param workerCount: the number of threads, 1 extracts the features on the calling thread and 0, the default,
+     *  starts one per core, at most 4.
+     *
+     * @return Returns <b>0</b> if the operation is successful; returns a negative value otherwise.
+     */
+    int32_t SetWorkerCount(int32_t workerCount);
+
 private:
     DISALLOW_COPY_AND_MOVE(VibrationConvertCore);
-    int32_t ResampleAudioData(const std::vector<double> &srcDatas);
-    std::vector<double> PreprocessAudioData();
-    int32_t PreprocessParameter(const std::vector<double> &datas, int32_t &onsetHopLength, double &lowerDelta);
+    int32_t ResampleAudioData(const std::vector<AudioSample> &srcDatas);
+    std::vector<AudioSample> PreprocessAudioData();
+    int32_t PreprocessParameter(const std::vector<AudioSample> &datas, int32_t workerCount, int32_t &onsetHopLength,
+        double &lowerDelta);
     std::vector<int32_t> MapOnsetHop(const std::vector<int32_t> &drwIdxs, int32_t onsetHopLength);
     double CalcRmsLowerData(size_t dataSize, const std::vector<double> &rmses, const std::vector<int32_t> &newDrwIdxs);
-    int32_t CalcOnsetHopLength(const std::vector<double> &datas, double rmseMax, size_t newDrwIdxLen,
+    int32_t CalcOnsetHopLength(const std::vector<AudioSample> &datas, double rmseMax, size_t newDrwIdxLen,
         bool &continuousEventFlag, int32_t &newOnsetHopLen);
     /**
      * Before vibration conversion, amplitude density is used to classify audio files, determine whether there are
      * long events in the audio files, and adjust the onset detection window.
      */
-    int32_t IsIncludeContinuoustEvent(const std::vector<double> &datas, int32_t &longestCount,
+    int32_t IsIncludeContinuoustEvent(const std::vector<AudioSample> &datas, int32_t &longestCount,
         double &unzeroDensity, bool &isIncludeContinuoustEvent);
-    int32_t ConvertTransientEvent(const std::vector<double> &datas, int32_t onsetHopLength,
+    int32_t DetectTransientOnset(const std::vector<AudioSample> &datas, int32_t onsetHopLength,
+        std::vector<UnionTransientEvent> &unionTransientEvents);
+    void MergeTransientEvent(const IsolatedEnvelopeInfo &isolatedEnvelopeInfo,
         std::vector<UnionTransientEvent> &unionTransientEvents);
-    std::vector<UnionTransientEvent> DetectOnset(const std::vector<double> &audioDatas, int32_t onsetHopLength);
-    std::vector<bool> IsTransientEvent(const std::vector<double> &datas, const std::vector<int32_t> &onsetIdxs);
-    void GetUnzeroCount(const std::vector<double> &localDatas, int32_t &unzeroCount, double &unzeroDensity);
+    std::vector<UnionTransientEvent> DetectOnset(const std::vector<AudioSample> &audioDatas, int32_t onsetHopLength);
+    std::vector<bool> IsTransientEvent(const std::vector<AudioSample> &datas, const std::vector<int32_t> &onsetIdxs);
+    void GetUnzeroCount(const std::vector<AudioSample> &localDatas, int32_t &unzeroCount, double &unzeroDensity);
     bool IsTransientEventFlag(int32_t unzeroCount, double unzeroDensity);
     void TranslateAnchorPoint(const std::vector<int32_t> &amplitudePeakPos,
         std::vector<UnionTransientEvent> &unionTransientEvents);
     void TranslateAnchorPoint(int32_t amplitudePeakPos, int32_t &amplitudePeakIdx, double &amplitudePeakTime);
-    int32_t DetectRmsIntensity(const std::vector<double> &datas, double rmsILowerDelta,
+    int32_t DetectRmsIntensity(const std::vector<AudioSample> &datas, double rmsILowerDelta,
         std::vector<IntensityData> &intensityDatas);
-    std::vector<int32_t> DetectFrequency(const std::vector<double> &datas,
+    std::vector<double> DetectZeroCrossingRate(const std::vector<AudioSample> &datas);
+    std::vector<int32_t> DetectFrequency(const std::vector<double> &zcrs,
         const std::vector<int32_t> &rmseIntensityNorms);
     std::vector<double> StartTimeNormalize(int32_t rmseLen);
 
@@ -188,15 +206,16 @@ private:
      * Using transient events instead of onse
      */
     void EmplaceOnsetTime(bool flag, int32_t idx, double time, std::vector<UnionTransientEvent> &unionTransientEvents);
-    std::vector<double> GetLocalEnvelope(const std::vector<double> &datas);
+    std::vector<AudioSample> GetLocalEnvelope(const std::vector<AudioSample> &datas);
     bool GetRmseLowerDelta(double lowerDelta, const std::vector<double> &rmses, double &lowestDelta);
-    bool GetTransientEventFlag(const std::vector<double> &datas, int32_t onsetIdx);
-    std::vector<bool> GetTransientEventFlags(const std::vector<double> &datas, const std::vector<int32_t> &onsetIdxs);
+    bool GetTransientEventFlag(const std::vector<AudioSample> &datas, int32_t onsetIdx);
+    std::vector<bool> GetTransientEventFlags(const std::vector<AudioSample> &datas,
+        const std::vector<int32_t> &onsetIdxs);
 
 private:
     ConvertSystemParameters systemPara_;
     AudioSetting audioSetting_;
-    std::vector<double> srcAudioDatas_;
+    std::vector<AudioSample> srcAudioDatas_;
     std::vector<ContinuousEvent> continuousEvents_;
     std::vector<TransientEvent> transientEvents_;
     std::vector<HapticEvent> hapticEvents_;
@@ -18,13 +18,14 @@
 #include <algorithm>
 #include <cerrno>
 #include <cinttypes>
-#include <fstream>
 
+#include <sys/mman.h>
 #include <sys/stat.h>
 
 #include <securec.h>
 
 #include "generate_vibration_json_file.h"
+#include "haptic_event_cache.h"
 #include "sensor_log.h"
 #include "sensors_errors.h"
 #include "vibration_convert_core.h"
@@ -39,9 +40,130 @@ namespace {
 constexpr int32_t MIN_SAMPLE_COUNT = 4096;
 constexpr uint32_t AUDIO_DATA_CONVERSION_FACTOR = INT32_MAX;
 constexpr int32_t AUDIO_DATA_MAX_NUMBER = 100000;
-constexpr int64_t LSEEK_FAIL = -1;
 constexpr int32_t TIME_MS = 1000;
 constexpr int32_t BITS_PER_BYTE = 8;
+constexpr uint16_t WAVE_FORMAT_PCM = 0x0001;
+constexpr uint16_t WAVE_FORMAT_IEEE_FLOAT = 0x0003;
+constexpr uint16_t WAVE_FORMAT_EXTENSIBLE = 0xFFFE;
+constexpr size_t CHUNK_ID_SIZE = 4;
+constexpr size_t CHUNK_HEADER_SIZE = 8;
+constexpr size_t RIFF_HEADER_SIZE = 12;
+constexpr size_t FMT_CHUNK_SIZE_MIN = 16;
+// The sub format of WAVE_FORMAT_EXTENSIBLE starts with the real format tag
+constexpr size_t FMT_SUB_FORMAT_OFFSET = 24;
+constexpr size_t FMT_EXTENSIBLE_SIZE_MIN = 26;
+// Bytes of the mapped file decoded before their pages are released
+constexpr size_t DECODE_BLOCK_SIZE = 1024 * 1024;
+// 8-bit samples are unsigned around 128, scaled by 128 so that the full range maps to [-1, 1)
+constexpr int32_t PCM8_ZERO = 128;
+constexpr double PCM8_SCALE = 128.0;
+constexpr double PCM24_MAX = 8388607.0;
+constexpr int32_t PCM24_SIGN_BIT = 0x800000;
+constexpr uint32_t BYTE_SHIFT_1 = 8;
+constexpr uint32_t BYTE_SHIFT_2 = 16;
+constexpr uint32_t BYTE_SHIFT_3 = 24;
+constexpr uint16_t PCM8_BITS = 8;
+constexpr uint16_t PCM16_BITS = 16;
+constexpr uint16_t PCM24_BITS = 24;
+constexpr uint16_t SAMPLE32_BITS = 32;
+constexpr uint16_t SAMPLE64_BITS = 64;
+
+using FrameDecoder = void (*)(const uint8_t *frames, size_t frameCount, uint16_t channels, AudioSample *output);
+
+inline uint16_t ReadUint16(const uint8_t *data)
+{
+    return static_cast<uint16_t>(data[0] | (data[1] << BYTE_SHIFT_1));
+}
+
+inline uint32_t ReadUint32(const uint8_t *data)
+{
+    return static_cast<uint32_t>(data[0]) | (static_cast<uint32_t>(data[1]) << BYTE_SHIFT_1) |
+        (static_cast<uint32_t>(data[2]) << BYTE_SHIFT_2) | (static_cast<uint32_t>(data[3]) << BYTE_SHIFT_3);
+}
+
+inline double DecodePcm8(const uint8_t *sample)
+{
+    return static_cast<double>(static_cast<int32_t>(sample[0]) - PCM8_ZERO) / PCM8_SCALE;
+}
+
+inline double DecodePcm16(const uint8_t *sample)
+{
+    return static_cast<double>(static_cast<int16_t>(ReadUint16(sample))) / INT16_MAX;
+}
+
+inline double DecodePcm24(const uint8_t *sample)
+{
+    int32_t value = static_cast<int32_t>(sample[0] | (sample[1] << BYTE_SHIFT_1) | (sample[2] << BYTE_SHIFT_2));
+    return static_cast<double>((value ^ PCM24_SIGN_BIT) - PCM24_SIGN_BIT) / PCM24_MAX;
+}
+
+inline double DecodePcm32(const uint8_t *sample)
+{
+    return static_cast<double>(static_cast<int32_t>(ReadUint32(sample))) / AUDIO_DATA_CONVERSION_FACTOR;
+}
+
+inline double DecodeFloat32(const uint8_t *sample)
+{
+    float value = 0.0F;
+    (void)memcpy_s(&value, sizeof(value), sample, sizeof(value));
+    return static_cast<double>(value);
+}
+
+inline double DecodeFloat64(const uint8_t *sample)
+{
+    double value = 0.0;
+    (void)memcpy_s(&value, sizeof(value), sample, sizeof(value));
+    return value;
+}
+
+// Decode interleaved frames and average the channels into one sample per frame.
+template<size_t sampleSize, double (*decode)(const uint8_t *)>
+void DecodeFrames(const uint8_t *frames, size_t frameCount, uint16_t channels, AudioSample *output)
+{
+    if (channels == 1) {
+        for (size_t i = 0; i < frameCount; ++i) {
+            output[i] = static_cast<AudioSample>(decode(frames + i * sampleSize));
+        }
+        return;
+    }
+    size_t frameSize = sampleSize * channels;
+    double scale = 1.0 / channels;
+    for (size_t i = 0; i < frameCount; ++i) {
+        const uint8_t *frame = frames + i * frameSize;
+        double sum = 0.0;
+        for (uint16_t channel = 0; channel < channels; ++channel) {
+            sum += decode(frame + channel * sampleSize);
+        }
+        output[i] = static_cast<AudioSample>(sum * scale);
+    }
+}
+
+FrameDecoder GetFrameDecoder(uint16_t formatTag, uint16_t bitsPerSample)
+{
+    if (formatTag == WAVE_FORMAT_PCM) {
+        switch (bitsPerSample) {
+            case PCM8_BITS:
+                return DecodeFrames<sizeof(uint8_t), DecodePcm8>;
+            case PCM16_BITS:
+                return DecodeFrames<sizeof(int16_t), DecodePcm16>;
+            case PCM24_BITS:
+                return DecodeFrames<PCM24_BITS / BITS_PER_BYTE, DecodePcm24>;
+            case SAMPLE32_BITS:
+                return DecodeFrames<sizeof(int32_t), DecodePcm32>;
+            default:
+                return nullptr;
+        }
+    }
+    if (formatTag == WAVE_FORMAT_IEEE_FLOAT) {
+        if (bitsPerSample == SAMPLE32_BITS) {
+            return DecodeFrames<sizeof(float), DecodeFloat32>;
+        }
+        if (bitsPerSample == SAMPLE64_BITS) {
+            return DecodeFrames<sizeof(double), DecodeFloat64>;
+        }
+    }
+    return nullptr;
+}
 } // namespace
 
 AudioParsing::AudioParsing(const RawFileDescriptor &rawFd)
@@ -79,49 +201,148 @@ int32_t AudioParsing::ParseAudioFile()
         SEN_HILOGE("RawFileDescriptorCheck failed");
         return Sensors::ERROR;
     }
-    int64_t oft = lseek(rawFd_.fd, rawFd_.offset, SEEK_SET);
-    if (oft == LSEEK_FAIL) {
-        SEN_HILOGE("lseek fail, oft:%{public}" PRId64, oft);
+    (void)memset_s(&attributeChunk_, sizeof(AttributeChunk), 0, sizeof(AttributeChunk));
+    audioSamples_.clear();
+    minSample_ = 0.0;
+    maxSample_ = 0.0;
+    int64_t pageSize = sysconf(_SC_PAGESIZE);
+    if (pageSize <= 0) {
+        SEN_HILOGE("sysconf failed, errno:%{public}d", errno);
         return Sensors::ERROR;
     }
-    (void)memset_s(&attributeChunk_, sizeof(AttributeChunk), 0, sizeof(AttributeChunk));
-    if (rawFd_.length < sizeof(AttributeChunk)) {
-        SEN_HILOGE("Invalid parameter");
+    // The file is mapped rather than read, the decoded samples are the only copy of the audio kept in memory
+    int64_t mapOffset = rawFd_.offset - (rawFd_.offset % pageSize);
+    size_t headOffset = static_cast<size_t>(rawFd_.offset - mapOffset);
+    size_t mapSize = headOffset + static_cast<size_t>(rawFd_.length);
+    void *addr = mmap(nullptr, mapSize, PROT_READ, MAP_PRIVATE, rawFd_.fd, mapOffset);
+    if (addr == MAP_FAILED) {
+        SEN_HILOGE("mmap failed, errno:%{public}d", errno);
+        return Sensors::ERROR;
+    }
+    (void)madvise(addr, mapSize, MADV_SEQUENTIAL);
+    const uint8_t *mapBase = static_cast<const uint8_t *>(addr);
+    size_t dataOffset = 0;
+    int32_t ret = ParseWaveHeader(mapBase + headOffset, static_cast<size_t>(rawFd_.length), dataOffset);
+    if (ret == Sensors::SUCCESS) {
+        PrintAttributeChunk();
+        ret = DecodeAudioData(mapBase, headOffset + dataOffset, static_cast<size_t>(pageSize));
+    }
+    munmap(addr, mapSize);
+    return ret;
+}
+
+int32_t AudioParsing::ParseWaveHeader(const uint8_t *file, size_t fileSize, size_t &dataOffset)
+{
+    if ((fileSize < RIFF_HEADER_SIZE) || (memcmp(file, "RIFF", CHUNK_ID_SIZE) != 0) ||
+        (memcmp(file + CHUNK_HEADER_SIZE, "WAVE", CHUNK_ID_SIZE) != 0)) {
+        SEN_HILOGE("Not a wave file");
         return Sensors::PARAMETER_ERROR;
     }
-    ssize_t ret = read(rawFd_.fd, &attributeChunk_, sizeof(AttributeChunk));
-    if (ret <= 0) {
-        SEN_HILOGE("read audio attribute failed, errno:%{public}d", errno);
-        return Sensors::ERROR;
+    (void)memcpy_s(attributeChunk_.chunkID, CHUNK_ID_SIZE, file, CHUNK_ID_SIZE);
+    attributeChunk_.chunkSize = ReadUint32(file + CHUNK_ID_SIZE);
+    (void)memcpy_s(attributeChunk_.format, CHUNK_ID_SIZE, file + CHUNK_HEADER_SIZE, CHUNK_ID_SIZE);
+    bool hasFormat = false;
+    size_t pos = RIFF_HEADER_SIZE;
+    while ((pos + CHUNK_HEADER_SIZE) <= fileSize) {
+        const uint8_t *chunk = file + pos;
+        size_t chunkSize = ReadUint32(chunk + CHUNK_ID_SIZE);
+        size_t bodyOffset = pos + CHUNK_HEADER_SIZE;
+        size_t available = fileSize - bodyOffset;
+        if (memcmp(chunk, "data", CHUNK_ID_SIZE) == 0) {
+            if (!hasFormat) {
+                SEN_HILOGE("The fmt chunk is missing before the data chunk");
+                return Sensors::PARAMETER_ERROR;
+            }
+            // Streamed recordings may leave the data size unset, take the rest of the file then
+            if ((chunkSize == 0) || (chunkSize > available)) {
+                SEN_HILOGW("data size:%{public}zu exceeds the file, use:%{public}zu", chunkSize, available);
+                chunkSize = available;
+            }
+            (void)memcpy_s(attributeChunk_.dataID, CHUNK_ID_SIZE, chunk, CHUNK_ID_SIZE);
+            attributeChunk_.dataSize = static_cast<uint32_t>(chunkSize);
+            dataOffset = bodyOffset;
+            return Sensors::SUCCESS;
+        }
+        if (chunkSize > available) {
+            break;
+        }
+        if (memcmp(chunk, "fmt ", CHUNK_ID_SIZE) == 0) {
+            (void)memcpy_s(attributeChunk_.fmtID, CHUNK_ID_SIZE, chunk, CHUNK_ID_SIZE);
+            if (ParseFormatChunk(file + bodyOffset, chunkSize) != Sensors::SUCCESS) {
+                SEN_HILOGE("ParseFormatChunk failed");
+                return Sensors::PARAMETER_ERROR;
+            }
+            hasFormat = true;
+        }
+        // Chunks are padded to an even size
+        pos = bodyOffset + chunkSize + (chunkSize & 1);
+    }
+    SEN_HILOGE("The data chunk is not found");
+    return Sensors::PARAMETER_ERROR;
+}
+
+int32_t AudioParsing::ParseFormatChunk(const uint8_t *format, size_t formatSize)
+{
+    if (formatSize < FMT_CHUNK_SIZE_MIN) {
+        SEN_HILOGE("Invalid fmt size:%{public}zu", formatSize);
+        return Sensors::PARAMETER_ERROR;
+    }
+    const uint8_t *field = format;
+    attributeChunk_.fmtSize = static_cast<uint32_t>(formatSize);
+    attributeChunk_.fmtTag = ReadUint16(field);
+    field += sizeof(attributeChunk_.fmtTag);
+    attributeChunk_.fmtChannels = ReadUint16(field);
+    field += sizeof(attributeChunk_.fmtChannels);
+    attributeChunk_.sampleRate = ReadUint32(field);
+    field += sizeof(attributeChunk_.sampleRate);
+    attributeChunk_.byteRate = ReadUint32(field);
+    field += sizeof(attributeChunk_.byteRate);
+    attributeChunk_.blockAilgn = ReadUint16(field);
+    field += sizeof(attributeChunk_.blockAilgn);
+    attributeChunk_.bitsPerSample = ReadUint16(field);
+    if ((attributeChunk_.fmtTag == WAVE_FORMAT_EXTENSIBLE) && (formatSize >= FMT_EXTENSIBLE_SIZE_MIN)) {
+        attributeChunk_.fmtTag = ReadUint16(format + FMT_SUB_FORMAT_OFFSET);
     }
     if ((attributeChunk_.bitsPerSample == 0) || (attributeChunk_.fmtChannels == 0)) {
         SEN_HILOGE("The divisor cannot be 0");
-        return Sensors::ERROR;
+        return Sensors::PARAMETER_ERROR;
     }
-    size_t dataCount = attributeChunk_.dataSize /
-        ((attributeChunk_.bitsPerSample / BITS_PER_BYTE) * attributeChunk_.fmtChannels);
-    PrintAttributeChunk();
-    int32_t *dataBuffer = static_cast<int32_t *>(malloc(attributeChunk_.dataSize));
-    CHKPR(dataBuffer, Sensors::ERROR);
-    (void)memset_s(dataBuffer, attributeChunk_.dataSize, 0, attributeChunk_.dataSize);
-    if (rawFd_.length < attributeChunk_.dataSize) {
-        free(dataBuffer);
-        SEN_HILOGE("Invalid parameter");
+    return Sensors::SUCCESS;
+}
+
+int32_t AudioParsing::DecodeAudioData(const uint8_t *mapBase, size_t dataOffset, size_t pageSize)
+{
+    FrameDecoder decoder = GetFrameDecoder(attributeChunk_.fmtTag, attributeChunk_.bitsPerSample);
+    if (decoder == nullptr) {
+        SEN_HILOGE("Unsupported format, fmtTag:%{public}hu, bitsPerSample:%{public}hu",
+            attributeChunk_.fmtTag, attributeChunk_.bitsPerSample);
         return Sensors::PARAMETER_ERROR;
     }
-    ret = read(rawFd_.fd, dataBuffer, attributeChunk_.dataSize);
-    if (ret <= 0) {
-        free(dataBuffer);
-        SEN_HILOGE("read audio data failed");
+    size_t frameSize = static_cast<size_t>(attributeChunk_.bitsPerSample / BITS_PER_BYTE) *
+        attributeChunk_.fmtChannels;
+    size_t frameCount = attributeChunk_.dataSize / frameSize;
+    if (frameCount == 0) {
+        SEN_HILOGE("The audio data is empty");
         return Sensors::ERROR;
     }
-    for (size_t i = 0; i < dataCount; ++i) {
-        double data = static_cast<double>(dataBuffer[i]) / AUDIO_DATA_CONVERSION_FACTOR;
-        audioData_.audioDatas.push_back(data);
+    audioSamples_.resize(frameCount);
+    size_t blockFrames = std::max(DECODE_BLOCK_SIZE / frameSize, static_cast<size_t>(1));
+    size_t releasedSize = 0;
+    for (size_t frame = 0; frame < frameCount; frame += blockFrames) {
+        size_t count = std::min(blockFrames, frameCount - frame);
+        size_t blockOffset = dataOffset + frame * frameSize;
+        decoder(mapBase + blockOffset, count, attributeChunk_.fmtChannels, audioSamples_.data() + frame);
+        // Drop the pages already decoded so that long files do not stay resident
+        size_t decodedSize = blockOffset + count * frameSize;
+        decodedSize -= decodedSize % pageSize;
+        if (decodedSize > releasedSize) {
+            (void)madvise(const_cast<uint8_t *>(mapBase) + releasedSize, decodedSize - releasedSize, MADV_DONTNEED);
+            releasedSize = decodedSize;
+        }
     }
-    audioData_.max = *std::max_element(audioData_.audioDatas.begin(), audioData_.audioDatas.end());
-    audioData_.min = *std::min_element(audioData_.audioDatas.begin(), audioData_.audioDatas.end());
-    free(dataBuffer);
+    auto minMax = std::minmax_element(audioSamples_.begin(), audioSamples_.end());
+    minSample_ = *minMax.first;
+    maxSample_ = *minMax.second;
     return Sensors::SUCCESS;
 }
 
@@ -145,11 +366,11 @@ int32_t AudioParsing::GetAudioAttribute(AudioAttribute &audioAttribute) const
 int32_t AudioParsing::GetAudioData(int32_t samplingInterval, AudioData &data) const
 {
     CALL_LOG_ENTER;
-    if (audioData_.audioDatas.empty()) {
-        SEN_HILOGE("audioDatas is empty");
+    if (audioSamples_.empty()) {
+        SEN_HILOGE("audioSamples_ is empty");
         return Sensors::ERROR;
     }
-    size_t dataCount = audioData_.audioDatas.size();
+    size_t dataCount = audioSamples_.size();
     if (samplingInterval < 0) {
         SEN_HILOGE("Invalid parameter");
         return Sensors::PARAMETER_ERROR;
@@ -161,13 +382,12 @@ int32_t AudioParsing::GetAudioData(int32_t samplingInterval, AudioData &data) co
             samplingInterval = dataCount / AUDIO_DATA_MAX_NUMBER + 1;
         }
     }
-    for (size_t i = 0; i < dataCount; ++i) {
-        if (i % samplingInterval == 0) {
-            data.audioDatas.push_back(audioData_.audioDatas[i]);
-        }
+    data.audioDatas.reserve(data.audioDatas.size() + (dataCount + samplingInterval - 1) / samplingInterval);
+    for (size_t i = 0; i < dataCount; i += samplingInterval) {
+        data.audioDatas.push_back(audioSamples_[i]);
     }
-    data.max = audioData_.max;
-    data.min = audioData_.min;
+    data.max = maxSample_;
+    data.min = minSample_;
     SEN_HILOGD("min:%{public}lf, max:%{public}lf, audioDatas.size():%{public}zu",
         data.min, data.max, data.audioDatas.size());
     return Sensors::SUCCESS;
@@ -176,13 +396,13 @@ int32_t AudioParsing::GetAudioData(int32_t samplingInterval, AudioData &data) co
 int32_t AudioParsing::ConvertAudioToHaptic(const AudioSetting &audioSetting, std::vector<HapticEvent> &hapticEvents)
 {
     CALL_LOG_ENTER;
-    if (audioData_.audioDatas.size() < MIN_SAMPLE_COUNT) {
-        SEN_HILOGE("audioDatas less then MIN_SAMPLE_COUNT, audioDatas.size():%{public}zu",
-            audioData_.audioDatas.size());
+    if (audioSamples_.size() < MIN_SAMPLE_COUNT) {
+        SEN_HILOGE("audioSamples_ less then MIN_SAMPLE_COUNT, audioSamples_.size():%{public}zu",
+            audioSamples_.size());
         return Sensors::ERROR;
     }
     VibrationConvertCore vibrationConvertCore;
-    if (vibrationConvertCore.ConvertAudioToHaptic(audioSetting, audioData_.audioDatas, hapticEvents) !=
+    if (vibrationConvertCore.ConvertAudioToHaptic(audioSetting, audioSamples_, hapticEvents) !=
         Sensors::SUCCESS) {
         SEN_HILOGE("ConvertAudioToHaptic failed");
         return Sensors::ERROR;
@@ -192,6 +412,12 @@ int32_t AudioParsing::ConvertAudioToHaptic(const AudioSetting &audioSetting, std
     return Sensors::SUCCESS;
 }
 
+int32_t AudioParsing::SetCacheConfig(const std::string &cacheDir, int64_t maxCacheSize)
+{
+    CALL_LOG_ENTER;
+    return HapticEventCache::GetInstance().SetCacheConfig(cacheDir, maxCacheSize);
+}
+
 void AudioParsing::PrintAttributeChunk()
 {
     CALL_LOG_ENTER;
@@ -0,0 +1,481 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "haptic_event_cache.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <ctime>
+#include <iomanip>
+#include <sstream>
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <securec.h>
+
+#include "sensor_log.h"
+#include "sensors_errors.h"
+
+#undef LOG_TAG
+#define LOG_TAG "HapticEventCache"
+
+namespace OHOS {
+namespace Sensors {
+namespace {
+const std::string ENTRY_SUFFIX = ".hec";
+const std::string TEMP_SUFFIX = ".XXXXXX";
+// A temp file this old is left by a writer that crashed, younger ones may still be written by another process
+constexpr time_t STALE_TEMP_AGE_S = 60;
+// Far more than the events of any clip, anything larger is not an entry written by this cache
+constexpr size_t PAYLOAD_SIZE_MAX = 16 * 1024 * 1024;
+// Every event takes at least the tag byte and one byte for each of its four varints
+constexpr size_t EVENT_SIZE_MIN = 5;
+constexpr uint64_t FNV_OFFSET_BASIS = 0xCBF29CE484222325;
+constexpr uint64_t FNV_PRIME = 0x100000001B3;
+constexpr uint64_t MIX_MULTIPLIER = 0x9E3779B97F4A7C15;
+constexpr uint32_t MIX_SHIFT = 29;
+constexpr size_t HASH_BLOCK_WORDS = 512;
+constexpr int32_t HEX_WIDTH = 16;
+constexpr uint32_t VARINT_SHIFT = 7;
+constexpr uint8_t VARINT_MASK = 0x7F;
+constexpr uint8_t VARINT_MORE = 0x80;
+constexpr uint32_t MAX_VARINT_BYTES = 10;
+constexpr uint32_t SIGN_SHIFT = 63;
+
+struct CacheEntryInfo {
+    std::string name;
+    int64_t size { 0 };
+    struct timespec mtime {};
+};
+
+uint64_t HashBytes(const uint8_t *data, size_t size, uint64_t hash = FNV_OFFSET_BASIS)
+{
+    for (size_t i = 0; i < size; ++i) {
+        hash = (hash ^ data[i]) * FNV_PRIME;
+    }
+    return hash;
+}
+
+inline uint64_t MixWord(uint64_t hash, uint64_t word)
+{
+    hash = (hash ^ word) * MIX_MULTIPLIER;
+    return hash ^ (hash >> MIX_SHIFT);
+}
+
+uint64_t ZigZagEncode(int64_t value)
+{
+    return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> SIGN_SHIFT);
+}
+
+int64_t ZigZagDecode(uint64_t value)
+{
+    return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+}
+
+void PutVarint(std::vector<uint8_t> &buffer, uint64_t value)
+{
+    while (value >= VARINT_MORE) {
+        buffer.push_back(static_cast<uint8_t>(value & VARINT_MASK) | VARINT_MORE);
+        value >>= VARINT_SHIFT;
+    }
+    buffer.push_back(static_cast<uint8_t>(value));
+}
+
+void PutSigned(std::vector<uint8_t> &buffer, int64_t value)
+{
+    PutVarint(buffer, ZigZagEncode(value));
+}
+
+bool GetVarint(const uint8_t *base, size_t size, size_t &offset, uint64_t &value)
+{
+    value = 0;
+    for (uint32_t i = 0; (i < MAX_VARINT_BYTES) && (offset < size); ++i) {
+        uint8_t byte = base[offset++];
+        value |= static_cast<uint64_t>(byte & VARINT_MASK) << (i * VARINT_SHIFT);
+        if ((byte & VARINT_MORE) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool GetSigned(const uint8_t *base, size_t size, size_t &offset, int64_t &value)
+{
+    uint64_t encoded = 0;
+    if (!GetVarint(base, size, offset, encoded)) {
+        return false;
+    }
+    value = ZigZagDecode(encoded);
+    return true;
+}
+
+bool GetInt32(const uint8_t *base, size_t size, size_t &offset, int32_t &value)
+{
+    int64_t decoded = 0;
+    if (!GetSigned(base, size, offset, decoded) || (decoded < INT32_MIN) || (decoded > INT32_MAX)) {
+        return false;
+    }
+    value = static_cast<int32_t>(decoded);
+    return true;
+}
+
+bool IsSameSetting(const AudioSetting &left, const AudioSetting &right)
+{
+    return (left.transientDetection == right.transientDetection) &&
+        (left.intensityTreshold == right.intensityTreshold) && (left.frequencyTreshold == right.frequencyTreshold) &&
+        (left.frequencyMaxValue == right.frequencyMaxValue) && (left.frequencyMinValue == right.frequencyMinValue);
+}
+
+bool IsHeaderOfKey(const HapticCacheHeader &header, const HapticCacheKey &key)
+{
+    return (header.magic == HAPTIC_CACHE_MAGIC) && (header.version == HAPTIC_CACHE_VERSION) &&
+        (header.algorithmVersion == key.algorithmVersion) && (header.sampleSize == sizeof(AudioSample)) &&
+        (header.contentHash == key.contentHash) && (header.sampleCount == key.sampleCount) &&
+        IsSameSetting(header.audioSetting, key.audioSetting);
+}
+
+bool HasSuffixAt(const std::string &name, const std::string &suffix, size_t end)
+{
+    return (end > suffix.size()) && (name.compare(end - suffix.size(), suffix.size(), suffix) == 0);
+}
+
+bool IsEntryName(const std::string &name)
+{
+    return HasSuffixAt(name, ENTRY_SUFFIX, name.size());
+}
+
+bool IsTempName(const std::string &name)
+{
+    return (name.size() > TEMP_SUFFIX.size()) && (name[name.size() - TEMP_SUFFIX.size()] == '.') &&
+        HasSuffixAt(name, ENTRY_SUFFIX, name.size() - TEMP_SUFFIX.size());
+}
+
+bool IsOlder(const CacheEntryInfo &left, const CacheEntryInfo &right)
+{
+    if (left.mtime.tv_sec != right.mtime.tv_sec) {
+        return left.mtime.tv_sec < right.mtime.tv_sec;
+    }
+    return left.mtime.tv_nsec < right.mtime.tv_nsec;
+}
+
+int32_t ReadEntry(int32_t fd, std::vector<uint8_t> &entry)
+{
+    struct stat entryStat = {};
+    if (fstat(fd, &entryStat) != 0) {
+        SEN_HILOGE("fstat failed, errno:%{public}d", errno);
+        return Sensors::ERROR;
+    }
+    if ((entryStat.st_size < static_cast<off_t>(sizeof(HapticCacheHeader))) ||
+        (entryStat.st_size > static_cast<off_t>(sizeof(HapticCacheHeader) + PAYLOAD_SIZE_MAX))) {
+        SEN_HILOGE("Invalid entry size:%{public}lld", static_cast<long long>(entryStat.st_size));
+        return Sensors::ERROR;
+    }
+    entry.resize(static_cast<size_t>(entryStat.st_size));
+    size_t offset = 0;
+    while (offset < entry.size()) {
+        ssize_t count = read(fd, entry.data() + offset, entry.size() - offset);
+        if ((count < 0) && (errno == EINTR)) {
+            continue;
+        }
+        if (count <= 0) {
+            SEN_HILOGE("Read entry failed, errno:%{public}d", errno);
+            return Sensors::ERROR;
+        }
+        offset += static_cast<size_t>(count);
+    }
+    return Sensors::SUCCESS;
+}
+
+int32_t DecodeEntry(const HapticCacheKey &key, const std::vector<uint8_t> &entry,
+    std::vector<HapticEvent> &hapticEvents)
+{
+    HapticCacheHeader header = {};
+    if (memcpy_s(&header, sizeof(header), entry.data(), sizeof(header)) != EOK) {
+        SEN_HILOGE("memcpy_s failed");
+        return Sensors::ERROR;
+    }
+    if (!IsHeaderOfKey(header, key)) {
+        SEN_HILOGW("Stale entry, version:%{public}u, algorithmVersion:%{public}u", header.version,
+            header.algorithmVersion);
+        return Sensors::ERROR;
+    }
+    const uint8_t *payload = entry.data() + sizeof(header);
+    size_t payloadSize = entry.size() - sizeof(header);
+    if ((header.payloadSize != payloadSize) || (header.checksum != HashBytes(payload, payloadSize))) {
+        SEN_HILOGE("Corrupt entry, payloadSize:%{public}zu", payloadSize);
+        return Sensors::ERROR;
+    }
+    size_t offset = 0;
+    uint64_t eventCount = 0;
+    if (!GetVarint(payload, payloadSize, offset, eventCount) || (eventCount > payloadSize / EVENT_SIZE_MIN)) {
+        SEN_HILOGE("Invalid event count");
+        return Sensors::ERROR;
+    }
+    std::vector<HapticEvent> events(static_cast<size_t>(eventCount));
+    int64_t startTime = 0;
+    for (auto &event : events) {
+        if ((offset >= payloadSize) || (payload[offset] > EVENT_TAG_TRANSIENT)) {
+            SEN_HILOGE("Invalid event tag");
+            return Sensors::ERROR;
+        }
+        event.vibrateTag = static_cast<VibrateTag>(payload[offset++]);
+        int64_t startTimeDelta = 0;
+        if (!GetSigned(payload, payloadSize, offset, startTimeDelta)) {
+            SEN_HILOGE("Invalid start time");
+            return Sensors::ERROR;
+        }
+        startTime += startTimeDelta;
+        if ((startTime < INT32_MIN) || (startTime > INT32_MAX) ||
+            !GetInt32(payload, payloadSize, offset, event.duration) ||
+            !GetInt32(payload, payloadSize, offset, event.intensity) ||
+            !GetInt32(payload, payloadSize, offset, event.frequency)) {
+            SEN_HILOGE("Invalid event");
+            return Sensors::ERROR;
+        }
+        event.startTime = static_cast<int32_t>(startTime);
+    }
+    if (offset != payloadSize) {
+        SEN_HILOGE("Trailing bytes in entry");
+        return Sensors::ERROR;
+    }
+    hapticEvents.swap(events);
+    return Sensors::SUCCESS;
+}
+
+std::vector<uint8_t> EncodeEntry(const HapticCacheKey &key, const std::vector<HapticEvent> &hapticEvents)
+{
+    std::vector<uint8_t> entry(sizeof(HapticCacheHeader));
+    PutVarint(entry, hapticEvents.size());
+    int64_t lastStartTime = 0;
+    for (const auto &event : hapticEvents) {
+        entry.push_back(static_cast<uint8_t>(event.vibrateTag));
+        PutSigned(entry, event.startTime - lastStartTime);
+        PutSigned(entry, event.duration);
+        PutSigned(entry, event.intensity);
+        PutSigned(entry, event.frequency);
+        lastStartTime = event.startTime;
+    }
+    HapticCacheHeader header = {};
+    header.magic = HAPTIC_CACHE_MAGIC;
+    header.version = HAPTIC_CACHE_VERSION;
+    header.algorithmVersion = key.algorithmVersion;
+    header.sampleSize = sizeof(AudioSample);
+    header.contentHash = key.contentHash;
+    header.sampleCount = key.sampleCount;
+    header.audioSetting = key.audioSetting;
+    header.payloadSize = static_cast<uint32_t>(entry.size() - sizeof(header));
+    header.checksum = HashBytes(entry.data() + sizeof(header), header.payloadSize);
+    if (memcpy_s(entry.data(), sizeof(header), &header, sizeof(header)) != EOK) {
+        SEN_HILOGE("memcpy_s failed");
+        return {};
+    }
+    return entry;
+}
+
+int32_t WriteEntry(int32_t fd, const std::vector<uint8_t> &entry)
+{
+    size_t offset = 0;
+    while (offset < entry.size()) {
+        ssize_t count = write(fd, entry.data() + offset, entry.size() - offset);
+        if ((count < 0) && (errno == EINTR)) {
+            continue;
+        }
+        if (count <= 0) {
+            SEN_HILOGE("Write entry failed, errno:%{public}d", errno);
+            return Sensors::ERROR;
+        }
+        offset += static_cast<size_t>(count);
+    }
+    return Sensors::SUCCESS;
+}
+} // namespace
+
+int32_t HapticEventCache::SetCacheConfig(const std::string &cacheDir, int64_t maxCacheSize)
+{
+    CALL_LOG_ENTER;
+    std::lock_guard<std::mutex> cacheLock(cacheMutex_);
+    if (cacheDir.empty()) {
+        cacheDir_.clear();
+        maxCacheSize_ = 0;
+        return Sensors::SUCCESS;
+    }
+    if (maxCacheSize <= 0) {
+        SEN_HILOGE("Invalid maxCacheSize:%{public}lld", static_cast<long long>(maxCacheSize));
+        return Sensors::PARAMETER_ERROR;
+    }
+    struct stat dirStat = {};
+    if ((stat(cacheDir.c_str(), &dirStat) != 0) || !S_ISDIR(dirStat.st_mode) ||
+        (access(cacheDir.c_str(), R_OK | W_OK | X_OK) != 0)) {
+        SEN_HILOGE("Cache directory is not accessible, errno:%{public}d", errno);
+        return Sensors::PARAMETER_ERROR;
+    }
+    cacheDir_ = cacheDir;
+    maxCacheSize_ = maxCacheSize;
+    EvictEntries();
+    return Sensors::SUCCESS;
+}
+
+bool HapticEventCache::IsEnabled()
+{
+    std::lock_guard<std::mutex> cacheLock(cacheMutex_);
+    return !cacheDir_.empty();
+}
+
+uint64_t HapticEventCache::HashSamples(const std::vector<AudioSample> &samples)
+{
+    // The samples are hashed a word at a time so that the key stays cheap next to the conversion of long clips
+    const uint8_t *bytes = reinterpret_cast<const uint8_t *>(samples.data());
+    size_t size = samples.size() * sizeof(AudioSample);
+    uint64_t hash = MixWord(FNV_OFFSET_BASIS, size);
+    uint64_t words[HASH_BLOCK_WORDS];
+    size_t offset = 0;
+    while ((size - offset) >= sizeof(uint64_t)) {
+        size_t blockSize = std::min(sizeof(words), (size - offset) / sizeof(uint64_t) * sizeof(uint64_t));
+        if (memcpy_s(words, sizeof(words), bytes + offset, blockSize) != EOK) {
+            SEN_HILOGE("memcpy_s failed");
+            return 0;
+        }
+        for (size_t i = 0; i < blockSize / sizeof(uint64_t); ++i) {
+            hash = MixWord(hash, words[i]);
+        }
+        offset += blockSize;
+    }
+    return HashBytes(bytes + offset, size - offset, hash);
+}
+
+std::string HapticEventCache::GetEntryPath(const HapticCacheKey &key) const
+{
+    uint64_t hash = HashBytes(reinterpret_cast<const uint8_t *>(&key.contentHash), sizeof(key.contentHash));
+    hash = HashBytes(reinterpret_cast<const uint8_t *>(&key.sampleCount), sizeof(key.sampleCount), hash);
+    hash = HashBytes(reinterpret_cast<const uint8_t *>(&key.audioSetting), sizeof(key.audioSetting), hash);
+    hash = HashBytes(reinterpret_cast<const uint8_t *>(&key.algorithmVersion), sizeof(key.algorithmVersion), hash);
+    std::ostringstream path;
+    path << cacheDir_ << '/' << std::hex << std::setw(HEX_WIDTH) << std::setfill('0') << hash << ENTRY_SUFFIX;
+    return path.str();
+}
+
+int32_t HapticEventCache::Load(const HapticCacheKey &key, std::vector<HapticEvent> &hapticEvents)
+{
+    std::lock_guard<std::mutex> cacheLock(cacheMutex_);
+    if (cacheDir_.empty()) {
+        return Sensors::ERROR;
+    }
+    std::string path = GetEntryPath(key);
+    int32_t fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        SEN_HILOGD("Cache miss, errno:%{public}d", errno);
+        return Sensors::ERROR;
+    }
+    std::vector<uint8_t> entry;
+    int32_t ret = ReadEntry(fd, entry);
+    if (ret == Sensors::SUCCESS) {
+        ret = DecodeEntry(key, entry, hapticEvents);
+    }
+    if (ret == Sensors::SUCCESS) {
+        // The modification time orders the entries for eviction, a hit makes the entry the most recently used
+        (void)futimens(fd, nullptr);
+    }
+    close(fd);
+    if (ret != Sensors::SUCCESS) {
+        SEN_HILOGW("Remove the invalid entry, the audio is converted again");
+        (void)unlink(path.c_str());
+    }
+    return ret;
+}
+
+int32_t HapticEventCache::Store(const HapticCacheKey &key, const std::vector<HapticEvent> &hapticEvents)
+{
+    std::lock_guard<std::mutex> cacheLock(cacheMutex_);
+    if (cacheDir_.empty()) {
+        return Sensors::ERROR;
+    }
+    std::vector<uint8_t> entry = EncodeEntry(key, hapticEvents);
+    if (entry.empty()) {
+        return Sensors::ERROR;
+    }
+    // The entry is written aside and renamed into place, readers in other processes never see a partial entry
+    std::string path = GetEntryPath(key);
+    std::string tempPath = path + TEMP_SUFFIX;
+    int32_t fd = mkstemp(&tempPath[0]);
+    if (fd < 0) {
+        SEN_HILOGE("mkstemp failed, errno:%{public}d", errno);
+        return Sensors::ERROR;
+    }
+    int32_t ret = WriteEntry(fd, entry);
+    if (close(fd) != 0) {
+        SEN_HILOGE("close failed, errno:%{public}d", errno);
+        ret = Sensors::ERROR;
+    }
+    if ((ret == Sensors::SUCCESS) && (rename(tempPath.c_str(), path.c_str()) != 0)) {
+        SEN_HILOGE("rename failed, errno:%{public}d", errno);
+        ret = Sensors::ERROR;
+    }
+    if (ret != Sensors::SUCCESS) {
+        (void)unlink(tempPath.c_str());
+        return ret;
+    }
+    EvictEntries();
+    return Sensors::SUCCESS;
+}
+
+void HapticEventCache::EvictEntries()
+{
+    DIR *dir = opendir(cacheDir_.c_str());
+    if (dir == nullptr) {
+        SEN_HILOGE("opendir failed, errno:%{public}d", errno);
+        return;
+    }
+    std::vector<CacheEntryInfo> entries;
+    int64_t totalSize = 0;
+    time_t now = time(nullptr);
+    for (struct dirent *dirEntry = readdir(dir); dirEntry != nullptr; dirEntry = readdir(dir)) {
+        std::string name = dirEntry->d_name;
+        bool isTemp = IsTempName(name);
+        if (!isTemp && !IsEntryName(name)) {
+            continue;
+        }
+        struct stat entryStat = {};
+        if ((fstatat(dirfd(dir), name.c_str(), &entryStat, 0) != 0) || !S_ISREG(entryStat.st_mode)) {
+            continue;
+        }
+        if (isTemp) {
+            if ((now - entryStat.st_mtim.tv_sec) >= STALE_TEMP_AGE_S) {
+                SEN_HILOGW("Remove the temp file of an unfinished store");
+                (void)unlinkat(dirfd(dir), name.c_str(), 0);
+            }
+            continue;
+        }
+        entries.push_back({ name, static_cast<int64_t>(entryStat.st_size), entryStat.st_mtim });
+        totalSize += static_cast<int64_t>(entryStat.st_size);
+    }
+    if (totalSize > maxCacheSize_) {
+        std::sort(entries.begin(), entries.end(), IsOlder);
+        for (const auto &entry : entries) {
+            if (totalSize <= maxCacheSize_) {
+                break;
+            }
+            if (unlinkat(dirfd(dir), entry.name.c_str(), 0) == 0) {
+                totalSize -= entry.size;
+            }
+        }
+        SEN_HILOGI("Evicted cache entries, totalSize:%{public}lld", static_cast<long long>(totalSize));
+    }
+    closedir(dir);
+}
+} // namespace Sensors
+} // namespace OHOS
@@ -14,9 +14,13 @@
  */
 
 #include <algorithm>
+#include <atomic>
+#include <functional>
 #include <numeric>
+#include <thread>
 
 #include "generate_vibration_json_file.h"
+#include "haptic_event_cache.h"
 #include "sensor_log.h"
 #include "sensors_errors.h"
 #include "vibration_convert_core.h"
@@ -64,35 +68,128 @@ constexpr double AMPLITUDE_DB_MAX { 1.0 };
 constexpr int32_t ADSR_BOUNDARY_STATUS_NONE { 0 };
 constexpr int32_t ADSR_BOUNDARY_STATUS_ONE { 1 };
 constexpr int32_t ADSR_BOUNDARY_STATUS_BOTH { 2 };
+constexpr int32_t WORKER_COUNT_AUTO { 0 };
+constexpr int32_t WORKER_COUNT_MIN { 1 };
+// At most four features are extracted at the same time
+constexpr int32_t WORKER_COUNT_MAX { 4 };
+// Starting threads does not pay off for clips shorter than 5s
+constexpr size_t PARALLEL_DATA_LEN_MIN { static_cast<size_t>(SAMPLE_RATE) * 5 };
+// Keys the cached conversions, bump it whenever a change alters the haptic events produced for the same audio
+constexpr uint32_t CONVERT_ALGORITHM_VERSION { 1 };
+
+using FeatureTask = std::function<int32_t()>;
+
+int32_t GetAutoWorkerCount()
+{
+    // hardware_concurrency returns 0 when the number of cores is unknown
+    uint32_t coreCount = std::min(std::thread::hardware_concurrency(), static_cast<uint32_t>(WORKER_COUNT_MAX));
+    return std::max(static_cast<int32_t>(coreCount), WORKER_COUNT_MIN);
+}
+
+/*
+ * Each task only reads shared input and writes its own output, so the outputs do not depend on how the tasks are
+ * scheduled. The first failure in task order is returned.
+ */
+int32_t RunFeatureTasks(const std::vector<FeatureTask> &tasks, int32_t workerCount)
+{
+    size_t taskCount = tasks.size();
+    size_t threadCount = std::min(static_cast<size_t>(std::max(workerCount, WORKER_COUNT_MIN)), taskCount);
+    if (threadCount <= 1) {
+        for (const auto &task : tasks) {
+            int32_t ret = task();
+            if (ret != Sensors::SUCCESS) {
+                return ret;
+            }
+        }
+        return Sensors::SUCCESS;
+    }
+    std::vector<int32_t> rets(taskCount, Sensors::SUCCESS);
+    std::atomic<size_t> nextTask { 0 };
+    auto worker = [&tasks, &rets, &nextTask, taskCount]() {
+        for (size_t i = nextTask++; i < taskCount; i = nextTask++) {
+            rets[i] = tasks[i]();
+        }
+    };
+    std::vector<std::thread> threads;
+    threads.reserve(threadCount - 1);
+    for (size_t i = 1; i < threadCount; ++i) {
+        threads.emplace_back(worker);
+    }
+    worker();
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    for (int32_t ret : rets) {
+        if (ret != Sensors::SUCCESS) {
+            return ret;
+        }
+    }
+    return Sensors::SUCCESS;
+}
+
+// Onset and zero crossing rate detection consume double samples, a single-precision buffer is widened once for them
+const std::vector<double> &ToDoubleSamples(const std::vector<double> &samples, std::vector<double> &)
+{
+    return samples;
+}
+
+const std::vector<double> &ToDoubleSamples(const std::vector<float> &samples, std::vector<double> &buffer)
+{
+    buffer.assign(samples.begin(), samples.end());
+    return buffer;
+}
 } // namespace
 
+int32_t VibrationConvertCore::SetWorkerCount(int32_t workerCount)
+{
+    if ((workerCount < WORKER_COUNT_AUTO) || (workerCount > WORKER_COUNT_MAX)) {
+        SEN_HILOGE("Invalid workerCount:%{public}d", workerCount);
+        return Sensors::PARAMETER_ERROR;
+    }
+    systemPara_.workerCount = workerCount;
+    return Sensors::SUCCESS;
+}
+
 int32_t VibrationConvertCore::GetAudioData()
 {
-    std::vector<double> data = PreprocessAudioData();
+    std::vector<AudioSample> data = PreprocessAudioData();
+    int32_t workerCount = WORKER_COUNT_MIN;
+    if (data.size() >= PARALLEL_DATA_LEN_MIN) {
+        workerCount = (systemPara_.workerCount == WORKER_COUNT_AUTO) ? GetAutoWorkerCount() : systemPara_.workerCount;
+    }
     int32_t onsetHopLength = WINDOW_LENGTH;
     double rmsILowerDelta = 0.0;
-    if (PreprocessParameter(data, onsetHopLength, rmsILowerDelta) != Sensors::SUCCESS) {
+    if (PreprocessParameter(data, workerCount, onsetHopLength, rmsILowerDelta) != Sensors::SUCCESS) {
         SEN_HILOGE("PreprocessParameter failed");
         return Sensors::ERROR;
     }
+    // Onset, amplitude peaks, intensity and zero crossing rate only depend on data, they are merged below in order
     std::vector<UnionTransientEvent> unionTransientEvents;
-    if (ConvertTransientEvent(data, onsetHopLength, unionTransientEvents) != Sensors::SUCCESS) {
-        SEN_HILOGE("ConvertTransientEvent failed");
-        return Sensors::ERROR;
-    }
+    IsolatedEnvelopeInfo isolatedEnvelopeInfo;
     std::vector<IntensityData> intensityDatas;
-    // Processing intensity data, output parameters:intensityDatas
-    ret = DetectRmsIntensity(data, rmsILowerDelta, intensityDatas);
+    std::vector<double> zcrs;
+    std::vector<FeatureTask> tasks = {
+        [&]() { return DetectTransientOnset(data, onsetHopLength, unionTransientEvents); },
+        [&]() { return peakFinder_.ObtainTransientByAmplitude(data, isolatedEnvelopeInfo); },
+        // Processing intensity data, output parameters:intensityDatas
+        [&]() { return DetectRmsIntensity(data, rmsILowerDelta, intensityDatas); },
+        [&]() {
+            zcrs = DetectZeroCrossingRate(data);
+            return Sensors::SUCCESS;
+        },
+    };
+    int32_t ret = RunFeatureTasks(tasks, workerCount);
     if (ret != Sensors::SUCCESS) {
-        SEN_HILOGE("DetectRmsIntensity failed");
+        SEN_HILOGE("Extract audio features failed, workerCount:%{public}d", workerCount);
         return ret;
     }
+    MergeTransientEvent(isolatedEnvelopeInfo, unionTransientEvents);
     // Frequency detection
     std::vector<int32_t> rmseIntensityNorm;
     for (size_t i = 0; i < intensityDatas.size(); i++) {
         rmseIntensityNorm.push_back(intensityDatas[i].rmseIntensityNorm);
     }
-    std::vector<int32_t> freqNorms = DetectFrequency(data, rmseIntensityNorm);
+    std::vector<int32_t> freqNorms = DetectFrequency(zcrs, rmseIntensityNorm);
     if (freqNorms.empty()) {
         SEN_HILOGE("DetectFrequency failed");
         return Sensors::ERROR;
@@ -111,7 +208,7 @@ int32_t VibrationConvertCore::GetAudioData()
     return Sensors::SUCCESS;
 }
 int32_t VibrationConvertCore::ConvertAudioToHaptic(const AudioSetting &audioSetting,
-    const std::vector<double> &audioDatas, std::vector<HapticEvent> &hapticEvents)
+    const std::vector<AudioSample> &audioDatas, std::vector<HapticEvent> &hapticEvents)
 {
     CALL_LOG_ENTER;
     if (audioDatas.empty()) {
@@ -119,6 +216,22 @@ int32_t VibrationConvertCore::ConvertAudioToHaptic(const AudioSetting &audioSett
         return Sensors::ERROR;
     }
     audioSetting_ = audioSetting;
+    HapticEventCache &cache = HapticEventCache::GetInstance();
+    bool isCacheEnabled = cache.IsEnabled();
+    HapticCacheKey cacheKey;
+    if (isCacheEnabled) {
+        cacheKey.contentHash = HapticEventCache::HashSamples(audioDatas);
+        cacheKey.sampleCount = audioDatas.size();
+        cacheKey.audioSetting = audioSetting;
+        cacheKey.algorithmVersion = CONVERT_ALGORITHM_VERSION;
+        if (cache.Load(cacheKey, hapticEvents_) == Sensors::SUCCESS) {
+            SEN_HILOGI("Conversion cache hit, event count:%{public}zu", hapticEvents_.size());
+            hapticEvents = hapticEvents_;
+            GenerateVibrationJsonFile jsonFile;
+            jsonFile.GenerateJsonFile(hapticEvents_);
+            return Sensors::SUCCESS;
+        }
+    }
     int32_t ret = ResampleAudioData(audioDatas);
     if (ret != Sensors::SUCCESS) {
         SEN_HILOGE("ResampleAudioData failed");
@@ -129,13 +242,16 @@ int32_t VibrationConvertCore::ConvertAudioToHaptic(const AudioSetting &audioSett
         return Sensors::ERROR;
     }
     StoreHapticEvent();
+    if (isCacheEnabled && (cache.Store(cacheKey, hapticEvents_) != Sensors::SUCCESS)) {
+        SEN_HILOGW("Store the conversion in the cache failed");
+    }
     hapticEvents = hapticEvents_;
     GenerateVibrationJsonFile jsonFile;
     jsonFile.GenerateJsonFile(hapticEvents_);
     return Sensors::SUCCESS;
 }
 
-int32_t VibrationConvertCore::ResampleAudioData(const std::vector<double> &srcDatas)
+int32_t VibrationConvertCore::ResampleAudioData(const std::vector<AudioSample> &srcDatas)
 {
     if (srcDatas.empty()) {
         SEN_HILOGE("srcDatas is empty");
@@ -151,15 +267,15 @@ int32_t VibrationConvertCore::ResampleAudioData(const std::vector<double> &srcDa
     return Sensors::SUCCESS;
 }
 
-std::vector<double> VibrationConvertCore::PreprocessAudioData()
+std::vector<AudioSample> VibrationConvertCore::PreprocessAudioData()
 {
     CALL_LOG_ENTER;
     if (srcAudioDatas_.empty()) {
         SEN_HILOGE("invalid parameter");
         return {};
     }
-    std::vector<double> absData = srcAudioDatas_;
-    std::vector<double> dstData = srcAudioDatas_;
+    std::vector<AudioSample> absData = srcAudioDatas_;
+    std::vector<AudioSample> dstData = srcAudioDatas_;
     int32_t silence = 0;
     int32_t preClearEnd = 0;
     int32_t absDataSize = static_cast<int32_t>(absData.size());
@@ -199,18 +315,27 @@ std::vector<double> VibrationConvertCore::PreprocessAudioData()
     return dstData;
 }
 
-int32_t VibrationConvertCore::PreprocessParameter(const std::vector<double> &datas, int32_t &onsetHopLength,
-    double &lowerDelta)
+int32_t VibrationConvertCore::PreprocessParameter(const std::vector<AudioSample> &datas, int32_t workerCount,
+    int32_t &onsetHopLength, double &lowerDelta)
 {
     CALL_LOG_ENTER;
     if (datas.empty()) {
         SEN_HILOGE("datas is empty");
         return Sensors::ERROR;
     }
-    std::vector<double> rmses = intensityProcessor_.GetRMS(datas, ENERGY_HOP_LEN, systemPara_.centerPaddingFlag);
+    std::vector<double> rmses;
     OnsetInfo onsetInfo;
-    if (onset_.CheckOnset(datas, NFFT, onsetHopLength, onsetInfo) != Sensors::SUCCESS) {
-        SEN_HILOGE("CheckOnset Failed");
+    std::vector<double> sampleBuffer;
+    const std::vector<double> &onsetDatas = ToDoubleSamples(datas, sampleBuffer);
+    std::vector<FeatureTask> tasks = {
+        [&]() {
+            rmses = intensityProcessor_.GetRMS(datas, ENERGY_HOP_LEN, systemPara_.centerPaddingFlag);
+            return rmses.empty() ? Sensors::ERROR : Sensors::SUCCESS;
+        },
+        [&]() { return onset_.CheckOnset(onsetDatas, NFFT, onsetHopLength, onsetInfo); },
+    };
+    if (RunFeatureTasks(tasks, workerCount) != Sensors::SUCCESS) {
+        SEN_HILOGE("GetRMS or CheckOnset Failed");
         return Sensors::ERROR;
     }
     std::vector<int32_t> newDrwIdxs = MapOnsetHop(onsetInfo.idxs, onsetHopLength);
@@ -320,7 +445,7 @@ double VibrationConvertCore::CalcRmsLowerData(size_t dataSize, const std::vector
     return lowerDelta;
 }
 
-int32_t VibrationConvertCore::CalcOnsetHopLength(const std::vector<double> &datas, double rmseMax,
+int32_t VibrationConvertCore::CalcOnsetHopLength(const std::vector<AudioSample> &datas, double rmseMax,
     size_t newDrwIdxLen, bool &continuousEventFlag, int32_t &newOnsetHopLen)
 {
     if (datas.empty()) {
@@ -347,41 +472,20 @@ int32_t VibrationConvertCore::CalcOnsetHopLength(const std::vector<double> &data
     return Sensors::SUCCESS;
 }
 
-std::vector<double> VibrationConvertCore::GetLocalEnvelope(const std::vector<double> &datas)
+std::vector<AudioSample> VibrationConvertCore::GetLocalEnvelope(const std::vector<AudioSample> &datas)
 {
     if (datas.empty()) {
         SEN_HILOGE("invalid parameter");
         return {};
     }
-    std::vector<double> envelopes = datas;
-    for (auto &elem : envelopes) {
-        elem = std::fabs(elem);
-    }
-    double threshold = COEF * (*std::max_element(envelopes.begin(), envelopes.end()));
-    for (auto &elem : envelopes) {
-        if (elem < threshold) {
-            elem = 0;
-        }
-    }
-    size_t dataSize = envelopes.size();
-    for (size_t i = 0; i < dataSize; ++i) {
-        if ((i + LOCAL_ENVELOPE_MAX_LEN) > dataSize) {
-            break;
-        }
-        std::vector<double> segmentEnvelope;
-        for (size_t j = i; j < (i + LOCAL_ENVELOPE_MAX_LEN); ++j) {
-            segmentEnvelope.push_back(envelopes[j]);
-        }
-        envelopes[i] = *std::max_element(segmentEnvelope.begin(), segmentEnvelope.end());
-    }
-    return envelopes;
+    return intensityProcessor_.PeakEnvelope(datas, LOCAL_ENVELOPE_MAX_LEN, COEF);
 }
 
-int32_t VibrationConvertCore::IsIncludeContinuoustEvent(const std::vector<double> &datas,
+int32_t VibrationConvertCore::IsIncludeContinuoustEvent(const std::vector<AudioSample> &datas,
     int32_t &longestCount, double &unzeroDensity, bool &isIncludeContinuoustEvent)
 {
     // envelope must be a non-negative number.
-    std::vector<double> envelopes = GetLocalEnvelope(datas);
+    std::vector<AudioSample> envelopes = GetLocalEnvelope(datas);
     if (envelopes.empty()) {
         SEN_HILOGE("GetLocalEnvelope failed");
         return Sensors::ERROR;
@@ -524,7 +628,7 @@ void VibrationConvertCore::EmplaceOnsetTime(bool flag, int32_t idx, double time,
     }
 }
 
-int32_t VibrationConvertCore::ConvertTransientEvent(const std::vector<double> &datas, int32_t onsetHopLength,
+int32_t VibrationConvertCore::DetectTransientOnset(const std::vector<AudioSample> &datas, int32_t onsetHopLength,
     std::vector<UnionTransientEvent> &unionTransientEvents)
 {
     CALL_LOG_ENTER;
@@ -533,27 +637,28 @@ int32_t VibrationConvertCore::ConvertTransientEvent(const std::vector<double> &d
         return Sensors::ERROR;
     }
     // Using System Methods to Detect Onset
-    std::vector<UnionTransientEvent> unionTransientValues = DetectOnset(datas, onsetHopLength);
+    unionTransientEvents = DetectOnset(datas, onsetHopLength);
     // Is the onset just a transient event
     std::vector<int32_t> onsetIdxs;
-    for (size_t i = 0; i < unionTransientValues.size(); i++) {
-        onsetIdxs.push_back(unionTransientValues[i].onsetIdx);
+    for (size_t i = 0; i < unionTransientEvents.size(); i++) {
+        onsetIdxs.push_back(unionTransientEvents[i].onsetIdx);
     }
     std::vector<bool> transientEventFlags = IsTransientEvent(datas, onsetIdxs);
-    for (size_t i = 0; i < unionTransientValues.size(); i++) {
-        unionTransientValues[i].transientEventFlag = transientEventFlags[i];
-    }
-    IsolatedEnvelopeInfo isolatedEnvelopeInfo;
-    int32_t ret = peakFinder_.ObtainTransientByAmplitude(datas, isolatedEnvelopeInfo);
-    if (ret != Sensors::SUCCESS) {
-        SEN_HILOGE("ObtainTransientByAmplitude failed");
-        return ret;
+    for (size_t i = 0; i < unionTransientEvents.size(); i++) {
+        unionTransientEvents[i].transientEventFlag = transientEventFlags[i];
     }
+    return Sensors::SUCCESS;
+}
+
+void VibrationConvertCore::MergeTransientEvent(const IsolatedEnvelopeInfo &isolatedEnvelopeInfo,
+    std::vector<UnionTransientEvent> &unionTransientEvents)
+{
+    CALL_LOG_ENTER;
     if (!isolatedEnvelopeInfo.isHaveContinuousEvent) {
-        unionTransientValues.clear();
-        TranslateAnchorPoint(isolatedEnvelopeInfo.mountainPosition.peakPos, unionTransientValues);
-        for (size_t i = 0; i < unionTransientValues.size(); ++i) {
-            unionTransientValues[i].transientEventFlag = isolatedEnvelopeInfo.transientEventFlags[i];
+        unionTransientEvents.clear();
+        TranslateAnchorPoint(isolatedEnvelopeInfo.mountainPosition.peakPos, unionTransientEvents);
+        for (size_t i = 0; i < unionTransientEvents.size(); ++i) {
+            unionTransientEvents[i].transientEventFlag = isolatedEnvelopeInfo.transientEventFlags[i];
         }
     } else {
         size_t size =  isolatedEnvelopeInfo.mountainPosition.peakPos.size();
@@ -566,29 +671,28 @@ int32_t VibrationConvertCore::ConvertTransientEvent(const std::vector<double> &d
             double time = 0.0;
             TranslateAnchorPoint(isolatedEnvelopeInfo.mountainPosition.peakPos[i], idx, time);
             size_t findIndex = -1;
-            for (size_t j = 0; j < unionTransientValues.size(); j++) {
-                if (unionTransientValues[j].onsetIdx == idx) {
+            for (size_t j = 0; j < unionTransientEvents.size(); j++) {
+                if (unionTransientEvents[j].onsetIdx == idx) {
                     findIndex = j;
                     break;
                 }
             }
             if (findIndex != -1) {
-                unionTransientValues[findIndex].onsetTime = time;
-                unionTransientValues[findIndex].transientEventFlag = flag;
+                unionTransientEvents[findIndex].onsetTime = time;
+                unionTransientEvents[findIndex].transientEventFlag = flag;
             } else {
-                EmplaceOnsetTime(flag, idx, time, unionTransientValues);
+                EmplaceOnsetTime(flag, idx, time, unionTransientEvents);
             }
         }
     }
-    unionTransientEvents = unionTransientValues;
-    return Sensors::SUCCESS;
 }
 
-std::vector<UnionTransientEvent> VibrationConvertCore::DetectOnset(const std::vector<double> &datas,
+std::vector<UnionTransientEvent> VibrationConvertCore::DetectOnset(const std::vector<AudioSample> &datas,
     int32_t onsetHopLength)
 {
     OnsetInfo onsetInfo;
-    if (onset_.CheckOnset(datas, NFFT, onsetHopLength, onsetInfo) != Sensors::SUCCESS) {
+    std::vector<double> sampleBuffer;
+    if (onset_.CheckOnset(ToDoubleSamples(datas, sampleBuffer), NFFT, onsetHopLength, onsetInfo) != Sensors::SUCCESS) {
         SEN_HILOGE("CheckOnset Failed");
         return {};
     }
@@ -624,7 +728,7 @@ std::vector<UnionTransientEvent> VibrationConvertCore::DetectOnset(const std::ve
     return unionTransientEvents;
 }
 
-bool VibrationConvertCore::GetTransientEventFlag(const std::vector<double> &datas, int32_t onsetIdx)
+bool VibrationConvertCore::GetTransientEventFlag(const std::vector<AudioSample> &datas, int32_t onsetIdx)
 {
     if (datas.empty()) {
         SEN_HILOGE("datas is empty");
@@ -642,7 +746,7 @@ bool VibrationConvertCore::GetTransientEventFlag(const std::vector<double> &data
     if (endIdx >= dataSize) {
         endIdx = dataSize - 1;
     }
-    std::vector<double> localDatas;
+    std::vector<AudioSample> localDatas;
     for (int32_t i = beginIdx; i <= endIdx; ++i) {
         localDatas.push_back(datas[i]);
     }
@@ -653,7 +757,7 @@ bool VibrationConvertCore::GetTransientEventFlag(const std::vector<double> &data
     return IsTransientEventFlag(unzeroCount, unzeroDensity);
 }
 
-std::vector<bool> VibrationConvertCore::GetTransientEventFlags(const std::vector<double> &datas,
+std::vector<bool> VibrationConvertCore::GetTransientEventFlags(const std::vector<AudioSample> &datas,
     const std::vector<int32_t> &onsetIdxs)
 {
     if (datas.empty() || (onsetIdxs.size() <= 1)) {
@@ -687,7 +791,7 @@ std::vector<bool> VibrationConvertCore::GetTransientEventFlags(const std::vector
         if (endIdx >= dataSize) {
             endIdx = dataSize - 1;
         }
-        std::vector<double> localData;
+        std::vector<AudioSample> localData;
         for (int32_t j = beginIdx; j <= endIdx; ++j) {
             localData.push_back(datas[i]);
         }
@@ -699,7 +803,7 @@ std::vector<bool> VibrationConvertCore::GetTransientEventFlags(const std::vector
     return transientEventFlags;
 }
 
-std::vector<bool> VibrationConvertCore::IsTransientEvent(const std::vector<double> &datas,
+std::vector<bool> VibrationConvertCore::IsTransientEvent(const std::vector<AudioSample> &datas,
     const std::vector<int32_t> &onsetIdxs)
 {
     if (datas.empty() || onsetIdxs.empty()) {
@@ -716,7 +820,7 @@ std::vector<bool> VibrationConvertCore::IsTransientEvent(const std::vector<doubl
     return transientEventFlags;
 }
 
-void VibrationConvertCore::GetUnzeroCount(const std::vector<double> &localDatas,
+void VibrationConvertCore::GetUnzeroCount(const std::vector<AudioSample> &localDatas,
     int32_t &unzeroCount, double &unzeroDensity)
 {
     if (localDatas.empty()) {
@@ -725,7 +829,7 @@ void VibrationConvertCore::GetUnzeroCount(const std::vector<double> &localDatas,
         SEN_HILOGE("localDatas is empty");
         return;
     }
-    std::vector<double> envelope = localDatas;
+    std::vector<AudioSample> envelope = localDatas;
     for (auto &elem : envelope) {
         elem = std::fabs(elem);
         if (elem < LOWER_AMP) {
@@ -737,7 +841,7 @@ void VibrationConvertCore::GetUnzeroCount(const std::vector<double> &localDatas,
         if ((i + LOCAL_ENVELOPE_MAX_LEN) >= envelopeSize) {
             break;
         }
-        std::vector<double> segmentEnvelope;
+        std::vector<AudioSample> segmentEnvelope;
         for (size_t j = i; j < (i + LOCAL_ENVELOPE_MAX_LEN); ++j) {
             segmentEnvelope.push_back(envelope[j]);
         }
@@ -791,21 +895,29 @@ void VibrationConvertCore::TranslateAnchorPoint(int32_t amplitudePeakPos, int32_
     }
 }
 
-std::vector<int32_t> VibrationConvertCore::DetectFrequency(const std::vector<double> &datas,
-    const std::vector<int32_t> &rmseIntensityNorms)
+std::vector<double> VibrationConvertCore::DetectZeroCrossingRate(const std::vector<AudioSample> &datas)
 {
     CALL_LOG_ENTER;
-    std::vector<double> zcrs =  frequencyEstimation_.GetZeroCrossingRate(datas, FRAME_LEN, ENERGY_HOP_LEN);
+    std::vector<double> sampleBuffer;
+    std::vector<double> zcrs =  frequencyEstimation_.GetZeroCrossingRate(ToDoubleSamples(datas, sampleBuffer),
+        FRAME_LEN, ENERGY_HOP_LEN);
     for (auto &elem : zcrs) {
         elem = elem * SAMPLE_RATE * F_HALF;
     }
+    return zcrs;
+}
+
+std::vector<int32_t> VibrationConvertCore::DetectFrequency(const std::vector<double> &zcrs,
+    const std::vector<int32_t> &rmseIntensityNorms)
+{
+    CALL_LOG_ENTER;
     std::vector<bool> voiceSegmentFlag = peakFinder_.GetVoiceSegmentFlag();
     std::vector<int32_t> freqNorms;
     frequencyEstimation_.FreqPostProcess(zcrs, voiceSegmentFlag, rmseIntensityNorms, freqNorms);
     return freqNorms;
 }
 
-int32_t VibrationConvertCore::DetectRmsIntensity(const std::vector<double> &datas, double rmsILowerDelta,
+int32_t VibrationConvertCore::DetectRmsIntensity(const std::vector<AudioSample> &datas, double rmsILowerDelta,
     std::vector<IntensityData> &intensityDatas)
 {
     CALL_LOG_ENTER;
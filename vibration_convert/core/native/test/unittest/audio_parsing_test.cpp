@@ -0,0 +1,359 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+
+#include "audio_parsing.h"
+#include "sensor_log.h"
+#include "sensors_errors.h"
+#include "vibration_convert_type.h"
+
+#undef LOG_TAG
+#define LOG_TAG "AudioParsingTest"
+
+namespace OHOS {
+namespace Sensors {
+using namespace testing::ext;
+using namespace OHOS::HiviewDFX;
+
+namespace {
+const std::string WAVE_PATH = "/data/local/tmp/audio_parsing_test.wav";
+constexpr double EPSILON = 1e-6;
+constexpr uint16_t WAVE_FORMAT_PCM = 0x0001;
+constexpr uint16_t WAVE_FORMAT_IEEE_FLOAT = 0x0003;
+constexpr uint16_t WAVE_FORMAT_EXTENSIBLE = 0xFFFE;
+constexpr uint32_t WAVE_SAMPLE_RATE = 8000;
+constexpr uint32_t BITS_PER_BYTE = 8;
+constexpr uint32_t FMT_CHUNK_SIZE = 16;
+constexpr uint16_t FMT_EXTENSION_SIZE = 22;
+
+using Bytes = std::vector<uint8_t>;
+
+void AppendUint16(Bytes &bytes, uint16_t value)
+{
+    bytes.push_back(static_cast<uint8_t>(value & 0xFF));
+    bytes.push_back(static_cast<uint8_t>(value >> 8));
+}
+
+void AppendUint24(Bytes &bytes, uint32_t value)
+{
+    bytes.push_back(static_cast<uint8_t>(value & 0xFF));
+    bytes.push_back(static_cast<uint8_t>((value >> 8) & 0xFF));
+    bytes.push_back(static_cast<uint8_t>((value >> 16) & 0xFF));
+}
+
+void AppendUint32(Bytes &bytes, uint32_t value)
+{
+    AppendUint16(bytes, static_cast<uint16_t>(value & 0xFFFF));
+    AppendUint16(bytes, static_cast<uint16_t>(value >> 16));
+}
+
+template<typename T>
+void AppendRaw(Bytes &bytes, T value)
+{
+    uint8_t raw[sizeof(T)];
+    memcpy(raw, &value, sizeof(T));
+    bytes.insert(bytes.end(), raw, raw + sizeof(T));
+}
+
+void AppendChunk(Bytes &bytes, const char *id, const Bytes &body, uint32_t declaredSize)
+{
+    bytes.insert(bytes.end(), id, id + 4);
+    AppendUint32(bytes, declaredSize);
+    bytes.insert(bytes.end(), body.begin(), body.end());
+}
+
+void AppendChunk(Bytes &bytes, const char *id, const Bytes &body)
+{
+    AppendChunk(bytes, id, body, static_cast<uint32_t>(body.size()));
+}
+
+Bytes CreateFormat(uint16_t formatTag, uint16_t channels, uint16_t bitsPerSample)
+{
+    Bytes format;
+    uint16_t blockAlign = static_cast<uint16_t>(channels * bitsPerSample / BITS_PER_BYTE);
+    AppendUint16(format, formatTag);
+    AppendUint16(format, channels);
+    AppendUint32(format, WAVE_SAMPLE_RATE);
+    AppendUint32(format, WAVE_SAMPLE_RATE * blockAlign);
+    AppendUint16(format, blockAlign);
+    AppendUint16(format, bitsPerSample);
+    return format;
+}
+
+Bytes CreateExtensibleFormat(uint16_t subFormatTag, uint16_t channels, uint16_t bitsPerSample)
+{
+    Bytes format = CreateFormat(WAVE_FORMAT_EXTENSIBLE, channels, bitsPerSample);
+    AppendUint16(format, FMT_EXTENSION_SIZE);
+    AppendUint16(format, bitsPerSample);
+    AppendUint32(format, 0);
+    // The sub format GUID starts with the real format tag, the rest is the fixed KSDATAFORMAT suffix
+    const uint8_t guidSuffix[] = { 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x80, 0x00, 0x00, 0xAA, 0x00, 0x38, 0x9B, 0x71 };
+    AppendUint16(format, subFormatTag);
+    format.insert(format.end(), guidSuffix, guidSuffix + sizeof(guidSuffix));
+    return format;
+}
+
+Bytes CreateWave(const Bytes &chunks)
+{
+    Bytes wave;
+    const char riffId[] = "RIFF";
+    const char waveId[] = "WAVE";
+    wave.insert(wave.end(), riffId, riffId + 4);
+    AppendUint32(wave, static_cast<uint32_t>(chunks.size() + 4));
+    wave.insert(wave.end(), waveId, waveId + 4);
+    wave.insert(wave.end(), chunks.begin(), chunks.end());
+    return wave;
+}
+
+Bytes CreateWave(const Bytes &format, const Bytes &data)
+{
+    Bytes chunks;
+    AppendChunk(chunks, "fmt ", format);
+    AppendChunk(chunks, "data", data);
+    return CreateWave(chunks);
+}
+
+int32_t ParseWave(const Bytes &wave, std::vector<double> &samples)
+{
+    int32_t fd = open(WAVE_PATH.c_str(), O_RDWR | O_CREAT | O_TRUNC, S_IRUSR | S_IWUSR);
+    if (fd < 0) {
+        SEN_HILOGE("open failed");
+        return Sensors::ERROR;
+    }
+    if (write(fd, wave.data(), wave.size()) != static_cast<ssize_t>(wave.size())) {
+        SEN_HILOGE("write failed");
+        close(fd);
+        return Sensors::ERROR;
+    }
+    RawFileDescriptor rawFd;
+    rawFd.fd = fd;
+    rawFd.offset = 0;
+    rawFd.length = static_cast<int64_t>(wave.size());
+    AudioParsing audioParsing(rawFd);
+    int32_t ret = audioParsing.ParseAudioFile();
+    if (ret == Sensors::SUCCESS) {
+        AudioData audioData;
+        ret = audioParsing.GetAudioData(1, audioData);
+        samples = audioData.audioDatas;
+    }
+    close(fd);
+    return ret;
+}
+
+void ExpectSamples(const std::vector<double> &samples, const std::vector<double> &expected)
+{
+    ASSERT_EQ(samples.size(), expected.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+        EXPECT_NEAR(samples[i], expected[i], EPSILON) << "sample " << i;
+    }
+}
+} // namespace
+
+class AudioParsingTest : public testing::Test {
+public:
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp();
+    void TearDown();
+};
+
+void AudioParsingTest::SetUpTestCase() {}
+
+void AudioParsingTest::TearDownTestCase()
+{
+    unlink(WAVE_PATH.c_str());
+}
+
+void AudioParsingTest::SetUp() {}
+
+void AudioParsingTest::TearDown() {}
+
+HWTEST_F(AudioParsingTest, AudioParsingTest_001, TestSize.Level1)
+{
+    SEN_HILOGI("AudioParsingTest_001 in");
+    // 8-bit samples are unsigned around 128, both ends of the range must stay within [-1, 1)
+    Bytes data = { 0, 64, 128, 192, 255 };
+    std::vector<double> samples;
+    ASSERT_EQ(ParseWave(CreateWave(CreateFormat(WAVE_FORMAT_PCM, 1, 8), data), samples), Sensors::SUCCESS);
+    ExpectSamples(samples, { -1.0, -0.5, 0.0, 0.5, 127.0 / 128.0 });
+}
+
+HWTEST_F(AudioParsingTest, AudioParsingTest_002, TestSize.Level1)
+{
+    SEN_HILOGI("AudioParsingTest_002 in");
+    Bytes data;
+    AppendUint16(data, 0);
+    AppendUint16(data, static_cast<uint16_t>(INT16_MAX));
+    AppendUint16(data, static_cast<uint16_t>(-INT16_MAX));
+    AppendUint16(data, static_cast<uint16_t>(16384));
+    std::vector<double> samples;
+    ASSERT_EQ(ParseWave(CreateWave(CreateFormat(WAVE_FORMAT_PCM, 1, 16), data), samples), Sensors::SUCCESS);
+    ExpectSamples(samples, { 0.0, 1.0, -1.0, 16384.0 / INT16_MAX });
+}
+
+HWTEST_F(AudioParsingTest, AudioParsingTest_003, TestSize.Level1)
+{
+    SEN_HILOGI("AudioParsingTest_003 in");
+    // 24-bit samples are sign extended from the top byte
+    Bytes data;
+    AppendUint24(data, 0x000000);
+    AppendUint24(data, 0x7FFFFF);
+    AppendUint24(data, 0x800001);
+    AppendUint24(data, 0xC00000);
+    std::vector<double> samples;
+    ASSERT_EQ(ParseWave(CreateWave(CreateFormat(WAVE_FORMAT_PCM, 1, 24), data), samples), Sensors::SUCCESS);
+    ExpectSamples(samples, { 0.0, 1.0, -1.0, -4194304.0 / 8388607.0 });
+}
+
+HWTEST_F(AudioParsingTest, AudioParsingTest_004, TestSize.Level1)
+{
+    SEN_HILOGI("AudioParsingTest_004 in");
+    // Stereo frames are averaged into one sample
+    Bytes data;
+    AppendUint32(data, static_cast<uint32_t>(INT32_MAX));
+    AppendUint32(data, 0);
+    AppendUint32(data, static_cast<uint32_t>(-INT32_MAX));
+    AppendUint32(data, static_cast<uint32_t>(-INT32_MAX));
+    std::vector<double> samples;
+    ASSERT_EQ(ParseWave(CreateWave(CreateFormat(WAVE_FORMAT_PCM, 2, 32), data), samples), Sensors::SUCCESS);
+    ExpectSamples(samples, { 0.5, -1.0 });
+}
+
+HWTEST_F(AudioParsingTest, AudioParsingTest_005, TestSize.Level1)
+{
+    SEN_HILOGI("AudioParsingTest_005 in");
+    Bytes data32;
+    AppendRaw(data32, 0.25F);
+    AppendRaw(data32, -0.75F);
+    std::vector<double> samples;
+    ASSERT_EQ(ParseWave(CreateWave(CreateFormat(WAVE_FORMAT_IEEE_FLOAT, 1, 32), data32), samples), Sensors::SUCCESS);
+    ExpectSamples(samples, { 0.25, -0.75 });
+    Bytes data64;
+    AppendRaw(data64, 0.125);
+    AppendRaw(data64, -1.0);
+    samples.clear();
+    ASSERT_EQ(ParseWave(CreateWave(CreateFormat(WAVE_FORMAT_IEEE_FLOAT, 1, 64), data64), samples), Sensors::SUCCESS);
+    ExpectSamples(samples, { 0.125, -1.0 });
+}
+
+HWTEST_F(AudioParsingTest, AudioParsingTest_006, TestSize.Level1)
+{
+    SEN_HILOGI("AudioParsingTest_006 in");
+    // WAVE_FORMAT_EXTENSIBLE is decoded with the format tag of its sub format
+    Bytes dataFloat;
+    AppendRaw(dataFloat, 0.5F);
+    AppendRaw(dataFloat, -0.5F);
+    std::vector<double> samples;
+    ASSERT_EQ(ParseWave(CreateWave(CreateExtensibleFormat(WAVE_FORMAT_IEEE_FLOAT, 1, 32), dataFloat), samples),
+        Sensors::SUCCESS);
+    ExpectSamples(samples, { 0.5, -0.5 });
+    Bytes dataPcm;
+    AppendUint16(dataPcm, static_cast<uint16_t>(INT16_MAX));
+    AppendUint16(dataPcm, 0);
+    samples.clear();
+    ASSERT_EQ(ParseWave(CreateWave(CreateExtensibleFormat(WAVE_FORMAT_PCM, 2, 16), dataPcm), samples),
+        Sensors::SUCCESS);
+    ExpectSamples(samples, { 0.5 });
+}
+
+HWTEST_F(AudioParsingTest, AudioParsingTest_007, TestSize.Level1)
+{
+    SEN_HILOGI("AudioParsingTest_007 in");
+    // A data size beyond the end of the file is cut to the complete frames that are present
+    Bytes data;
+    AppendUint16(data, static_cast<uint16_t>(INT16_MAX));
+    AppendUint16(data, 0);
+    data.push_back(0x7F);
+    Bytes chunks;
+    AppendChunk(chunks, "fmt ", CreateFormat(WAVE_FORMAT_PCM, 1, 16));
+    AppendChunk(chunks, "data", data, 1024);
+    std::vector<double> samples;
+    ASSERT_EQ(ParseWave(CreateWave(chunks), samples), Sensors::SUCCESS);
+    ExpectSamples(samples, { 1.0, 0.0 });
+    // A data size of 0 is left by streamed recordings and takes the rest of the file
+    chunks.clear();
+    AppendChunk(chunks, "fmt ", CreateFormat(WAVE_FORMAT_PCM, 1, 16));
+    AppendChunk(chunks, "data", data, 0);
+    samples.clear();
+    ASSERT_EQ(ParseWave(CreateWave(chunks), samples), Sensors::SUCCESS);
+    ExpectSamples(samples, { 1.0, 0.0 });
+    // Odd sized chunks before the data are skipped together with their pad byte
+    chunks.clear();
+    AppendChunk(chunks, "fmt ", CreateFormat(WAVE_FORMAT_PCM, 1, 16));
+    AppendChunk(chunks, "LIST", { 'a', 'b', 'c', 0 }, 3);
+    AppendChunk(chunks, "data", { 0xFF, 0x7F });
+    samples.clear();
+    ASSERT_EQ(ParseWave(CreateWave(chunks), samples), Sensors::SUCCESS);
+    ExpectSamples(samples, { 1.0 });
+    // A file cut inside the RIFF header is rejected
+    Bytes wave = CreateWave(CreateFormat(WAVE_FORMAT_PCM, 1, 16), data);
+    wave.resize(10);
+    EXPECT_NE(ParseWave(wave, samples), Sensors::SUCCESS);
+    // A file cut inside the fmt chunk has no data chunk
+    wave = CreateWave(CreateFormat(WAVE_FORMAT_PCM, 1, 16), data);
+    wave.resize(24);
+    EXPECT_EQ(ParseWave(wave, samples), Sensors::PARAMETER_ERROR);
+    // A data chunk shorter than one frame holds no audio
+    EXPECT_NE(ParseWave(CreateWave(CreateFormat(WAVE_FORMAT_PCM, 2, 16), { 0x01, 0x02 }), samples),
+        Sensors::SUCCESS);
+}
+
+HWTEST_F(AudioParsingTest, AudioParsingTest_008, TestSize.Level1)
+{
+    SEN_HILOGI("AudioParsingTest_008 in");
+    std::vector<double> samples;
+    Bytes data = { 0x00, 0x00 };
+    Bytes wave = CreateWave(CreateFormat(WAVE_FORMAT_PCM, 1, 16), data);
+    // Not a RIFF WAVE file
+    Bytes notRiff = wave;
+    notRiff[0] = 'X';
+    EXPECT_EQ(ParseWave(notRiff, samples), Sensors::PARAMETER_ERROR);
+    Bytes notWave = wave;
+    notWave[8] = 'X';
+    EXPECT_EQ(ParseWave(notWave, samples), Sensors::PARAMETER_ERROR);
+    // The data chunk comes before the fmt chunk
+    Bytes chunks;
+    AppendChunk(chunks, "data", data);
+    AppendChunk(chunks, "fmt ", CreateFormat(WAVE_FORMAT_PCM, 1, 16));
+    EXPECT_EQ(ParseWave(CreateWave(chunks), samples), Sensors::PARAMETER_ERROR);
+    // The fmt chunk is too short to hold the mandatory fields
+    Bytes shortFormat = CreateFormat(WAVE_FORMAT_PCM, 1, 16);
+    shortFormat.resize(FMT_CHUNK_SIZE - 2);
+    EXPECT_EQ(ParseWave(CreateWave(shortFormat, data), samples), Sensors::PARAMETER_ERROR);
+    // No channels or no bits per sample
+    EXPECT_EQ(ParseWave(CreateWave(CreateFormat(WAVE_FORMAT_PCM, 0, 16), data), samples), Sensors::PARAMETER_ERROR);
+    EXPECT_EQ(ParseWave(CreateWave(CreateFormat(WAVE_FORMAT_PCM, 1, 0), data), samples), Sensors::PARAMETER_ERROR);
+    // Formats that have no decoder
+    EXPECT_EQ(ParseWave(CreateWave(CreateFormat(WAVE_FORMAT_PCM, 1, 12), data), samples), Sensors::PARAMETER_ERROR);
+    EXPECT_EQ(ParseWave(CreateWave(CreateFormat(WAVE_FORMAT_IEEE_FLOAT, 1, 16), data), samples),
+        Sensors::PARAMETER_ERROR);
+    EXPECT_EQ(ParseWave(CreateWave(CreateExtensibleFormat(0x0002, 1, 16), data), samples), Sensors::PARAMETER_ERROR);
+    // A chunk that claims more bytes than the file holds hides the data chunk behind it
+    chunks.clear();
+    AppendChunk(chunks, "fmt ", CreateFormat(WAVE_FORMAT_PCM, 1, 16));
+    AppendChunk(chunks, "LIST", { 0x00, 0x00 }, 0x7FFFFFFF);
+    AppendChunk(chunks, "data", data);
+    EXPECT_EQ(ParseWave(CreateWave(chunks), samples), Sensors::PARAMETER_ERROR);
+}
+} // namespace Sensors
+} // namespace OHOS
@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cmath>
+#include <type_traits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "conversion_fft.h"
+#include "sensor_log.h"
+#include "sensors_errors.h"
+#include "utils.h"
+#include "vibration_convert_type.h"
+
+#undef LOG_TAG
+#define LOG_TAG "ConversionFFTTest"
+
+namespace OHOS {
+namespace Sensors {
+using namespace testing::ext;
+using namespace OHOS::HiviewDFX;
+
+namespace {
+constexpr int32_t TEST_SAMPLE_RATE = 44100;
+constexpr int32_t TEST_FFT_SIZE = 64;
+constexpr int32_t TEST_HOP_SIZE = 16;
+constexpr size_t TEST_SAMPLE_COUNT = 1000;
+
+FFTInputPara CreatePara(int32_t windowSize)
+{
+    FFTInputPara para;
+    para.sampleRate = TEST_SAMPLE_RATE;
+    para.fftSize = TEST_FFT_SIZE;
+    para.hopSize = TEST_HOP_SIZE;
+    para.windowSize = windowSize;
+    return para;
+}
+
+std::vector<double> CreateSignal(size_t count)
+{
+    std::vector<double> signal(count);
+    for (size_t i = 0; i < count; ++i) {
+        signal[i] = 0.6 * sin(0.05 * i) + 0.3 * sin(0.71 * i + 1.0);
+    }
+    return signal;
+}
+} // namespace
+
+class ConversionFFTTest : public testing::Test {
+public:
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp();
+    void TearDown();
+};
+
+void ConversionFFTTest::SetUpTestCase() {}
+
+void ConversionFFTTest::TearDownTestCase() {}
+
+void ConversionFFTTest::SetUp() {}
+
+void ConversionFFTTest::TearDown() {}
+
+HWTEST_F(ConversionFFTTest, ConversionFFTTest_001, TestSize.Level1)
+{
+    SEN_HILOGI("ConversionFFTTest_001 in");
+    // A window larger than the FFT does not fit the ring of fftSize samples, framing is refused instead of
+    // reading past it
+    ConversionFFT conversionFFT;
+    ASSERT_EQ(conversionFFT.Init(CreatePara(TEST_FFT_SIZE * 2)), Sensors::SUCCESS);
+    int32_t frameCount = -1;
+    std::vector<float> frameMagsArr;
+    EXPECT_EQ(conversionFFT.Process(CreateSignal(TEST_SAMPLE_COUNT), frameCount, frameMagsArr),
+        Sensors::PARAMETER_ERROR);
+    EXPECT_EQ(frameCount, 0);
+    EXPECT_TRUE(frameMagsArr.empty());
+    for (int32_t i = 0; i < TEST_FFT_SIZE; ++i) {
+        EXPECT_FALSE(conversionFFT.ProcessSingle(0.5F));
+    }
+}
+
+HWTEST_F(ConversionFFTTest, ConversionFFTTest_002, TestSize.Level1)
+{
+    SEN_HILOGI("ConversionFFTTest_002 in");
+    // Frames read in place by Process match the frames of the ring of ProcessSingle, also across calls
+    std::vector<double> signal = CreateSignal(TEST_SAMPLE_COUNT);
+    ConversionFFT single;
+    ASSERT_EQ(single.Init(CreatePara(TEST_FFT_SIZE)), Sensors::SUCCESS);
+    std::vector<float> expected;
+    for (double sample : signal) {
+        if (single.ProcessSingle(static_cast<float>(sample))) {
+            std::vector<float> magnitudes = single.GetMagnitudes();
+            expected.insert(expected.end(), magnitudes.begin(), magnitudes.end());
+        }
+    }
+    ConversionFFT batch;
+    ASSERT_EQ(batch.Init(CreatePara(TEST_FFT_SIZE)), Sensors::SUCCESS);
+    size_t split = TEST_HOP_SIZE * 7;
+    std::vector<double> head(signal.begin(), signal.begin() + split);
+    std::vector<double> tail(signal.begin() + split, signal.end());
+    int32_t headFrames = 0;
+    int32_t tailFrames = 0;
+    std::vector<float> frameMagsArr;
+    ASSERT_EQ(batch.Process(head, headFrames, frameMagsArr), Sensors::SUCCESS);
+    ASSERT_EQ(batch.Process(tail, tailFrames, frameMagsArr), Sensors::SUCCESS);
+    EXPECT_EQ(headFrames + tailFrames, static_cast<int32_t>(TEST_SAMPLE_COUNT / TEST_HOP_SIZE));
+    ASSERT_EQ(frameMagsArr.size(), expected.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+        EXPECT_NEAR(frameMagsArr[i], expected[i], 1e-5F * (1.0F + std::fabs(expected[i]))) << "index " << i;
+    }
+}
+
+HWTEST_F(ConversionFFTTest, ConversionFFTTest_003, TestSize.Level1)
+{
+    SEN_HILOGI("ConversionFFTTest_003 in");
+#ifdef VIBRATION_CONVERT_SINGLE_PRECISION
+    EXPECT_TRUE((std::is_same<AudioSample, float>::value));
+#else
+    EXPECT_TRUE((std::is_same<AudioSample, double>::value));
+#endif // VIBRATION_CONVERT_SINGLE_PRECISION
+    // The single-precision samples are framed exactly like the same values passed as double
+    std::vector<double> signal = CreateSignal(TEST_SAMPLE_COUNT);
+    std::vector<float> floatSignal(signal.begin(), signal.end());
+    std::vector<double> widenedSignal(floatSignal.begin(), floatSignal.end());
+    ConversionFFT doubleFFT;
+    ASSERT_EQ(doubleFFT.Init(CreatePara(TEST_FFT_SIZE)), Sensors::SUCCESS);
+    int32_t doubleFrames = 0;
+    std::vector<float> doubleMagsArr;
+    ASSERT_EQ(doubleFFT.Process(widenedSignal, doubleFrames, doubleMagsArr), Sensors::SUCCESS);
+    ConversionFFT floatFFT;
+    ASSERT_EQ(floatFFT.Init(CreatePara(TEST_FFT_SIZE)), Sensors::SUCCESS);
+    int32_t floatFrames = 0;
+    std::vector<float> floatMagsArr;
+    ASSERT_EQ(floatFFT.Process(floatSignal, floatFrames, floatMagsArr), Sensors::SUCCESS);
+    EXPECT_EQ(floatFrames, doubleFrames);
+    EXPECT_EQ(floatMagsArr, doubleMagsArr);
+}
+} // namespace Sensors
+} // namespace OHOS
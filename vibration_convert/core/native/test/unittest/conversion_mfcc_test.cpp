@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cmath>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "conversion_mfcc.h"
+#include "sensor_log.h"
+#include "sensors_errors.h"
+#include "vibration_convert_type.h"
+
+#undef LOG_TAG
+#define LOG_TAG "ConversionMfccTest"
+
+namespace OHOS {
+namespace Sensors {
+using namespace testing::ext;
+using namespace OHOS::HiviewDFX;
+
+namespace {
+constexpr uint32_t TEST_NUM_BINS = 512;
+constexpr uint32_t TEST_NUM_COEFFS = 13;
+constexpr int32_t TEST_MEL_COUNT = 40;
+constexpr int32_t TEST_FRAME_COUNT = 3;
+constexpr double TEST_BAND_MIN = 0.000001;
+
+MfccInputPara CreatePara()
+{
+    MfccInputPara para;
+    para.sampleRate = 44100;
+    para.nMels = TEST_MEL_COUNT;
+    para.minFreq = 0.0;
+    para.maxFreq = 8000.0;
+    return para;
+}
+
+std::vector<float> CreateSpectrum(size_t count, float phase)
+{
+    std::vector<float> spectrum(count);
+    for (size_t i = 0; i < count; ++i) {
+        spectrum[i] = 1.0F + 0.5F * std::sin(0.01F * i + phase);
+    }
+    return spectrum;
+}
+} // namespace
+
+class ConversionMfccTest : public testing::Test {
+public:
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp();
+    void TearDown();
+};
+
+void ConversionMfccTest::SetUpTestCase() {}
+
+void ConversionMfccTest::TearDownTestCase() {}
+
+void ConversionMfccTest::SetUp() {}
+
+void ConversionMfccTest::TearDown() {}
+
+HWTEST_F(ConversionMfccTest, ConversionMfccTest_001, TestSize.Level1)
+{
+    SEN_HILOGI("ConversionMfccTest_001 in");
+    // Every filter is a triangle: no negative weights, and the non-zero weights form one contiguous run
+    ConversionMfcc conversionMfcc;
+    ASSERT_EQ(conversionMfcc.Init(TEST_NUM_BINS, TEST_NUM_COEFFS, CreatePara()), Sensors::SUCCESS);
+    std::vector<double> melFilterBank = conversionMfcc.GetMelFilterBank();
+    ASSERT_EQ(melFilterBank.size(), static_cast<size_t>(TEST_MEL_COUNT) * TEST_NUM_BINS);
+    size_t nonZeroCount = 0;
+    for (int32_t filter = 0; filter < TEST_MEL_COUNT; ++filter) {
+        int32_t runs = 0;
+        bool isInRun = false;
+        for (uint32_t bin = 0; bin < TEST_NUM_BINS; ++bin) {
+            double weight = melFilterBank[filter + bin * TEST_MEL_COUNT];
+            EXPECT_GE(weight, 0.0) << "filter " << filter << ", bin " << bin;
+            bool isNonZero = (weight > 0.0);
+            if (isNonZero && !isInRun) {
+                ++runs;
+            }
+            isInRun = isNonZero;
+            nonZeroCount += isNonZero ? 1 : 0;
+        }
+        EXPECT_EQ(runs, 1) << "filter " << filter;
+    }
+    // Filters up to 8 kHz cover only the lower part of the 512 bins up to the Nyquist frequency
+    EXPECT_LT(nonZeroCount, static_cast<size_t>(TEST_NUM_BINS) * 2);
+}
+
+HWTEST_F(ConversionMfccTest, ConversionMfccTest_002, TestSize.Level1)
+{
+    SEN_HILOGI("ConversionMfccTest_002 in");
+    ConversionMfcc conversionMfcc;
+    ASSERT_EQ(conversionMfcc.Init(TEST_NUM_BINS, TEST_NUM_COEFFS, CreatePara()), Sensors::SUCCESS);
+    // A spectrum shorter than numBins is rejected instead of read out of bounds
+    EXPECT_TRUE(conversionMfcc.Mfcc(CreateSpectrum(TEST_NUM_BINS - 1, 0.0F)).empty());
+    std::vector<float> spectrum = CreateSpectrum(TEST_NUM_BINS, 0.0F);
+    std::vector<double> mfcc = conversionMfcc.Mfcc(spectrum);
+    ASSERT_EQ(mfcc.size(), static_cast<size_t>(TEST_NUM_COEFFS));
+    // The sparse filters give the coefficients of the dense filterbank
+    std::vector<double> melFilterBank = conversionMfcc.GetMelFilterBank();
+    std::vector<double> melBands(TEST_MEL_COUNT, 0.0);
+    for (int32_t filter = 0; filter < TEST_MEL_COUNT; ++filter) {
+        double band = 0.0;
+        for (uint32_t bin = 0; bin < TEST_NUM_BINS; ++bin) {
+            band += melFilterBank[filter + bin * TEST_MEL_COUNT] * spectrum[bin];
+        }
+        melBands[filter] = (band > TEST_BAND_MIN) ? std::log(band * band) : 0.0;
+    }
+    for (uint32_t i = 0; i < TEST_NUM_COEFFS; ++i) {
+        double scale = (i == 0) ? std::sqrt(1.0 / TEST_MEL_COUNT) : std::sqrt(2.0 / TEST_MEL_COUNT);
+        double expected = 0.0;
+        for (int32_t j = 0; j < TEST_MEL_COUNT; ++j) {
+            expected += scale * std::cos(M_PI / TEST_MEL_COUNT * (i + 1) * (j + 0.5)) * melBands[j];
+        }
+        expected /= TEST_NUM_COEFFS;
+        EXPECT_NEAR(mfcc[i], expected, 1e-9) << "coefficient " << i;
+    }
+}
+
+HWTEST_F(ConversionMfccTest, ConversionMfccTest_003, TestSize.Level1)
+{
+    SEN_HILOGI("ConversionMfccTest_003 in");
+    ConversionMfcc conversionMfcc;
+    ASSERT_EQ(conversionMfcc.Init(TEST_NUM_BINS, TEST_NUM_COEFFS, CreatePara()), Sensors::SUCCESS);
+    std::vector<float> frameSpectra;
+    std::vector<double> expected;
+    for (int32_t frame = 0; frame < TEST_FRAME_COUNT; ++frame) {
+        std::vector<float> spectrum = CreateSpectrum(TEST_NUM_BINS, static_cast<float>(frame));
+        frameSpectra.insert(frameSpectra.end(), spectrum.begin(), spectrum.end());
+        std::vector<double> mfcc = conversionMfcc.Mfcc(spectrum);
+        expected.insert(expected.end(), mfcc.begin(), mfcc.end());
+    }
+    std::vector<double> frameMfccs;
+    ASSERT_EQ(conversionMfcc.MfccFrames(frameSpectra, TEST_FRAME_COUNT, frameMfccs), Sensors::SUCCESS);
+    EXPECT_EQ(frameMfccs, expected);
+    // Frames shorter than numBins are rejected
+    frameSpectra.pop_back();
+    EXPECT_EQ(conversionMfcc.MfccFrames(frameSpectra, TEST_FRAME_COUNT, frameMfccs), Sensors::PARAMETER_ERROR);
+    EXPECT_EQ(conversionMfcc.MfccFrames(frameSpectra, 0, frameMfccs), Sensors::PARAMETER_ERROR);
+}
+} // namespace Sensors
+} // namespace OHOS
@@ -0,0 +1,197 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cmath>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "fft.h"
+#include "sensor_log.h"
+#include "sensors_errors.h"
+#include "vibration_convert_type.h"
+
+#undef LOG_TAG
+#define LOG_TAG "FftTest"
+
+namespace OHOS {
+namespace Sensors {
+using namespace testing::ext;
+using namespace OHOS::HiviewDFX;
+
+namespace {
+constexpr uint32_t RANDOM_SEED = 20260101;
+constexpr double TWO_PI = 2.0 * M_PI;
+// Relative to the largest bin, float rounding in log2(fftSize) stages stays well below this
+constexpr double TOLERANCE = 1e-5;
+// From the smallest plan, through the sizes of the scalar stages, to the sizes that run the SIMD butterflies
+const std::vector<int32_t> FFT_SIZES = { 2, 4, 8, 16, 32, 64, 256, 1024, 4096 };
+
+std::vector<float> CreateSignal(int32_t size, uint32_t seed)
+{
+    std::mt19937 engine(seed);
+    std::uniform_real_distribution<float> distribution(-1.0F, 1.0F);
+    std::vector<float> signal(size);
+    for (auto &sample : signal) {
+        sample = distribution(engine);
+    }
+    return signal;
+}
+
+void DirectDft(const std::vector<float> &data, const std::vector<float> &window, std::vector<double> &real,
+    std::vector<double> &imag)
+{
+    size_t size = data.size();
+    real.assign(size, 0.0);
+    imag.assign(size, 0.0);
+    for (size_t k = 0; k < size; ++k) {
+        for (size_t n = 0; n < size; ++n) {
+            double angle = -TWO_PI * static_cast<double>((k * n) % size) / size;
+            double sample = static_cast<double>(data[n]) * window[n];
+            real[k] += sample * cos(angle);
+            imag[k] += sample * sin(angle);
+        }
+    }
+}
+
+double MaxAbs(const std::vector<double> &real, const std::vector<double> &imag)
+{
+    double maxAbs = 1.0;
+    for (size_t i = 0; i < real.size(); ++i) {
+        maxAbs = std::max(maxAbs, std::hypot(real[i], imag[i]));
+    }
+    return maxAbs;
+}
+} // namespace
+
+class FftTest : public testing::Test {
+public:
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp();
+    void TearDown();
+};
+
+void FftTest::SetUpTestCase() {}
+
+void FftTest::TearDownTestCase() {}
+
+void FftTest::SetUp() {}
+
+void FftTest::TearDown() {}
+
+HWTEST_F(FftTest, FftTest_001, TestSize.Level1)
+{
+    SEN_HILOGI("FftTest_001 in");
+    for (int32_t fftSize : FFT_SIZES) {
+        SCOPED_TRACE("fftSize:" + std::to_string(fftSize));
+        Fft fft;
+        fft.Init(fftSize);
+        std::vector<float> window;
+        ASSERT_EQ(fft.GenWindow(WND_TYPE_HANNING, fftSize, window), Sensors::SUCCESS);
+        std::vector<float> data = CreateSignal(fftSize, RANDOM_SEED + fftSize);
+        fft.CalcFFT(data, window);
+        std::vector<double> real;
+        std::vector<double> imag;
+        DirectDft(data, window, real, imag);
+        double tolerance = TOLERANCE * MaxAbs(real, imag);
+        const std::vector<float> &fftReal = fft.GetReal();
+        const std::vector<float> &fftImag = fft.GetImg();
+        ASSERT_EQ(fftReal.size(), static_cast<size_t>(fftSize));
+        ASSERT_EQ(fftImag.size(), static_cast<size_t>(fftSize));
+        for (int32_t k = 0; k < fftSize; ++k) {
+            EXPECT_NEAR(fftReal[k], real[k], tolerance) << "bin " << k;
+            EXPECT_NEAR(fftImag[k], imag[k], tolerance) << "bin " << k;
+        }
+    }
+}
+
+HWTEST_F(FftTest, FftTest_002, TestSize.Level1)
+{
+    SEN_HILOGI("FftTest_002 in");
+    // A frame split anywhere in a circular buffer must give exactly the spectrum of the contiguous frame
+    for (int32_t fftSize : { 2, 8, 64, 1024 }) {
+        Fft fft;
+        fft.Init(fftSize);
+        std::vector<float> window;
+        ASSERT_EQ(fft.GenWindow(WND_TYPE_HAMMING, fftSize, window), Sensors::SUCCESS);
+        std::vector<float> data = CreateSignal(fftSize, RANDOM_SEED - fftSize);
+        fft.CalcFFT(data, window);
+        std::vector<float> expectedReal = fft.GetReal();
+        std::vector<float> expectedImag = fft.GetImg();
+        for (int32_t firstCount : { 1, fftSize / 2 - 1, fftSize / 2, fftSize / 2 + 1, fftSize - 1, fftSize }) {
+            if (firstCount <= 0) {
+                continue;
+            }
+            SCOPED_TRACE("fftSize:" + std::to_string(fftSize) + ", firstCount:" + std::to_string(firstCount));
+            std::vector<float> first(data.begin(), data.begin() + firstCount);
+            std::vector<float> second(data.begin() + firstCount, data.end());
+            fft.CalcFFT(first.data(), firstCount, second.empty() ? nullptr : second.data(), window);
+            EXPECT_EQ(fft.GetReal(), expectedReal);
+            EXPECT_EQ(fft.GetImg(), expectedImag);
+        }
+    }
+}
+
+HWTEST_F(FftTest, FftTest_003, TestSize.Level1)
+{
+    SEN_HILOGI("FftTest_003 in");
+    // The inverse of a one-sided spectrum is the real part of the normalized inverse DFT of its bins below half
+    for (int32_t fftSize : FFT_SIZES) {
+        SCOPED_TRACE("fftSize:" + std::to_string(fftSize));
+        int32_t half = fftSize / 2;
+        Fft fft;
+        fft.Init(fftSize);
+        std::vector<float> window(fftSize, 1.0F);
+        std::vector<float> real = CreateSignal(half, RANDOM_SEED + half);
+        std::vector<float> imag = CreateSignal(half, RANDOM_SEED - half);
+        std::vector<float> output;
+        fft.InverseFFTComplex(window, real, imag, output);
+        ASSERT_EQ(output.size(), static_cast<size_t>(fftSize));
+        for (int32_t n = 0; n < fftSize; ++n) {
+            double expected = 0.0;
+            for (int32_t k = 0; k < half; ++k) {
+                double angle = TWO_PI * static_cast<double>((static_cast<int64_t>(k) * n) % fftSize) / fftSize;
+                expected += real[k] * cos(angle) - imag[k] * sin(angle);
+            }
+            expected /= fftSize;
+            EXPECT_NEAR(output[n], expected, TOLERANCE) << "sample " << n;
+        }
+    }
+}
+
+HWTEST_F(FftTest, FftTest_004, TestSize.Level1)
+{
+    SEN_HILOGI("FftTest_004 in");
+    Fft fft;
+    fft.Init(64);
+    std::vector<float> window(64, 1.0F);
+    std::vector<float> data = CreateSignal(64, RANDOM_SEED);
+    fft.CalcFFT(data, window);
+    std::vector<float> expectedReal = fft.GetReal();
+    // A split frame without its second part, or a window shorter than the frame, leaves the spectrum untouched
+    std::vector<float> other = CreateSignal(64, RANDOM_SEED + 1);
+    fft.CalcFFT(other.data(), 32, nullptr, window);
+    EXPECT_EQ(fft.GetReal(), expectedReal);
+    std::vector<float> shortWindow(32, 1.0F);
+    fft.CalcFFT(other.data(), 64, nullptr, shortWindow);
+    EXPECT_EQ(fft.GetReal(), expectedReal);
+    fft.CalcFFT(other.data(), 0, other.data(), window);
+    EXPECT_EQ(fft.GetReal(), expectedReal);
+}
+} // namespace Sensors
+} // namespace OHOS
@@ -97,7 +97,7 @@ HWTEST_F(GenerateJsonFileTest, GenerateJsonFileTest_002, TestSize.Level1)
     audioSetting.frequencyTreshold = 50;
     audioSetting.frequencyMaxValue = 80;
     audioSetting.frequencyMinValue = 20;
-    std::vector<double> data = AudioSrcDatas;
+    std::vector<AudioSample> data(AudioSrcDatas.begin(), AudioSrcDatas.end());
     std::vector<HapticEvent> vtEvents = {};
     VibrationConvertCore vibrationConvertCore;
     int32_t ret = vibrationConvertCore.ConvertAudioToHaptic(audioSetting, data, vtEvents);
@@ -0,0 +1,268 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <string>
+#include <vector>
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+
+#include "haptic_event_cache.h"
+#include "sensor_log.h"
+#include "sensors_errors.h"
+#include "vibration_convert_type.h"
+
+#undef LOG_TAG
+#define LOG_TAG "HapticEventCacheTest"
+
+namespace OHOS {
+namespace Sensors {
+using namespace testing::ext;
+using namespace OHOS::HiviewDFX;
+
+namespace {
+const std::string CACHE_DIR = "/data/local/tmp/haptic_event_cache_test";
+constexpr int64_t CACHE_SIZE_MAX = 1024 * 1024;
+constexpr uint32_t ALGORITHM_VERSION = 1;
+constexpr time_t OLD_MTIME = 1000;
+constexpr time_t NEW_MTIME = 2000;
+
+std::vector<std::string> ListEntries()
+{
+    std::vector<std::string> names;
+    DIR *dir = opendir(CACHE_DIR.c_str());
+    if (dir == nullptr) {
+        return names;
+    }
+    for (struct dirent *entry = readdir(dir); entry != nullptr; entry = readdir(dir)) {
+        std::string name = entry->d_name;
+        if ((name != ".") && (name != "..")) {
+            names.push_back(CACHE_DIR + "/" + name);
+        }
+    }
+    closedir(dir);
+    return names;
+}
+
+void ClearEntries()
+{
+    for (const auto &path : ListEntries()) {
+        unlink(path.c_str());
+    }
+}
+
+void SetModifyTime(const std::string &path, time_t seconds)
+{
+    struct timespec times[2] = { { seconds, 0 }, { seconds, 0 } };
+    utimensat(AT_FDCWD, path.c_str(), times, 0);
+}
+
+HapticCacheKey CreateKey(uint64_t contentHash)
+{
+    HapticCacheKey key;
+    key.contentHash = contentHash;
+    key.sampleCount = 4096;
+    key.audioSetting.transientDetection = 30;
+    key.audioSetting.intensityTreshold = 30;
+    key.audioSetting.frequencyTreshold = 50;
+    key.audioSetting.frequencyMaxValue = 80;
+    key.audioSetting.frequencyMinValue = 20;
+    key.algorithmVersion = ALGORITHM_VERSION;
+    return key;
+}
+
+std::vector<HapticEvent> CreateEvents()
+{
+    HapticEvent transient = { .vibrateTag = EVENT_TAG_TRANSIENT, .startTime = 10, .duration = 48,
+        .intensity = 90, .frequency = 100 };
+    HapticEvent continuous = { .vibrateTag = EVENT_TAG_CONTINUOUS, .startTime = 1200, .duration = 3000,
+        .intensity = 45, .frequency = -20 };
+    HapticEvent late = { .vibrateTag = EVENT_TAG_TRANSIENT, .startTime = INT32_MAX, .duration = 0,
+        .intensity = 0, .frequency = INT32_MIN };
+    return { transient, continuous, late };
+}
+
+bool IsSameEvents(const std::vector<HapticEvent> &left, const std::vector<HapticEvent> &right)
+{
+    if (left.size() != right.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < left.size(); ++i) {
+        if ((left[i].vibrateTag != right[i].vibrateTag) || (left[i].startTime != right[i].startTime) ||
+            (left[i].duration != right[i].duration) || (left[i].intensity != right[i].intensity) ||
+            (left[i].frequency != right[i].frequency)) {
+            return false;
+        }
+    }
+    return true;
+}
+} // namespace
+
+class HapticEventCacheTest : public testing::Test {
+public:
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp();
+    void TearDown();
+};
+
+void HapticEventCacheTest::SetUpTestCase()
+{
+    mkdir(CACHE_DIR.c_str(), S_IRWXU);
+}
+
+void HapticEventCacheTest::TearDownTestCase()
+{
+    ClearEntries();
+    rmdir(CACHE_DIR.c_str());
+}
+
+void HapticEventCacheTest::SetUp()
+{
+    ClearEntries();
+    HapticEventCache::GetInstance().SetCacheConfig(CACHE_DIR, CACHE_SIZE_MAX);
+}
+
+void HapticEventCacheTest::TearDown()
+{
+    HapticEventCache::GetInstance().SetCacheConfig("", 0);
+}
+
+HWTEST_F(HapticEventCacheTest, HapticEventCacheTest_001, TestSize.Level1)
+{
+    HapticEventCache &cache = HapticEventCache::GetInstance();
+    EXPECT_EQ(cache.SetCacheConfig(CACHE_DIR, 0), PARAMETER_ERROR);
+    EXPECT_EQ(cache.SetCacheConfig(CACHE_DIR + "/missing", CACHE_SIZE_MAX), PARAMETER_ERROR);
+    EXPECT_TRUE(cache.IsEnabled());
+    EXPECT_EQ(cache.SetCacheConfig("", 0), Sensors::SUCCESS);
+    EXPECT_FALSE(cache.IsEnabled());
+    std::vector<HapticEvent> events;
+    EXPECT_NE(cache.Store(CreateKey(1), CreateEvents()), Sensors::SUCCESS);
+    EXPECT_NE(cache.Load(CreateKey(1), events), Sensors::SUCCESS);
+}
+
+HWTEST_F(HapticEventCacheTest, HapticEventCacheTest_002, TestSize.Level1)
+{
+    HapticEventCache &cache = HapticEventCache::GetInstance();
+    std::vector<HapticEvent> events;
+    EXPECT_NE(cache.Load(CreateKey(1), events), Sensors::SUCCESS);
+    ASSERT_EQ(cache.Store(CreateKey(1), CreateEvents()), Sensors::SUCCESS);
+    ASSERT_EQ(cache.Load(CreateKey(1), events), Sensors::SUCCESS);
+    EXPECT_TRUE(IsSameEvents(events, CreateEvents()));
+    ASSERT_EQ(cache.Store(CreateKey(2), {}), Sensors::SUCCESS);
+    ASSERT_EQ(cache.Load(CreateKey(2), events), Sensors::SUCCESS);
+    EXPECT_TRUE(events.empty());
+}
+
+HWTEST_F(HapticEventCacheTest, HapticEventCacheTest_003, TestSize.Level1)
+{
+    HapticEventCache &cache = HapticEventCache::GetInstance();
+    ASSERT_EQ(cache.Store(CreateKey(1), CreateEvents()), Sensors::SUCCESS);
+    std::vector<HapticEvent> events;
+    HapticCacheKey key = CreateKey(1);
+    key.audioSetting.intensityTreshold = 60;
+    EXPECT_NE(cache.Load(key, events), Sensors::SUCCESS);
+    key = CreateKey(1);
+    key.sampleCount = 8192;
+    EXPECT_NE(cache.Load(key, events), Sensors::SUCCESS);
+    key = CreateKey(1);
+    key.algorithmVersion = ALGORITHM_VERSION + 1;
+    EXPECT_NE(cache.Load(key, events), Sensors::SUCCESS);
+    EXPECT_EQ(cache.Load(CreateKey(1), events), Sensors::SUCCESS);
+}
+
+HWTEST_F(HapticEventCacheTest, HapticEventCacheTest_004, TestSize.Level1)
+{
+    HapticEventCache &cache = HapticEventCache::GetInstance();
+    ASSERT_EQ(cache.Store(CreateKey(1), CreateEvents()), Sensors::SUCCESS);
+    std::vector<std::string> entries = ListEntries();
+    ASSERT_EQ(entries.size(), 1);
+    int32_t fd = open(entries[0].c_str(), O_RDWR);
+    ASSERT_GE(fd, 0);
+    uint8_t byte = 0;
+    off_t offset = static_cast<off_t>(sizeof(HapticCacheHeader)) + 1;
+    ASSERT_EQ(pread(fd, &byte, sizeof(byte), offset), sizeof(byte));
+    byte ^= 0xFF;
+    ASSERT_EQ(pwrite(fd, &byte, sizeof(byte), offset), sizeof(byte));
+    close(fd);
+    std::vector<HapticEvent> events;
+    EXPECT_NE(cache.Load(CreateKey(1), events), Sensors::SUCCESS);
+    EXPECT_TRUE(ListEntries().empty());
+    ASSERT_EQ(cache.Store(CreateKey(1), CreateEvents()), Sensors::SUCCESS);
+    entries = ListEntries();
+    ASSERT_EQ(entries.size(), 1);
+    ASSERT_EQ(truncate(entries[0].c_str(), sizeof(HapticCacheHeader) - 1), 0);
+    EXPECT_NE(cache.Load(CreateKey(1), events), Sensors::SUCCESS);
+    EXPECT_TRUE(ListEntries().empty());
+}
+
+HWTEST_F(HapticEventCacheTest, HapticEventCacheTest_005, TestSize.Level1)
+{
+    HapticEventCache &cache = HapticEventCache::GetInstance();
+    ASSERT_EQ(cache.Store(CreateKey(1), CreateEvents()), Sensors::SUCCESS);
+    std::string first = ListEntries()[0];
+    ASSERT_EQ(cache.Store(CreateKey(2), CreateEvents()), Sensors::SUCCESS);
+    std::string second = (ListEntries()[0] == first) ? ListEntries()[1] : ListEntries()[0];
+    SetModifyTime(first, OLD_MTIME);
+    SetModifyTime(second, NEW_MTIME);
+    struct stat entryStat = {};
+    ASSERT_EQ(stat(first.c_str(), &entryStat), 0);
+    // Room for two entries, the hit on the first one leaves the second one as the least recently used
+    ASSERT_EQ(cache.SetCacheConfig(CACHE_DIR, entryStat.st_size * 2 + entryStat.st_size / 2), Sensors::SUCCESS);
+    std::vector<HapticEvent> events;
+    ASSERT_EQ(cache.Load(CreateKey(1), events), Sensors::SUCCESS);
+    ASSERT_EQ(cache.Store(CreateKey(3), CreateEvents()), Sensors::SUCCESS);
+    EXPECT_EQ(ListEntries().size(), 2);
+    EXPECT_EQ(cache.Load(CreateKey(1), events), Sensors::SUCCESS);
+    EXPECT_NE(cache.Load(CreateKey(2), events), Sensors::SUCCESS);
+    EXPECT_EQ(cache.Load(CreateKey(3), events), Sensors::SUCCESS);
+}
+
+HWTEST_F(HapticEventCacheTest, HapticEventCacheTest_006, TestSize.Level1)
+{
+    std::vector<AudioSample> samples = { 0.5, -0.25, 0.125, 0.0, 1.0 };
+    uint64_t hash = HapticEventCache::HashSamples(samples);
+    EXPECT_EQ(hash, HapticEventCache::HashSamples(samples));
+    std::vector<AudioSample> changed = samples;
+    changed.back() = -1.0;
+    EXPECT_NE(hash, HapticEventCache::HashSamples(changed));
+    samples.pop_back();
+    EXPECT_NE(hash, HapticEventCache::HashSamples(samples));
+}
+
+HWTEST_F(HapticEventCacheTest, HapticEventCacheTest_007, TestSize.Level1)
+{
+    // Temp files left by a crashed writer are removed, the one of a writer that may still be running is kept
+    std::string staleTemp = CACHE_DIR + "/0000000000000001.hec.a1B2c3";
+    std::string freshTemp = CACHE_DIR + "/0000000000000002.hec.d4E5f6";
+    std::string otherFile = CACHE_DIR + "/0000000000000003.txt";
+    for (const auto &path : { staleTemp, freshTemp, otherFile }) {
+        int32_t fd = open(path.c_str(), O_CREAT | O_WRONLY, S_IRUSR | S_IWUSR);
+        ASSERT_GE(fd, 0);
+        close(fd);
+    }
+    SetModifyTime(staleTemp, OLD_MTIME);
+    SetModifyTime(otherFile, OLD_MTIME);
+    ASSERT_EQ(HapticEventCache::GetInstance().SetCacheConfig(CACHE_DIR, CACHE_SIZE_MAX), Sensors::SUCCESS);
+    EXPECT_NE(access(staleTemp.c_str(), F_OK), 0);
+    EXPECT_EQ(access(freshTemp.c_str(), F_OK), 0);
+    EXPECT_EQ(access(otherFile.c_str(), F_OK), 0);
+}
+} // namespace Sensors
+} // namespace OHOS
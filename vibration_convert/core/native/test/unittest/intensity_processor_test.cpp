@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cmath>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "intensity_processor.h"
+#include "sensor_log.h"
+#include "sensors_errors.h"
+#include "utils.h"
+#include "vibration_convert_type.h"
+
+#undef LOG_TAG
+#define LOG_TAG "IntensityProcessorTest"
+
+namespace OHOS {
+namespace Sensors {
+using namespace testing::ext;
+using namespace OHOS::HiviewDFX;
+
+namespace {
+constexpr double EPSILON = 1e-6;
+constexpr size_t TEST_SAMPLE_COUNT = 101;
+
+std::vector<AudioSample> CreateSignal(size_t count)
+{
+    std::vector<AudioSample> signal(count);
+    for (size_t i = 0; i < count; ++i) {
+        signal[i] = static_cast<AudioSample>(0.45 * std::sin(0.3 * i));
+    }
+    return signal;
+}
+
+std::vector<double> DirectSums(const std::vector<AudioSample> &data, size_t windowLen, size_t hopLength, bool isSquare)
+{
+    std::vector<double> sums;
+    for (size_t begin = 0; (begin + windowLen) < data.size(); begin += hopLength) {
+        double sum = 0.0;
+        for (size_t i = begin; i < begin + windowLen; ++i) {
+            double sample = data[i];
+            sum += isSquare ? (sample * sample) : std::fabs(sample);
+        }
+        sums.push_back(sum);
+    }
+    return sums;
+}
+
+void ExpectSums(const std::vector<double> &sums, const std::vector<double> &expected)
+{
+    ASSERT_EQ(sums.size(), expected.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+        EXPECT_NEAR(sums[i], expected[i], EPSILON) << "frame " << i;
+    }
+}
+} // namespace
+
+class IntensityProcessorTest : public testing::Test {
+public:
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp();
+    void TearDown();
+};
+
+void IntensityProcessorTest::SetUpTestCase() {}
+
+void IntensityProcessorTest::TearDownTestCase() {}
+
+void IntensityProcessorTest::SetUp() {}
+
+void IntensityProcessorTest::TearDown() {}
+
+HWTEST_F(IntensityProcessorTest, IntensityProcessorTest_001, TestSize.Level1)
+{
+    SEN_HILOGI("IntensityProcessorTest_001 in");
+    // Every sample is below 1, a sum truncated to an integer would be 0 for every frame
+    std::vector<AudioSample> data(TEST_SAMPLE_COUNT, static_cast<AudioSample>(-0.25));
+    IntensityProcessor intensityProcessor;
+    std::vector<double> volume = intensityProcessor.VolumeInLinary(data, 8);
+    ASSERT_FALSE(volume.empty());
+    for (double value : volume) {
+        EXPECT_NEAR(value, 2.0, EPSILON);
+    }
+    std::vector<double> energy = intensityProcessor.EnergyEnvelop(data, 8, 8);
+    ASSERT_EQ(energy.size(), volume.size());
+    for (double value : energy) {
+        EXPECT_NEAR(value, 0.5, EPSILON);
+    }
+    // 64 samples of 0.25 hold an energy of 4, its volume is 10 * ln(4) instead of the 0 of a truncated sum
+    std::vector<double> db = intensityProcessor.VolumeInDB(data, 64);
+    ASSERT_EQ(db.size(), 1U);
+    EXPECT_NEAR(db[0], 10.0 * std::log(4.0), EPSILON);
+}
+
+HWTEST_F(IntensityProcessorTest, IntensityProcessorTest_002, TestSize.Level1)
+{
+    SEN_HILOGI("IntensityProcessorTest_002 in");
+    // Overlapping windows slide the running sum, which must match summing every window from scratch
+    std::vector<AudioSample> data = CreateSignal(TEST_SAMPLE_COUNT);
+    IntensityProcessor intensityProcessor;
+    ExpectSums(intensityProcessor.EnergyEnvelop(data, 16, 4), DirectSums(data, 16, 4, true));
+    ExpectSums(intensityProcessor.EnergyEnvelop(data, 4, 16), DirectSums(data, 4, 16, true));
+    ExpectSums(intensityProcessor.VolumeInLinary(data, 10), DirectSums(data, 10, 10, false));
+    ExpectSums(ObtainAmplitudeEnvelop(data, 12, 3), DirectSums(data, 12, 3, false));
+}
+} // namespace Sensors
+} // namespace OHOS
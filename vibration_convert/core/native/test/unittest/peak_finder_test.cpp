@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "peak_finder.h"
+#include "sensor_log.h"
+#include "sensors_errors.h"
+#include "vibration_convert_type.h"
+
+#undef LOG_TAG
+#define LOG_TAG "PeakFinderTest"
+
+namespace OHOS {
+namespace Sensors {
+using namespace testing::ext;
+using namespace OHOS::HiviewDFX;
+
+namespace {
+constexpr double PEAK_THRESHOLD = 0.3;
+constexpr size_t SAMPLE_COUNT = 44100;
+const std::vector<double> RISING_ENVELOPE = { 0.0, 0.1, 0.2, 0.3, 0.4, 0.5 };
+const std::vector<double> FALLING_ENVELOPE = { 0.5, 0.4, 0.3, 0.2, 0.1, 0.0 };
+} // namespace
+
+class PeakFinderTest : public testing::Test {
+public:
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp();
+    void TearDown();
+};
+
+void PeakFinderTest::SetUpTestCase() {}
+
+void PeakFinderTest::TearDownTestCase() {}
+
+void PeakFinderTest::SetUp() {}
+
+void PeakFinderTest::TearDown() {}
+
+HWTEST_F(PeakFinderTest, PeakFinderTest_001, TestSize.Level1)
+{
+    PeakFinder peakFinder;
+    // A rising envelope has no falling edge, so there is no gradient to take the maximum of
+    EXPECT_TRUE(peakFinder.DetectPeak(RISING_ENVELOPE, PEAK_THRESHOLD).empty());
+    EXPECT_TRUE(peakFinder.DetectPeak(RISING_ENVELOPE, 0.0).empty());
+    std::vector<int32_t> peaks = peakFinder.DetectPeak(FALLING_ENVELOPE, PEAK_THRESHOLD);
+    ASSERT_EQ(peaks.size(), 1U);
+    EXPECT_EQ(peaks[0], 0);
+}
+
+HWTEST_F(PeakFinderTest, PeakFinderTest_002, TestSize.Level1)
+{
+    PeakFinder peakFinder;
+    std::vector<double> flatEnvelope(SAMPLE_COUNT, 0.0);
+    EXPECT_TRUE(peakFinder.DetectPeak(flatEnvelope, PEAK_THRESHOLD).empty());
+    // Two points give a single gradient, which must not be read as two
+    EXPECT_TRUE(peakFinder.DetectPeak({ 0.5, 0.1 }, PEAK_THRESHOLD).empty());
+    EXPECT_TRUE(peakFinder.DetectPeak({ 0.5 }, PEAK_THRESHOLD).empty());
+}
+
+HWTEST_F(PeakFinderTest, PeakFinderTest_003, TestSize.Level1)
+{
+    PeakFinder peakFinder;
+    std::vector<AudioSample> silence(SAMPLE_COUNT, 0);
+    IsolatedEnvelopeInfo isolatedEnvelopeInfo;
+    // Every peak of a silent clip is filtered out as too low
+    EXPECT_NE(peakFinder.ObtainTransientByAmplitude(silence, isolatedEnvelopeInfo), Sensors::SUCCESS);
+    EXPECT_TRUE(isolatedEnvelopeInfo.mountainPosition.peakPos.empty());
+}
+
+HWTEST_F(PeakFinderTest, PeakFinderTest_004, TestSize.Level1)
+{
+    PeakFinder peakFinder;
+    std::vector<AudioSample> ramp(SAMPLE_COUNT);
+    for (size_t i = 0; i < ramp.size(); ++i) {
+        ramp[i] = static_cast<AudioSample>(i) / static_cast<AudioSample>(ramp.size());
+    }
+    IsolatedEnvelopeInfo isolatedEnvelopeInfo;
+    EXPECT_NE(peakFinder.ObtainTransientByAmplitude(ramp, isolatedEnvelopeInfo), Sensors::SUCCESS);
+    EXPECT_TRUE(isolatedEnvelopeInfo.mountainPosition.peakPos.empty());
+}
+} // namespace Sensors
+} // namespace OHOS
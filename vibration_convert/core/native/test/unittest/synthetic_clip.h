@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef UT_SYNTHETIC_CLIP_H
+#define UT_SYNTHETIC_CLIP_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace OHOS {
+namespace Sensors {
+namespace SyntheticClip {
+constexpr uint32_t RANDOM_SEED = 20260101;
+constexpr double PI = 3.14159265358979323846;
+constexpr double SWEEP_FREQ_MIN = 20.0;
+constexpr double SWEEP_FREQ_RATIO = 0.45;
+constexpr double SIGNAL_AMPLITUDE = 0.8;
+constexpr double NOISE_AMPLITUDE = 0.5;
+constexpr double DRUM_BEAT_SECONDS = 0.25;
+constexpr double KICK_FREQ = 60.0;
+constexpr double KICK_DECAY = 30.0;
+constexpr double SNARE_DECAY = 45.0;
+constexpr int32_t DRUM_BEATS_PER_BAR = 4;
+
+enum ClipType {
+    CLIP_SINE_SWEEP = 0,
+    CLIP_DRUM_LOOP = 1,
+    CLIP_WHITE_NOISE = 2,
+    CLIP_SILENCE = 3,
+};
+
+struct ClipSpec {
+    const char *name;
+    ClipType type;
+    uint32_t sampleRate;
+    double seconds;
+};
+
+/*
+ * Synthetic clips generated from a fixed seed for the golden tests. The expected output
+ * recorded for them stays valid until the converter itself changes.
+ */
+inline std::vector<double> GenerateClip(const ClipSpec &spec)
+{
+    size_t count = static_cast<size_t>(spec.sampleRate * spec.seconds);
+    std::vector<double> samples(count, 0.0);
+    std::mt19937 generator(RANDOM_SEED);
+    std::uniform_real_distribution<double> noise(-1.0, 1.0);
+    double rate = static_cast<double>(spec.sampleRate);
+    switch (spec.type) {
+        case CLIP_SINE_SWEEP: {
+            // Exponential sweep from SWEEP_FREQ_MIN to just below Nyquist
+            double freqMax = rate * SWEEP_FREQ_RATIO;
+            double growth = std::log(freqMax / SWEEP_FREQ_MIN) / spec.seconds;
+            for (size_t i = 0; i < count; ++i) {
+                double time = static_cast<double>(i) / rate;
+                double phase = 2.0 * PI * SWEEP_FREQ_MIN * (std::exp(growth * time) - 1.0) / growth;
+                samples[i] = SIGNAL_AMPLITUDE * std::sin(phase);
+            }
+            break;
+        }
+        case CLIP_DRUM_LOOP: {
+            // A kick on the first and third beat of each bar, a snare on the others
+            size_t beatLen = static_cast<size_t>(rate * DRUM_BEAT_SECONDS);
+            for (size_t i = 0; i < count; ++i) {
+                size_t beat = i / beatLen;
+                double time = static_cast<double>(i % beatLen) / rate;
+                if ((beat % DRUM_BEATS_PER_BAR) % 2 == 0) {
+                    samples[i] = SIGNAL_AMPLITUDE * std::exp(-KICK_DECAY * time) *
+                        std::sin(2.0 * PI * KICK_FREQ * time);
+                } else {
+                    samples[i] = SIGNAL_AMPLITUDE * std::exp(-SNARE_DECAY * time) * noise(generator);
+                }
+            }
+            break;
+        }
+        case CLIP_WHITE_NOISE:
+            for (auto &sample : samples) {
+                sample = NOISE_AMPLITUDE * noise(generator);
+            }
+            break;
+        default:
+            break;
+    }
+    return samples;
+}
+
+/* Round the samples to 16 bit PCM and back, as writing the clip to a wave file and parsing it again does */
+inline int16_t ToPcm16(double sample)
+{
+    return static_cast<int16_t>(std::lround(std::clamp(sample, -1.0, 1.0) * INT16_MAX));
+}
+
+template<typename T>
+std::vector<T> QuantizeToPcm16(const std::vector<double> &samples)
+{
+    std::vector<T> quantized(samples.size());
+    for (size_t i = 0; i < samples.size(); ++i) {
+        quantized[i] = static_cast<T>(static_cast<double>(ToPcm16(samples[i])) / INT16_MAX);
+    }
+    return quantized;
+}
+} // namespace SyntheticClip
+} // namespace Sensors
+} // namespace OHOS
+#endif // UT_SYNTHETIC_CLIP_H
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef UT_SYNTHETIC_CLIP_GOLDEN_H
+#define UT_SYNTHETIC_CLIP_GOLDEN_H
+
+#include <vector>
+
+#include "synthetic_clip.h"
+
+namespace OHOS {
+namespace Sensors {
+struct ExpectedEnvelope {
+    int32_t firstPos;
+    int32_t peakPos;
+    int32_t lastPos;
+    bool isTransient;
+};
+
+struct ExpectedClip {
+    SyntheticClip::ClipSpec spec;
+    bool isSuccess;
+    bool isHaveContinuousEvent;
+    int32_t longestSampleCount;
+    std::vector<ExpectedEnvelope> envelopes;
+};
+
+/*
+ * Isolated envelopes that PeakFinder::ObtainTransientByAmplitude finds in the synthetic clips after a round trip
+ * through 16 bit PCM. The values are the same in double and single precision builds. When the transient detection
+ * is changed on purpose, the failing test prints the new values in this layout.
+ */
+const std::vector<ExpectedClip> EXPECTED_CLIPS = {
+    {
+        { "sweep_16k_1s", SyntheticClip::CLIP_SINE_SWEEP, 16000, 1.0 },
+        true, true, 13533,
+        {
+            { 2444, 15537, 15977, false },
+        }
+    },
+    {
+        { "drum_22k_5s", SyntheticClip::CLIP_DRUM_LOOP, 22050, 5.0 },
+        true, false, 692,
+        {
+            { 0, 87, 165, true },
+            { 5481, 5547, 6158, true },
+            { 11008, 11111, 11189, true },
+            { 16504, 16549, 17167, true },
+            { 22032, 22135, 22213, true },
+            { 27528, 27573, 28220, true },
+            { 33056, 33159, 33237, true },
+            { 38552, 38593, 39230, true },
+            { 44080, 44183, 44261, true },
+            { 49576, 49623, 50219, true },
+            { 55104, 55207, 55285, true },
+            { 60600, 60632, 61291, true },
+            { 66128, 66231, 66309, true },
+            { 71624, 71709, 72299, true },
+            { 77152, 77255, 77333, true },
+            { 82648, 82688, 83305, true },
+            { 88176, 88279, 88357, true },
+            { 93672, 93738, 94317, true },
+            { 99200, 99303, 99381, true },
+            { 104696, 104744, 105382, true },
+        }
+    },
+    {
+        { "noise_44k_2s", SyntheticClip::CLIP_WHITE_NOISE, 44100, 2.0 },
+        true, true, 88171,
+        {
+            { 0, 87457, 88171, false },
+        }
+    },
+    {
+        { "silence_44k_3s", SyntheticClip::CLIP_SILENCE, 44100, 3.0 },
+        false, false, 0,
+        {}
+    },
+};
+} // namespace Sensors
+} // namespace OHOS
+#endif // UT_SYNTHETIC_CLIP_GOLDEN_H
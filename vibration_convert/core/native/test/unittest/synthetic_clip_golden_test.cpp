@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "peak_finder.h"
+#include "sensor_log.h"
+#include "sensors_errors.h"
+#include "synthetic_clip.h"
+#include "synthetic_clip_golden.h"
+#include "vibration_convert_type.h"
+
+#undef LOG_TAG
+#define LOG_TAG "SyntheticClipGoldenTest"
+
+namespace OHOS {
+namespace Sensors {
+using namespace testing::ext;
+using namespace OHOS::HiviewDFX;
+
+namespace {
+std::string FormatEnvelopes(const IsolatedEnvelopeInfo &isolatedEnvelopeInfo)
+{
+    const MountainPosition &mountainPosition = isolatedEnvelopeInfo.mountainPosition;
+    std::string text;
+    for (size_t i = 0; i < mountainPosition.peakPos.size(); ++i) {
+        bool isTransient = (i < isolatedEnvelopeInfo.transientEventFlags.size()) &&
+            isolatedEnvelopeInfo.transientEventFlags[i];
+        text += "{ " + std::to_string(mountainPosition.firstPos[i]) + ", " +
+            std::to_string(mountainPosition.peakPos[i]) + ", " + std::to_string(mountainPosition.lastPos[i]) + ", " +
+            (isTransient ? "true" : "false") + " },\n";
+    }
+    return text;
+}
+
+std::string FormatEnvelopes(const std::vector<ExpectedEnvelope> &envelopes)
+{
+    std::string text;
+    for (const auto &envelope : envelopes) {
+        text += "{ " + std::to_string(envelope.firstPos) + ", " + std::to_string(envelope.peakPos) + ", " +
+            std::to_string(envelope.lastPos) + ", " + (envelope.isTransient ? "true" : "false") + " },\n";
+    }
+    return text;
+}
+} // namespace
+
+class SyntheticClipGoldenTest : public testing::Test {
+public:
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp();
+    void TearDown();
+};
+
+void SyntheticClipGoldenTest::SetUpTestCase() {}
+
+void SyntheticClipGoldenTest::TearDownTestCase() {}
+
+void SyntheticClipGoldenTest::SetUp() {}
+
+void SyntheticClipGoldenTest::TearDown() {}
+
+HWTEST_F(SyntheticClipGoldenTest, SyntheticClipGoldenTest_001, TestSize.Level1)
+{
+    for (const auto &expected : EXPECTED_CLIPS) {
+        SCOPED_TRACE(expected.spec.name);
+        std::vector<AudioSample> samples =
+            SyntheticClip::QuantizeToPcm16<AudioSample>(SyntheticClip::GenerateClip(expected.spec));
+        PeakFinder peakFinder;
+        IsolatedEnvelopeInfo isolatedEnvelopeInfo;
+        int32_t ret = peakFinder.ObtainTransientByAmplitude(samples, isolatedEnvelopeInfo);
+        EXPECT_EQ(ret == Sensors::SUCCESS, expected.isSuccess);
+        EXPECT_EQ(isolatedEnvelopeInfo.isHaveContinuousEvent, expected.isHaveContinuousEvent);
+        EXPECT_EQ(isolatedEnvelopeInfo.longestSampleCount, expected.longestSampleCount);
+        // Compared as text, so that a mismatch prints the whole new table in the layout of the golden header
+        EXPECT_EQ(FormatEnvelopes(isolatedEnvelopeInfo), FormatEnvelopes(expected.envelopes));
+    }
+}
+
+HWTEST_F(SyntheticClipGoldenTest, SyntheticClipGoldenTest_002, TestSize.Level1)
+{
+    // The clips must not depend on anything but the fixed seed, or the golden values above would be meaningless
+    for (const auto &expected : EXPECTED_CLIPS) {
+        SCOPED_TRACE(expected.spec.name);
+        EXPECT_EQ(SyntheticClip::GenerateClip(expected.spec), SyntheticClip::GenerateClip(expected.spec));
+    }
+}
+} // namespace Sensors
+} // namespace OHOS
@@ -16,6 +16,7 @@
 #ifndef CONVERSION_UTILS_H
 #define CONVERSION_UTILS_H
 
+#include <algorithm>
 #include <cfloat>
 #include <cmath>
 #include <functional>
@@ -61,6 +62,17 @@ enum FilterMethod {
     BAND_PASS_FILTER = 3,
 };
 
+/**
+ * Type of the audio samples carried from parsing to feature extraction. Building with
+ * VIBRATION_CONVERT_SINGLE_PRECISION keeps them in float, halving the memory traffic of the per-sample passes.
+ * Per-frame features derived from the samples stay in double.
+ */
+#ifdef VIBRATION_CONVERT_SINGLE_PRECISION
+using AudioSample = float;
+#else
+using AudioSample = double;
+#endif
+
 bool IsPowerOfTwo(uint32_t x);
 uint32_t ObtainNumberOfBits(uint32_t powerOfTwo);
 uint32_t ReverseBits(uint32_t index, uint32_t numBits);
@@ -141,6 +153,7 @@ int32_t ProcessSilence(const std::vector<double> &values, const std::vector<bool
  * @return Returns amplitude value for each frame
  */
 std::vector<double> ObtainAmplitudeEnvelop(const std::vector<double> &data, size_t count, size_t hopLength);
+std::vector<double> ObtainAmplitudeEnvelop(const std::vector<float> &data, size_t count, size_t hopLength);
 
 inline double ConvertSlaneyMel(double hz)
 {
@@ -182,6 +195,50 @@ inline bool IsEqual(const T& left, const T& right)
     return (std::abs(left - right) <= std::numeric_limits<T>::epsilon());
 }
 
+/**
+ * @brief Sum of transform(sample) over windows of windowLen samples, starting every hopLength samples and ending
+ *  before the last sample. A running sum adds the samples entering and removes the samples leaving each window, so
+ *  the cost is O(n) for any overlap and no frame is copied.
+ *
+ * @param data Audio time series.
+ * @param windowLen Length of a window in samples.
+ * @param hopLength Hop length.
+ * @param transform Maps a sample to a non-negative value, such as its magnitude or energy.
+ *
+ * @return Return the sum of each window, accumulated in double whatever the sample type.
+ */
+template<typename Sample, typename Transform>
+std::vector<double> WindowedSum(const std::vector<Sample> &data, size_t windowLen, size_t hopLength,
+    Transform transform)
+{
+    std::vector<double> sums;
+    size_t dataSize = data.size();
+    if ((windowLen == 0) || (hopLength == 0) || (dataSize <= windowLen)) {
+        return sums;
+    }
+    sums.reserve(((dataSize - windowLen - 1) / hopLength) + 1);
+    double sum = 0.0;
+    size_t start = 0;
+    size_t end = 0;
+    for (size_t begin = 0; (begin + windowLen) < dataSize; begin += hopLength) {
+        if (begin >= end) {
+            sum = 0.0;
+            end = begin;
+        } else {
+            for (; start < begin; ++start) {
+                sum -= transform(data[start]);
+            }
+        }
+        start = begin;
+        for (; end < (begin + windowLen); ++end) {
+            sum += transform(data[end]);
+        }
+        // removing samples may leave a rounding error below zero
+        sums.push_back(std::max(sum, 0.0));
+    }
+    return sums;
+}
+
 inline double ConvertHtkMel(double frequencies)
 {
     double mels = (frequencies - MIN_F) / FSP;
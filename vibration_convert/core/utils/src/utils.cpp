@@ -236,28 +236,27 @@ int32_t ProcessSilence(const std::vector<double> &values, const std::vector<bool
     return Sensors::SUCCESS;
 }
 
-std::vector<double> ObtainAmplitudeEnvelop(const std::vector<double> &data, size_t count, size_t hopLength)
+namespace {
+template<typename Sample>
+std::vector<double> AmplitudeEnvelop(const std::vector<Sample> &data, size_t count, size_t hopLength)
 {
     CALL_LOG_ENTER;
     if (data.empty() || (data.size() < count)) {
         SEN_HILOGE("data is empty or data is less than count");
         return {};
     }
-    std::vector<double> absData;
-    for (size_t i = 0; i < data.size(); i++) {
-        absData.push_back(fabs(data[i]));
-    }
-    std::vector<double> partAmplitude;
-    std::vector<double> enery;
-    std::vector<double>::iterator it = absData.begin();
-    double accum = 0.0;
-    for (size_t j = 0; j < (data.size() - count);) {
-        partAmplitude.assign(it + j, it + j + count);
-        accum = accumulate(partAmplitude.begin(), partAmplitude.end(), 0);
-        enery.push_back(accum);
-        j += hopLength;
-    }
-    return enery;
+    return WindowedSum(data, count, hopLength, [](double sample) { return std::fabs(sample); });
+}
+} // namespace
+
+std::vector<double> ObtainAmplitudeEnvelop(const std::vector<double> &data, size_t count, size_t hopLength)
+{
+    return AmplitudeEnvelop(data, count, hopLength);
+}
+
+std::vector<double> ObtainAmplitudeEnvelop(const std::vector<float> &data, size_t count, size_t hopLength)
+{
+    return AmplitudeEnvelop(data, count, hopLength);
 }
 } // namespace Sensors
 } // namespace OHOS
\ No newline at end of file
@@ -30,6 +30,7 @@ public:
     static napi_value GetAudioAttribute(napi_env env, napi_callback_info info);
     static napi_value GetAudioData(napi_env env, napi_callback_info info);
     static napi_value ConvertAudioToHaptic(napi_env env, napi_callback_info info);
+    static napi_value SetCacheConfig(napi_env env, napi_callback_info info);
     static napi_value ConvertAudioToHapticConstructor(napi_env env, napi_callback_info info);
     static napi_value CreateInstance(napi_env env);
 
@@ -39,6 +40,7 @@ private:
     static VibratorConvert *GetInstance(napi_env env);
     static bool ParseParameter(napi_env env, napi_value &value, RawFileDescriptor &fileDescriptor);
     static bool ParseAudioSettings(napi_env env, napi_value &value, AudioSetting &audioSetting);
+    static bool ParseCacheSettings(napi_env env, napi_value &value, std::string &cacheDir, int64_t &maxCacheSize);
 
 private:
     std::shared_ptr<AudioParsing> audioParsing_ { nullptr };
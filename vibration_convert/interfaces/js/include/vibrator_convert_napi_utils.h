@@ -68,6 +68,7 @@ bool GetInt32Value(const napi_env &env, const napi_value &value, int32_t &result
 bool GetInt64Value(const napi_env &env, const napi_value &value, int64_t &result);
 bool GetPropertyInt32(const napi_env &env, const napi_value &value, const std::string &type, int32_t &result);
 bool GetPropertyInt64(const napi_env &env, const napi_value &value, const std::string &type, int64_t &result);
+bool GetPropertyString(const napi_env &env, const napi_value &value, const std::string &type, std::string &result);
 bool ConvertErrorToResult(const napi_env &env, sptr<AsyncCallbackInfo> asyncCallbackInfo, napi_value &result);
 bool GetAudioAttributeResult(const napi_env &env, sptr<AsyncCallbackInfo> asyncCallbackInfo,
     napi_value result[], int32_t length);
@@ -19,6 +19,7 @@
 #include "napi/native_node_api.h"
 
 #include "audio_parsing.h"
+#include "haptic_event_cache.h"
 #include "sensor_napi_error.h"
 #include "vibrator_convert_napi_utils.h"
 
@@ -146,6 +147,21 @@ bool VibratorConvert::ParseAudioSettings(napi_env env, napi_value &value, AudioS
     return true;
 }
 
+bool VibratorConvert::ParseCacheSettings(napi_env env, napi_value &value, std::string &cacheDir,
+    int64_t &maxCacheSize)
+{
+    CALL_LOG_ENTER;
+    CHKCF(GetPropertyString(env, value, "cacheDir", cacheDir), "Get cacheDir failed");
+    maxCacheSize = HAPTIC_CACHE_SIZE_DEFAULT;
+    bool exist = false;
+    CHKCF((napi_has_named_property(env, value, "maxCacheSize", &exist) == napi_ok),
+        "napi_has_named_property failed");
+    if (exist) {
+        CHKCF(GetPropertyInt64(env, value, "maxCacheSize", maxCacheSize), "Get maxCacheSize failed");
+    }
+    return true;
+}
+
 napi_value VibratorConvert::ConvertAudioToHapticConstructor(napi_env env, napi_callback_info info)
 {
     CALL_LOG_ENTER;
@@ -295,5 +311,30 @@ napi_value VibratorConvert::ConvertAudioToHaptic(napi_env env, napi_callback_inf
     EmitHapticPromiseWork(asyncCallbackInfo);
     return promise;
 }
+
+napi_value VibratorConvert::SetCacheConfig(napi_env env, napi_callback_info info)
+{
+    CALL_LOG_ENTER;
+    size_t argc = 1;
+    napi_value args[1] = {};
+    napi_value thisArg = nullptr;
+    napi_status status = napi_get_cb_info(env, info, &argc, args, &thisArg, nullptr);
+    if ((status != napi_ok) || (argc < 1)) {
+        ThrowErr(env, PARAMETER_ERROR, "napi_get_cb_info failed");
+        return nullptr;
+    }
+    if (!IsMatchNapiType(env, args[0], napi_object)) {
+        ThrowErr(env, PARAMETER_ERROR, "Wrong argument type, should be object");
+        return nullptr;
+    }
+    // The cache is shared by every conversion of the process, an empty cacheDir disables it
+    std::string cacheDir;
+    int64_t maxCacheSize = HAPTIC_CACHE_SIZE_DEFAULT;
+    if (!ParseCacheSettings(env, args[0], cacheDir, maxCacheSize) ||
+        (AudioParsing::SetCacheConfig(cacheDir, maxCacheSize) != Sensors::SUCCESS)) {
+        ThrowErr(env, PARAMETER_ERROR, "Invalid cacheDir or maxCacheSize");
+    }
+    return nullptr;
+}
 } // namespace Sensors
 } // namespace OHOS
@@ -131,6 +131,28 @@ bool GetPropertyInt64(const napi_env &env, const napi_value &value, const std::s
     return true;
 }
 
+bool GetPropertyString(const napi_env &env, const napi_value &value, const std::string &type, std::string &result)
+{
+    CALL_LOG_ENTER;
+    bool exist = false;
+    napi_status status = napi_has_named_property(env, value, type.c_str(), &exist);
+    if (status != napi_ok || !exist) {
+        SEN_HILOGE("can not find %{public}s property", type.c_str());
+        return false;
+    }
+    napi_value item = nullptr;
+    CHKCF((napi_get_named_property(env, value, type.c_str(), &item) == napi_ok), "napi get property failed");
+    CHKCF(IsMatchNapiType(env, item, napi_string), "Wrong argument type. String expected");
+    size_t length = 0;
+    CHKCF((napi_get_value_string_utf8(env, item, nullptr, 0, &length) == napi_ok),
+        "napi_get_value_string_utf8 failed");
+    std::vector<char> buffer(length + 1, '\0');
+    CHKCF((napi_get_value_string_utf8(env, item, buffer.data(), buffer.size(), &length) == napi_ok),
+        "napi_get_value_string_utf8 failed");
+    result.assign(buffer.data(), length);
+    return true;
+}
+
 std::map<int32_t, ConstructResultFunc> g_convertFuncList = {
     { AUDIO_ATTRIBUTE_CALLBACK, GetAudioAttributeResult },
     { AUDIO_DATA_CALLBACK, GetAudioDataResult },